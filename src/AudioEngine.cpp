@@ -12,6 +12,7 @@
 
 #include "AudioEngine.h"
 #include <cstring>
+#include <chrono>
 
 namespace ChiptuneTracker {
 
@@ -128,6 +129,8 @@ void AudioEngine::audioCallback(void* device, void* output, const void* /*input*
 // ============================================================================
 
 void AudioEngine::render(float* output, uint32_t frameCount) {
+    const auto start = std::chrono::steady_clock::now();
+
     // Process any pending commands from UI thread
     processCommands();
 
@@ -143,6 +146,13 @@ void AudioEngine::render(float* output, uint32_t frameCount) {
         output[i * 2]     = sample;
         output[i * 2 + 1] = sample;
     }
+
+    // CPU load: render time as a fraction of the time the block plays for
+    if (frameCount > 0) {
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const double budget = static_cast<double>(frameCount) / SAMPLE_RATE;
+        m_cpuLoad.store(static_cast<float>(elapsed / budget), std::memory_order_relaxed);
+    }
 }
 
 // ============================================================================
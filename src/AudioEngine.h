@@ -17,6 +17,9 @@
 #include <cmath>
 #include <array>
 
+#include "RingBuffer.h"
+#include "Commands.h"
+
 // Forward declare miniaudio types to avoid including in header
 struct ma_device;
 struct ma_device_config;
@@ -30,76 +33,6 @@ constexpr uint32_t SAMPLE_RATE = 44100;
 constexpr uint32_t BUFFER_SIZE = 512;
 constexpr float    TWO_PI = 6.28318530718f;
 
-// ============================================================================
-// Lock-Free Ring Buffer for UI -> Audio Thread Communication
-// ============================================================================
-template<typename T, size_t Capacity>
-class LockFreeRingBuffer {
-public:
-    LockFreeRingBuffer() : m_head(0), m_tail(0) {}
-
-    // Producer (UI thread) - Returns true if push succeeded
-    bool push(const T& item) {
-        const size_t currentTail = m_tail.load(std::memory_order_relaxed);
-        const size_t nextTail = (currentTail + 1) % Capacity;
-
-        if (nextTail == m_head.load(std::memory_order_acquire)) {
-            return false; // Buffer full
-        }
-
-        m_buffer[currentTail] = item;
-        m_tail.store(nextTail, std::memory_order_release);
-        return true;
-    }
-
-    // Consumer (Audio thread) - Returns true if pop succeeded
-    bool pop(T& item) {
-        const size_t currentHead = m_head.load(std::memory_order_relaxed);
-
-        if (currentHead == m_tail.load(std::memory_order_acquire)) {
-            return false; // Buffer empty
-        }
-
-        item = m_buffer[currentHead];
-        m_head.store((currentHead + 1) % Capacity, std::memory_order_release);
-        return true;
-    }
-
-private:
-    std::array<T, Capacity> m_buffer;
-    std::atomic<size_t> m_head;
-    std::atomic<size_t> m_tail;
-};
-
-// ============================================================================
-// Audio Commands (UI -> Audio Thread)
-// ============================================================================
-enum class AudioCommandType : uint8_t {
-    SetFrequency,
-    SetVolume,
-    SetWaveform,
-    NoteOn,
-    NoteOff
-};
-
-enum class WaveformType : uint8_t {
-    Sine,       // For testing
-    Square,     // NES Pulse (will add PolyBLEP)
-    Triangle,   // NES Triangle
-    Sawtooth,   // PolyBLEP corrected
-    Noise       // LFSR
-};
-
-struct AudioCommand {
-    AudioCommandType type;
-    union {
-        float    frequency;
-        float    volume;
-        WaveformType waveform;
-        uint8_t  note;
-    } data;
-};
-
 // ============================================================================
 // Oscillator State (Per-voice, no allocations)
 // ============================================================================
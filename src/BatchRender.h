@@ -0,0 +1,192 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Batch Rendering
+ *
+ * Renders a list of jobs (project in, WAV out) on a pool of threads.
+ * Every job loads its own Project and drives its own Sequencer, so jobs
+ * share no state and a batch scales with the number of cores. Jobs are
+ * usually read from a manifest file, one per line:
+ *
+ *     <input> <output> [beats]
+ *
+ * where input is a .ctp path or "sample:<name or index>" for one of the
+ * bundled sample tracks. Paths with spaces go in double quotes; lines
+ * starting with '#' are comments.
+ */
+
+#include "Types.h"
+#include "Sequencer.h"
+#include "FileIO.h"
+#include "SampleTracks.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// Render Jobs
+// ============================================================================
+constexpr const char* SAMPLE_TRACK_PREFIX = "sample:";
+
+struct RenderJob {
+    std::string input;          // .ctp path, or SAMPLE_TRACK_PREFIX + name/index
+    std::string output;         // WAV path
+    float beats = 0.0f;         // 0 = length of the project
+    int pattern = -1;           // Render one pattern instead of the arrangement
+    int channel = 0;            // Channel the pattern plays on
+    SampleFormat format = SampleFormat::Int16;
+};
+
+struct RenderJobResult {
+    bool ok = false;
+    std::string error;
+    float beats = 0.0f;         // Length rendered (before the release tail)
+    float bpm = 0.0f;
+    double audioSeconds = 0.0;
+    double wallSeconds = 0.0;
+
+    double realtimeFactor() const {
+        return wallSeconds > 0.0 ? audioSeconds / wallSeconds : 0.0;
+    }
+};
+
+// Load a job's input into the project
+inline bool loadJobProject(const RenderJob& job, Project& project, std::string& error) {
+    const std::string prefix = SAMPLE_TRACK_PREFIX;
+    if (job.input.compare(0, prefix.size(), prefix) != 0) {
+        if (!loadProject(project, job.input)) {
+            error = "cannot load project " + job.input;
+            return false;
+        }
+        return true;
+    }
+
+    // Sample tracks by name, or by index into g_SampleTracks
+    const std::string name = job.input.substr(prefix.size());
+    int index = findSampleTrack(name);
+    const bool numeric = !name.empty() &&
+        std::all_of(name.begin(), name.end(), [](unsigned char c) { return std::isdigit(c) != 0; });
+    if (index < 0 && numeric) {
+        index = std::atoi(name.c_str());
+    }
+    if (index < 0 || index >= g_NumSampleTracks) {
+        error = "unknown sample track " + name;
+        return false;
+    }
+
+    loadSampleTrack(project, g_SampleTracks[index], std::clamp(job.channel, 0, Project::MAX_CHANNELS - 1));
+    return true;
+}
+
+// Render one job on the calling thread (plus renderThreads graph workers)
+inline RenderJobResult renderJob(const RenderJob& job, int renderThreads = 0) {
+    RenderJobResult result;
+    const auto start = std::chrono::steady_clock::now();
+
+    auto project = std::make_unique<Project>();
+    if (!loadJobProject(job, *project, result.error)) return result;
+
+    int pattern = job.pattern;
+    if (pattern >= static_cast<int>(project->patterns.size()) ||
+        job.channel < 0 || job.channel >= Project::MAX_CHANNELS) {
+        result.error = "pattern or channel out of range";
+        return result;
+    }
+
+    // Without clips there is nothing to arrange: play the first pattern
+    if (pattern < 0 && project->arrangement.empty()) {
+        pattern = 0;
+    }
+
+    result.bpm = project->bpm;
+    result.beats = job.beats > 0.0f ? job.beats : projectLengthBeats(*project, std::max(pattern, 0));
+    result.audioSeconds = static_cast<double>(renderLengthFrames(*project, result.beats)) / 44100.0;
+
+    auto sequencer = std::make_unique<Sequencer>();
+    sequencer->setSampleRate(44100.0f);
+    sequencer->setRenderThreads(renderThreads, RenderMode::Offline);
+    if (pattern >= 0) {
+        sequencer->setPreviewPattern(pattern, job.channel);
+    }
+    sequencer->setProject(project.get());
+    sequencer->setLoop(false, 0.0f, result.beats);  // Play through once, stop at the end
+
+    result.ok = exportWav(*project, *sequencer, job.output, result.beats, job.format);
+    if (!result.ok) result.error = "cannot write " + job.output;
+
+    result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+// ============================================================================
+// Manifest
+// ============================================================================
+inline bool parseRenderManifest(const std::string& filepath, std::vector<RenderJob>& jobs, std::string& error) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        error = "cannot open manifest " + filepath;
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+
+        std::istringstream iss(line);
+        RenderJob job;
+        if (!(iss >> std::ws) || iss.peek() == '#') continue;
+
+        if (!(iss >> std::quoted(job.input) >> std::quoted(job.output))) {
+            error = filepath + ":" + std::to_string(lineNumber) + ": expected <input> <output> [beats]";
+            return false;
+        }
+        iss >> job.beats;
+        jobs.push_back(job);
+    }
+    return true;
+}
+
+// ============================================================================
+// Job Queue
+// ============================================================================
+// Runs every job on 'threads' threads, each pulling the next unstarted job
+// until none are left. beforeJob(index, worker) and afterJob(index, worker,
+// result) are called on the worker thread around each job.
+template <typename BeforeJob, typename AfterJob>
+inline void runRenderJobs(const std::vector<RenderJob>& jobs, int threads,
+                          BeforeJob&& beforeJob, AfterJob&& afterJob) {
+    if (jobs.empty()) return;
+
+    threads = std::clamp(threads, 1, static_cast<int>(jobs.size()));
+    std::atomic<size_t> next{0};
+
+    auto worker = [&](int self) {
+        for (size_t index = next.fetch_add(1); index < jobs.size(); index = next.fetch_add(1)) {
+            beforeJob(index, self);
+            RenderJobResult result = renderJob(jobs[index]);
+            afterJob(index, self, result);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    for (int i = 0; i < threads; ++i) {
+        pool.emplace_back(worker, i);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+} // namespace ChiptuneTracker
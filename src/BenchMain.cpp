@@ -0,0 +1,787 @@
+/*
+ * ChiptuneTracker - DSP Benchmarks
+ *
+ * Measures the cost of the engine's building blocks and writes the
+ * results as JSON, so runs can be compared across releases:
+ *
+ *   chiptune-bench [--output results.json] [--filter text] [--quick]
+ *
+ * Covers the FastMath functions at every precision tier (with their
+ * speedup over the Exact tier), every OscillatorType at several
+ * polyphony levels, voices with each per-note effect, each effect in
+ * Effects.h plus the full
+ * EffectsChain, Sequencer::process with a growing number of clips, and
+ * project load/save and WAV writing. Each
+ * benchmark runs several times; the median and the fastest run are
+ * reported in nanoseconds per sample (per stereo frame for the
+ * sequencer and WAV writer, per note for project files).
+ */
+
+#include "Types.h"
+#include "FastMath.h"
+#include "Tuning.h"
+#include "Effects.h"
+#include "Synthesizer.h"
+#include "Sequencer.h"
+#include "FileIO.h"
+#include "WavWriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace ChiptuneTracker;
+
+namespace {
+
+// ============================================================================
+// Harness
+// ============================================================================
+constexpr float SAMPLE_RATE = 44100.0f;
+constexpr uint32_t BLOCK_SIZE = 256;
+
+struct BenchOptions {
+    std::string outputPath;     // Empty = stdout
+    std::string filter;         // Only benchmarks whose id contains this
+    int repetitions = 5;
+    double seconds = 2.0;       // Audio rendered per repetition
+};
+
+struct BenchResult {
+    std::string group;
+    std::string name;
+    std::vector<std::pair<std::string, int>> params;
+    std::string unit;
+    double median = 0.0;        // ns per unit
+    double fastest = 0.0;
+    uint64_t unitsPerRun = 0;
+    double baseline = 0.0;      // Median of the result this one is compared with (0 = none)
+    double speedup = 0.0;       // baseline / median
+};
+
+// Keeps results observable so the optimizer cannot drop the work
+volatile float g_sink = 0.0f;
+
+class Bench {
+public:
+    explicit Bench(const BenchOptions& options) : m_options(options) {}
+
+    const BenchOptions& options() const { return m_options; }
+    const std::vector<BenchResult>& results() const { return m_results; }
+
+    uint32_t framesPerRun() const {
+        return static_cast<uint32_t>(m_options.seconds * SAMPLE_RATE);
+    }
+
+    bool selected(const std::string& id) const {
+        return m_options.filter.empty() || id.find(m_options.filter) != std::string::npos;
+    }
+
+    // Time run() (which processes 'units' units) over the repetitions;
+    // returns the median
+    template <typename Fn>
+    double measure(BenchResult result, uint64_t units, Fn&& run) {
+        std::vector<double> times;
+        times.reserve(m_options.repetitions);
+        for (int rep = 0; rep < m_options.repetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            const auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::nano>(end - start).count() /
+                            static_cast<double>(units));
+        }
+        std::sort(times.begin(), times.end());
+
+        result.median = times[times.size() / 2];
+        result.fastest = times.front();
+        result.unitsPerRun = units;
+        if (result.baseline > 0.0) result.speedup = result.baseline / result.median;
+
+        std::fprintf(stderr, "  %-12s %-28s %10.2f ns/%s",
+                     result.group.c_str(), describe(result).c_str(), result.median, result.unit.c_str());
+        if (result.speedup > 0.0) std::fprintf(stderr, "  %.2fx", result.speedup);
+        std::fprintf(stderr, "\n");
+
+        const double median = result.median;
+        m_results.push_back(std::move(result));
+        return median;
+    }
+
+    static std::string describe(const BenchResult& result) {
+        std::string text = result.name;
+        for (const auto& [key, value] : result.params) {
+            text += " " + key + "=" + std::to_string(value);
+        }
+        return text;
+    }
+
+private:
+    BenchOptions m_options;
+    std::vector<BenchResult> m_results;
+};
+
+// Test signal for effects: a decaying saw with a little noise
+std::vector<float> makeInputSignal(size_t length) {
+    std::vector<float> signal(length);
+    uint32_t random = 0x12345678u;
+    for (size_t i = 0; i < length; ++i) {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        const float saw = static_cast<float>(i % 100) / 50.0f - 1.0f;
+        const float noise = static_cast<float>(random >> 8) / 16777215.0f - 0.5f;
+        signal[i] = 0.6f * saw + 0.1f * noise;
+    }
+    return signal;
+}
+
+// ============================================================================
+// Math - each FastMath function at every precision tier, scalar and
+// SimdFloat, against the Exact tier (the standard library)
+// ============================================================================
+// 'count' arguments spread over [low, high), in a shuffled order
+std::vector<float> makeMathInput(size_t count, float low, float high) {
+    std::vector<float> values(count);
+    uint32_t random = 0x9E3779B9u;
+    for (float& value : values) {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        value = low + (high - low) * (static_cast<float>(random >> 8) / 16777216.0f);
+    }
+    return values;
+}
+
+// fn(x) once per argument; returns the median
+template <typename Fn>
+double benchMathScalar(Bench& bench, const std::string& name, const std::vector<float>& input,
+                       double baseline, Fn&& fn) {
+    if (!bench.selected("math/" + name)) return 0.0;
+
+    const uint32_t count = bench.framesPerRun();
+    const size_t mask = input.size() - 1;   // Power-of-two length
+
+    // Read through volatile so the compiler cannot vectorize the loop
+    // (with a vector math library, the Exact tier would be timed 4 or 8
+    // calls at a time); the SIMD benchmarks cover that case
+    const volatile float* args = input.data();
+    auto run = [&](uint32_t n) {
+        float accum = 0.0f;
+        for (uint32_t i = 0; i < n; ++i) accum += fn(args[i & mask]);
+        g_sink = g_sink + accum;
+    };
+
+    run(BLOCK_SIZE * 16);  // Warm up
+    BenchResult result{"math", name, {}, "call"};
+    result.baseline = baseline;
+    return bench.measure(result, count, [&] { run(count); });
+}
+
+// fn(x) on SIMD_LANES arguments at a time; timed per argument
+template <typename Fn>
+double benchMathSimd(Bench& bench, const std::string& name, const std::vector<float>& input,
+                     double baseline, Fn&& fn) {
+    if (!bench.selected("math/" + name)) return 0.0;
+
+    const uint32_t count = bench.framesPerRun() / SIMD_LANES * SIMD_LANES;
+    const size_t mask = input.size() - 1;
+    auto run = [&](uint32_t n) {
+        SimdFloat accum(0.0f);
+        for (uint32_t i = 0; i < n; i += SIMD_LANES) accum = accum + fn(SimdFloat::load(&input[i & mask]));
+        g_sink = g_sink + accum.sum();
+    };
+
+    run(BLOCK_SIZE * 16);  // Warm up
+    BenchResult result{"math", name, {}, "value"};
+    result.baseline = baseline;
+    return bench.measure(result, count, [&] { run(count); });
+}
+
+// One function at every tier, scalar then SIMD. fn(tier, x) calls the
+// function at that tier (an std::integral_constant of MathPrecision).
+// Returns the Exact scalar median.
+template <typename Fn>
+double benchMathTiers(Bench& bench, const std::string& name, const std::vector<float>& input, Fn&& fn) {
+    double exactScalar = 0.0;
+    double exactSimd = 0.0;
+    auto tier = [&]<MathPrecision P>(const char* tierName) {
+        using Tier = std::integral_constant<MathPrecision, P>;
+        const double scalar = benchMathScalar(bench, name + "." + tierName, input, exactScalar,
+                                              [&](float x) { return fn(Tier{}, x); });
+        const double simd = benchMathSimd(bench, name + ".Simd." + tierName, input, exactSimd,
+                                          [&](SimdFloat x) { return fn(Tier{}, x); });
+        if (P == MathPrecision::Exact) {
+            exactScalar = scalar;
+            exactSimd = simd;
+        }
+    };
+    tier.template operator()<MathPrecision::Exact>("Exact");
+    tier.template operator()<MathPrecision::High>("High");
+    tier.template operator()<MathPrecision::Fast>("Fast");
+    return exactScalar;
+}
+
+void benchMath(Bench& bench) {
+    const std::vector<float> turns = makeMathInput(4096, -8.0f, 8.0f);
+    benchMathTiers(bench, "fastSinTurns", turns, [](auto tier, auto x) {
+        return fastSinTurns<decltype(tier)::value>(x);
+    });
+
+    const std::vector<float> exponents = makeMathInput(4096, -10.0f, 10.0f);
+    benchMathTiers(bench, "fastExp", exponents, [](auto tier, auto x) {
+        return fastExp<decltype(tier)::value>(x);
+    });
+
+    const std::vector<float> drives = makeMathInput(4096, -4.0f, 4.0f);
+    benchMathTiers(bench, "fastTanh", drives, [](auto tier, auto x) {
+        return fastTanh<decltype(tier)::value>(x);
+    });
+
+    // Pitch offsets: the tiered 2^(x / 12) (no SIMD version; the SIMD
+    // column is fastExp2 on the scaled offset, which is what it runs) and
+    // the table lookup the synths use
+    const std::vector<float> semitones = makeMathInput(4096, -48.0f, 48.0f);
+    const double exactRatio = benchMathTiers(bench, "semitonesToRatio", semitones, [](auto tier, auto x) {
+        constexpr MathPrecision P = decltype(tier)::value;
+        if constexpr (std::is_same_v<decltype(x), float>) return semitonesToRatio<P>(x);
+        else if constexpr (P == MathPrecision::Exact) {
+            return mathPerLane(x, [](float v) { return semitonesToRatio<P>(v); });
+        } else {
+            return fastExp2<P>(x * (1.0f / 12.0f));
+        }
+    });
+    benchMathScalar(bench, "pitchRatio.Table", semitones, exactRatio, [](float x) { return pitchRatio(x); });
+}
+
+// ============================================================================
+// Voices - one synth retriggering 'polyphony' notes every quarter second
+// ============================================================================
+template <typename NoteOn>
+void benchVoices(Bench& bench, const BenchResult& result, int polyphony, NoteOn noteOn) {
+    const uint32_t frames = bench.framesPerRun();
+
+    // Drums play from their one-shots, as in the engine
+    const DrumCache& drums = DrumCache::forSampleRate(SAMPLE_RATE);
+    drums.wait();
+    constexpr uint32_t RETRIGGER_FRAMES = 11025;   // New notes every quarter second
+    std::vector<float> output(BLOCK_SIZE);
+
+    // Enough voices for every note of a retrigger
+    VoicePool pool(std::max(polyphony, Synthesizer::MAX_VOICES), 1);
+    Synthesizer synth;
+    synth.attachVoicePool(&pool, 0);
+    synth.setSampleRate(SAMPLE_RATE);
+    synth.setDrumCache(&drums);
+    double time = 0.0;
+    const double timeStep = 1.0 / SAMPLE_RATE;
+
+    auto trigger = [&] {
+        synth.allNotesOff();
+        for (int v = 0; v < polyphony; ++v) {
+            noteOn(synth, 48 + (v * 3) % 48, time);
+        }
+    };
+
+    auto render = [&](uint32_t count) {
+        for (uint32_t done = 0; done < count; done += BLOCK_SIZE) {
+            if (done % RETRIGGER_FRAMES < BLOCK_SIZE) trigger();
+            const uint32_t n = std::min(BLOCK_SIZE, count - done);
+            synth.process(output.data(), n, time, timeStep);
+            time += n * timeStep;
+            g_sink = g_sink + output[0];
+        }
+    };
+
+    render(BLOCK_SIZE * 16);  // Warm up
+    bench.measure(result, frames, [&] { render(frames); });
+}
+
+// ============================================================================
+// Oscillators - 'polyphony' voices of one OscillatorType
+// ============================================================================
+void benchOscillators(Bench& bench) {
+    const int polyphonies[] = {1, 4, Synthesizer::MAX_VOICES, 64};
+
+    for (int type = 0; type < OSCILLATOR_TYPE_COUNT; ++type) {
+        const OscillatorType osc = static_cast<OscillatorType>(type);
+        const std::string name = oscillatorTypeToString(osc);
+
+        for (int polyphony : polyphonies) {
+            if (!bench.selected("oscillator/" + name)) continue;
+
+            benchVoices(bench, {"oscillator", name, {{"polyphony", polyphony}}, "sample"}, polyphony,
+                        [&](Synthesizer& synth, int note, double time) {
+                            synth.noteOn(note, 0.8f, time, 0.0f, 0.0f, 0.0f, osc);
+                        });
+        }
+    }
+}
+
+// ============================================================================
+// Modulation - Pulse voices with per-note effects (slide, arpeggio,
+// vibrato, sweep, tremolo, fades)
+// ============================================================================
+void benchModulation(Bench& bench) {
+    struct Case {
+        const char* name;
+        float vibrato;
+        int arpeggio;
+        float slide;
+        SweepDirection sweep;
+        float tremolo;
+        float fade;
+    };
+    const Case cases[] = {
+        {"Vibrato",  0.5f, 0x00, 0.0f,  SweepDirection::None, 0.0f, 0.0f},
+        {"Arpeggio", 0.0f, 0x47, 0.0f,  SweepDirection::None, 0.0f, 0.0f},
+        {"Slide",    0.0f, 0x00, -7.0f, SweepDirection::None, 0.0f, 0.0f},
+        {"Sweep",    0.0f, 0x00, 0.0f,  SweepDirection::Down, 0.0f, 0.0f},
+        {"Tremolo",  0.0f, 0x00, 0.0f,  SweepDirection::None, 0.6f, 0.0f},
+        {"Fade",     0.0f, 0x00, 0.0f,  SweepDirection::None, 0.0f, 0.05f},
+        {"All",      0.5f, 0x47, -7.0f, SweepDirection::Down, 0.6f, 0.05f},
+    };
+    const int polyphonies[] = {1, Synthesizer::MAX_VOICES};
+
+    for (const Case& c : cases) {
+        for (int polyphony : polyphonies) {
+            if (!bench.selected(std::string("modulation/") + c.name)) continue;
+
+            benchVoices(bench, {"modulation", c.name, {{"polyphony", polyphony}}, "sample"}, polyphony,
+                        [&](Synthesizer& synth, int note, double time) {
+                            synth.noteOn(note, 0.8f, time, c.fade, c.fade, 0.25f, OscillatorType::Pulse,
+                                         c.vibrato, c.arpeggio, c.slide, DutyCycle::Duty50, false,
+                                         c.sweep, 4.0f, 12.0f, c.tremolo, 6.0f);
+                        });
+        }
+    }
+}
+
+// ============================================================================
+// Effects - each effect class on its own, then the whole chain
+// ============================================================================
+template <typename Process>
+void benchEffect(Bench& bench, const std::string& name, const std::vector<float>& input, Process&& process) {
+    if (!bench.selected("effect/" + name)) return;
+
+    const uint32_t frames = bench.framesPerRun();
+    const size_t mask = input.size() - 1;   // Power-of-two length
+    double time = 0.0;
+    const double timeStep = 1.0 / SAMPLE_RATE;
+
+    auto run = [&](uint32_t count) {
+        float accum = 0.0f;
+        for (uint32_t i = 0; i < count; ++i) {
+            accum += process(input[i & mask], time);
+            time += timeStep;
+        }
+        g_sink = g_sink + accum;
+    };
+
+    run(BLOCK_SIZE * 16);  // Warm up
+    bench.measure({"effect", name, {}, "sample"}, frames, [&] { run(frames); });
+}
+
+// The same for effects that take a block at a time: process(buffer, count)
+// in place, up to BLOCK_SIZE samples per call
+template <typename Process>
+void benchEffectBlock(Bench& bench, const std::string& name, const std::vector<float>& input, Process&& process) {
+    if (!bench.selected("effect/" + name)) return;
+
+    const uint32_t frames = bench.framesPerRun();
+    const size_t mask = input.size() - 1;   // Power-of-two length
+    std::vector<float> block(BLOCK_SIZE);
+    size_t position = 0;
+
+    auto run = [&](uint32_t count) {
+        float accum = 0.0f;
+        for (uint32_t done = 0; done < count; ) {
+            const uint32_t n = std::min(BLOCK_SIZE, count - done);
+            for (uint32_t i = 0; i < n; ++i) block[i] = input[position++ & mask];
+            process(block.data(), n);
+            accum += block[0];
+            done += n;
+        }
+        g_sink = g_sink + accum;
+    };
+
+    run(BLOCK_SIZE * 16);  // Warm up
+    bench.measure({"effect", name, {}, "sample"}, frames, [&] { run(frames); });
+}
+
+void benchEffects(Bench& bench) {
+    const std::vector<float> input = makeInputSignal(4096);
+
+    Bitcrusher bitcrusher;
+    bitcrusher.sampleRateReduction = 4.0f;
+    benchEffect(bench, "Bitcrusher", input, [&](float x, double) { return bitcrusher.process(x); });
+
+    const std::pair<const char*, DistortionType> distortions[] = {
+        {"Distortion.Tanh", DistortionType::Tanh},
+        {"Distortion.HardClip", DistortionType::HardClip},
+        {"Distortion.Foldback", DistortionType::Foldback},
+        {"Distortion.Asymmetric", DistortionType::Asymmetric},
+    };
+    for (const auto& [name, type] : distortions) {
+        Distortion distortion;
+        distortion.type = type;
+        distortion.drive = 4.0f;
+        benchEffect(bench, name, input, [&](float x, double) { return distortion.process(x); });
+    }
+
+    Vibrato vibrato;
+    benchEffect(bench, "Vibrato", input, [&](float x, double t) { return x * vibrato.process(t); });
+
+    Tremolo tremolo;
+    benchEffect(bench, "Tremolo", input, [&](float x, double t) { return x * tremolo.process(t); });
+
+    Delay delay;
+    delay.setSampleRate(SAMPLE_RATE);
+    benchEffect(bench, "Delay", input, [&](float x, double) { return delay.process(x); });
+
+    Filter filter;
+    filter.setSampleRate(SAMPLE_RATE);
+    filter.setCutoff(2000.0f);
+    benchEffect(bench, "Filter", input, [&](float x, double) { return filter.process(x); });
+
+    Chorus chorus;
+    chorus.setSampleRate(SAMPLE_RATE);
+    benchEffect(bench, "Chorus", input, [&](float x, double t) { return chorus.process(x, t); });
+
+    RingModulator ringMod;
+    benchEffect(bench, "RingModulator", input, [&](float x, double t) { return ringMod.process(x, t); });
+
+    Phaser phaser;
+    benchEffect(bench, "Phaser", input, [&](float x, double t) { return phaser.process(x, t); });
+
+    Reverb reverb;
+    reverb.setSampleRate(SAMPLE_RATE);
+    benchEffect(bench, "Reverb", input, [&](float x, double) { return reverb.process(x); });
+
+    Reverb stereoReverb;
+    stereoReverb.setSampleRate(SAMPLE_RATE);
+    benchEffect(bench, "Reverb.Stereo", input, [&](float x, double) {
+        auto [left, right] = stereoReverb.processStereo(x);
+        return left + right;
+    });
+
+    Reverb blockReverb;
+    blockReverb.setSampleRate(SAMPLE_RATE);
+    benchEffectBlock(bench, "Reverb.Block", input, [&](float* buffer, uint32_t count) {
+        blockReverb.processBlock(buffer, count);
+    });
+
+    StereoWidener widener;
+    widener.setSampleRate(SAMPLE_RATE);
+    benchEffect(bench, "StereoWidener", input, [&](float x, double) {
+        auto [left, right] = widener.process(x);
+        return left + right;
+    });
+
+    TapeSaturation tape;
+    tape.setSampleRate(SAMPLE_RATE);
+    benchEffect(bench, "TapeSaturation", input, [&](float x, double) { return tape.process(x); });
+
+    Sidechain sidechain;
+    sidechain.setSampleRate(SAMPLE_RATE);
+    benchEffect(bench, "Sidechain", input, [&](float x, double) {
+        sidechain.updateEnvelope(x);
+        return sidechain.process(x);
+    });
+
+    // Every effect in the chain enabled, in its own processing order
+    ChannelEffects allEffects;
+    allEffects.tapeSaturationEnabled = allEffects.bitcrusherEnabled = allEffects.distortionEnabled = true;
+    allEffects.filterEnabled = allEffects.ringModEnabled = allEffects.tremoloEnabled = true;
+    allEffects.phaserEnabled = allEffects.chorusEnabled = true;
+    allEffects.stereoWidenerEnabled = true;
+
+    EffectsChain chain;
+    chain.setSampleRate(SAMPLE_RATE);
+    chain.apply(allEffects);
+    benchEffect(bench, "EffectsChain.All", input, [&](float x, double t) {
+        auto [left, right] = chain.processStereo(x, t);
+        return left + right;
+    });
+
+    // The same mono chain a run at a time, as the synths call it
+    EffectsChain blockChain = chain;
+    double blockTime = 0.0;
+    benchEffectBlock(bench, "EffectsChain.Block", input, [&](float* buffer, uint32_t count) {
+        blockChain.processBlock(buffer, count, blockTime, 1.0 / SAMPLE_RATE);
+        blockTime += count * (1.0 / SAMPLE_RATE);
+    });
+
+    // Tanh distortion oversampled, at both filter qualities
+    const std::pair<const char*, OversampleQuality> qualities[] = {
+        {"Realtime", OversampleQuality::Realtime},
+        {"High", OversampleQuality::High},
+    };
+    const std::pair<const char*, Oversampling> factors[] = {
+        {"2x", Oversampling::X2}, {"4x", Oversampling::X4}, {"8x", Oversampling::X8},
+    };
+    for (const auto& [qualityName, quality] : qualities) {
+        for (const auto& [factorName, factor] : factors) {
+            Distortion oversampled;
+            oversampled.drive = 4.0f;
+            oversampled.oversampling = factor;
+            oversampled.setOversampleQuality(quality);
+            benchEffectBlock(bench, std::string("Distortion.Oversampled.") + factorName + "." + qualityName, input,
+                             [&](float* buffer, uint32_t count) { oversampled.processBlock(buffer, count); });
+        }
+    }
+}
+
+// ============================================================================
+// Sequencer - full engine rendering N concurrent arrangement clips
+// ============================================================================
+Project makeClipProject(int clipCount) {
+    // A 16-beat pattern per channel: 8th notes of the channel's instrument
+    const OscillatorType instruments[Project::MAX_CHANNELS] = {
+        OscillatorType::Pulse, OscillatorType::Triangle, OscillatorType::SynthLead,
+        OscillatorType::SynthwaveBass, OscillatorType::SynthPad, OscillatorType::Kick,
+        OscillatorType::Snare, OscillatorType::HiHat,
+    };
+
+    Project project;
+    project.patterns.clear();
+    for (int ch = 0; ch < Project::MAX_CHANNELS; ++ch) {
+        Pattern pattern;
+        pattern.name = "Bench " + std::to_string(ch);
+        for (int step = 0; step < 32; ++step) {
+            Note note;
+            note.pitch = 48 + (step * 5 + ch * 7) % 24;
+            note.startTime = step * 0.5f;
+            note.duration = 0.4f;
+            note.oscillatorType = instruments[ch];
+            pattern.notes.push_back(note);
+        }
+        pattern.touch();
+        project.patterns.push_back(pattern);
+    }
+
+    // Clips stack on the channels round robin, all playing at once
+    for (int i = 0; i < clipCount; ++i) {
+        Clip clip;
+        clip.channelIndex = i % Project::MAX_CHANNELS;
+        clip.patternIndex = clip.channelIndex;
+        clip.startBeat = 0.0f;
+        clip.lengthBeats = 16.0f;
+        project.arrangement.push_back(clip);
+    }
+    return project;
+}
+
+void benchSequencer(Bench& bench) {
+    const int clipCounts[] = {1, 8, 32};
+    const uint32_t frames = bench.framesPerRun();
+    constexpr uint32_t CALLBACK_FRAMES = 512;
+    std::vector<float> left(CALLBACK_FRAMES);
+    std::vector<float> right(CALLBACK_FRAMES);
+
+    for (int clips : clipCounts) {
+        if (!bench.selected("sequencer/process")) continue;
+
+        Project project = makeClipProject(clips);
+        Sequencer sequencer;
+        sequencer.setSampleRate(SAMPLE_RATE);
+        sequencer.setProject(&project);
+        sequencer.setLoop(true, 0.0f, 16.0f);
+        sequencer.play();
+
+        auto render = [&](uint32_t count) {
+            for (uint32_t done = 0; done < count; done += CALLBACK_FRAMES) {
+                const uint32_t n = std::min(CALLBACK_FRAMES, count - done);
+                sequencer.process(left.data(), right.data(), n);
+                g_sink = g_sink + left[0] + right[0];
+            }
+        };
+
+        render(CALLBACK_FRAMES * 16);  // Warm up
+        bench.measure({"sequencer", "process", {{"clips", clips}}, "frame"}, frames, [&] { render(frames); });
+    }
+}
+
+// ============================================================================
+// File I/O - project save/load and WAV writing
+// ============================================================================
+void benchFileIO(Bench& bench) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path();
+    const std::string projectPath = (dir / "chiptune-bench.ctp").string();
+    const std::string wavPath = (dir / "chiptune-bench.wav").string();
+
+    // 64 patterns of 256 notes each
+    Project project;
+    project.patterns.clear();
+    for (int p = 0; p < 64; ++p) {
+        Pattern pattern;
+        pattern.name = "Pattern " + std::to_string(p + 1);
+        for (int n = 0; n < 256; ++n) {
+            Note note;
+            note.pitch = 36 + (n * 7 + p) % 48;
+            note.startTime = n * 0.25f;
+            note.duration = 0.25f;
+            note.oscillatorType = static_cast<OscillatorType>((n + p) % OSCILLATOR_TYPE_COUNT);
+            pattern.notes.push_back(note);
+        }
+        project.patterns.push_back(pattern);
+    }
+    const uint64_t notes = 64 * 256;
+
+    if (bench.selected("fileio/saveProject")) {
+        bench.measure({"fileio", "saveProject", {}, "note"}, notes, [&] { saveProject(project, projectPath); });
+    }
+
+    if (bench.selected("fileio/loadProject")) {
+        saveProject(project, projectPath);
+        Project loaded;
+        bench.measure({"fileio", "loadProject", {}, "note"}, notes, [&] { loadProject(loaded, projectPath); });
+    }
+
+    const std::pair<const char*, SampleFormat> formats[] = {
+        {"WavWriter.Int16", SampleFormat::Int16},
+        {"WavWriter.Int24", SampleFormat::Int24},
+        {"WavWriter.Float32", SampleFormat::Float32},
+    };
+    const uint32_t frames = bench.framesPerRun();
+    const std::vector<float> signal = makeInputSignal(4096);
+    for (const auto& [name, format] : formats) {
+        if (!bench.selected(std::string("fileio/") + name)) continue;
+
+        bench.measure({"fileio", name, {}, "frame"}, frames, [&, format = format] {
+            WavWriter writer;
+            writer.open(wavPath, static_cast<uint32_t>(SAMPLE_RATE), format);
+            for (uint32_t done = 0; done < frames; done += 4096) {
+                writer.write(signal.data(), signal.data(), std::min<uint32_t>(4096, frames - done));
+            }
+            writer.close();
+        });
+    }
+
+    std::error_code error;
+    fs::remove(projectPath, error);
+    fs::remove(wavPath, error);
+}
+
+// ============================================================================
+// JSON Output
+// ============================================================================
+std::string jsonString(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+void writeJson(std::FILE* file, const Bench& bench) {
+#if defined(__clang__)
+    const std::string compiler = std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    const std::string compiler = std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    const std::string compiler = "msvc " + std::to_string(_MSC_VER);
+#else
+    const std::string compiler = "unknown";
+#endif
+
+    std::fprintf(file, "{\n");
+    std::fprintf(file, "  \"schema\": 1,\n");
+    std::fprintf(file, "  \"compiler\": %s,\n", jsonString(compiler).c_str());
+    std::fprintf(file, "  \"hardware_threads\": %u,\n", std::thread::hardware_concurrency());
+    std::fprintf(file, "  \"sample_rate\": %.0f,\n", SAMPLE_RATE);
+    std::fprintf(file, "  \"repetitions\": %d,\n", bench.options().repetitions);
+    std::fprintf(file, "  \"results\": [\n");
+
+    const auto& results = bench.results();
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        std::string id = r.group + "/" + r.name;
+        std::string params;
+        for (const auto& [key, value] : r.params) {
+            id += "/" + key + "=" + std::to_string(value);
+            params += ", " + jsonString(key) + ": " + std::to_string(value);
+        }
+
+        char speedup[48] = "";
+        if (r.speedup > 0.0) std::snprintf(speedup, sizeof(speedup), ", \"speedup\": %.3f", r.speedup);
+
+        std::fprintf(file,
+                     "    {\"id\": %s, \"group\": %s, \"name\": %s%s, \"unit\": %s, "
+                     "\"ns_per_unit\": %.3f, \"ns_per_unit_min\": %.3f, \"units_per_run\": %llu%s}%s\n",
+                     jsonString(id).c_str(), jsonString(r.group).c_str(), jsonString(r.name).c_str(),
+                     params.c_str(), jsonString(r.unit).c_str(), r.median, r.fastest,
+                     static_cast<unsigned long long>(r.unitsPerRun), speedup,
+                     i + 1 < results.size() ? "," : "");
+    }
+
+    std::fprintf(file, "  ]\n}\n");
+}
+
+void printUsage(const char* program) {
+    std::printf(
+        "Usage: %s [options]\n"
+        "\n"
+        "Options:\n"
+        "  --output <file>      Write JSON here instead of stdout\n"
+        "  --filter <text>      Only run benchmarks whose id contains text\n"
+        "                       (e.g. math/fastTanh, oscillator/Kick, effect/, sequencer, fileio)\n"
+        "  --repetitions <n>    Runs per benchmark (default: 5)\n"
+        "  --seconds <s>        Audio per run (default: 2)\n"
+        "  --quick              Same as --repetitions 3 --seconds 0.25\n",
+        program);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--output") == 0 && hasValue) {
+            options.outputPath = argv[++i];
+        } else if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--repetitions") == 0 && hasValue) {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--seconds") == 0 && hasValue) {
+            options.seconds = std::max(0.01, std::atof(argv[++i]));
+        } else if (std::strcmp(arg, "--quick") == 0) {
+            options.repetitions = 3;
+            options.seconds = 0.25;
+        } else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    Bench bench(options);
+    benchMath(bench);
+    benchOscillators(bench);
+    benchModulation(bench);
+    benchEffects(bench);
+    benchSequencer(bench);
+    benchFileIO(bench);
+
+    std::FILE* file = stdout;
+    if (!options.outputPath.empty()) {
+        file = std::fopen(options.outputPath.c_str(), "w");
+        if (!file) {
+            std::fprintf(stderr, "Cannot write %s\n", options.outputPath.c_str());
+            return 1;
+        }
+    }
+    writeJson(file, bench);
+    if (file != stdout) std::fclose(file);
+    return 0;
+}
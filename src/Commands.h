@@ -0,0 +1,98 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Commands
+ *
+ * Typed, timestamped commands sent from the UI thread to the audio
+ * thread through a LockFreeRingBuffer. Everything a command carries is
+ * trivially copyable, so queueing one never allocates.
+ */
+
+#include "Types.h"
+#include <cstdint>
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// Audio Commands (UI -> Audio Thread)
+// ============================================================================
+enum class AudioCommandType : uint8_t {
+    SetFrequency,
+    SetVolume,
+    SetWaveform,
+    NoteOn,
+    NoteOff,
+
+    // Sequencer transport
+    Play,
+    Pause,
+    Stop,
+    SetPosition,
+    SetLoop,
+    SetLoopEnabled,
+
+    // Sequencer voices and channels
+    PreviewNote,
+    SetChannelConfig,
+    SetSynthConfig,
+    SetOversampleQuality
+};
+
+enum class WaveformType : uint8_t {
+    Sine,       // For testing
+    Square,     // NES Pulse (will add PolyBLEP)
+    Triangle,   // NES Triangle
+    Sawtooth,   // PolyBLEP corrected
+    Noise       // LFSR
+};
+
+// Note on/off for a sequencer channel (or the preview channel)
+struct NoteCommand {
+    uint8_t channel;
+    uint8_t note;
+    float velocity;
+    OscillatorType oscillatorType;
+    float durationSec;
+};
+
+struct LoopCommand {
+    bool enabled;
+    float start;
+    float end;
+};
+
+// The parts of a ChannelConfig the channel's synth uses
+struct ChannelSynthConfig {
+    uint8_t channel;
+    OscillatorConfig oscillator;
+    Envelope envelope;
+    ChannelEffects effects;
+};
+
+struct SynthConfigCommand {
+    uint8_t channel;
+    OscillatorConfig oscillator;
+    Envelope envelope;
+};
+
+struct AudioCommand {
+    AudioCommandType type = AudioCommandType::Play;
+    int64_t frame = 0;      // Engine frame to apply at (past frames: start of next block)
+    union Data {
+        Data() : frequency(0.0f) {}
+
+        float    frequency;
+        float    volume;
+        WaveformType waveform;
+        uint8_t  note;
+        float    beat;
+        bool     enabled;
+        NoteCommand noteEvent;
+        LoopCommand loop;
+        ChannelSynthConfig channelConfig;
+        SynthConfigCommand synthConfig;
+        OversampleQuality oversampleQuality;
+    } data;
+};
+
+} // namespace ChiptuneTracker
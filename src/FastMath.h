@@ -0,0 +1,287 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Fast Math
+ *
+ * Approximations of the transcendental functions the render path calls
+ * per sample: sine/cosine, exp/exp2, tanh and semitone ratios. Each comes
+ * as a scalar and a SimdFloat version, at one of three precision tiers:
+ *
+ *   Exact   the standard library (reference; bit-identical to std::)
+ *   High    minimax polynomials                      (default)
+ *   Fast    lookup tables and lower-order polynomials
+ *
+ * The tier is chosen at build time with CHIPTUNE_MATH_PRECISION (0, 1 or
+ * 2; CMake option of the same name), or per call as a template argument,
+ * e.g. fastSin<MathPrecision::Fast>(x).
+ *
+ * Maximum errors, measured against double precision over the ranges the
+ * engine uses (|sin argument| < 1e4 turns, exp2 input in [-125, 126]):
+ *
+ *   function        High                        Fast
+ *   fastSinTurns    2.0e-7 abs                  1.9e-5 abs (SIMD 6.8e-5)
+ *   fastExp2        1.8e-7 rel                  1.0e-4 rel
+ *   fastTanh        2.0e-7 abs (SIMD 4.2e-7)    5.2e-5 abs
+ *
+ * fastSin/fastCos (radians), fastExp and semitonesToRatio add the rounding
+ * of their argument scaling (x / 2pi, x * log2 e, x / 12) on top.
+ *
+ * Arguments beyond +/-2^31 turns (sine) are not range reduced correctly;
+ * exp2 saturates outside [-125, 126] (results stay normal floats).
+ */
+
+#include "Simd.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+#ifndef CHIPTUNE_MATH_PRECISION
+#define CHIPTUNE_MATH_PRECISION 1
+#endif
+
+namespace ChiptuneTracker {
+
+enum class MathPrecision : uint8_t {
+    Exact,
+    High,
+    Fast
+};
+
+constexpr MathPrecision MATH_PRECISION = static_cast<MathPrecision>(CHIPTUNE_MATH_PRECISION);
+
+// Same value as Effects.h TWO_PI, so the Exact tier matches std:: calls
+constexpr float MATH_TWO_PI = 6.28318530718f;
+constexpr float MATH_INV_TWO_PI = 0.159154943092f;
+constexpr float MATH_LOG2_E = 1.44269504089f;
+
+// ============================================================================
+// Coefficients (minimax, fitted offline)
+// ============================================================================
+// sin(2*pi*r) = r * P(r^2) for r in [-1/4, 1/4]
+constexpr float SIN_HIGH[5] = {6.28318516f, -41.3416550f, 81.6010040f, -76.5497799f, 39.5366864f};
+constexpr float SIN_FAST[3] = {6.28128000f, -41.0952359f, 73.5854054f};
+
+// 2^f for f in [0, 1], relative error, with 2^0 = 1 and 2^1 = 2 exact (so
+// zero offsets give unit ratios and integer steps stay continuous)
+constexpr float EXP2_HIGH[6] = {1.0f, 0.693151739f, 0.240159271f,
+                                0.0558186756f, 0.00899099565f, 0.00187931837f};
+constexpr float EXP2_FAST[4] = {1.0f, 0.695424347f, 0.226307685f, 0.0782679678f};
+
+// ============================================================================
+// Compile-Time Tables
+// ============================================================================
+// sin(2*pi*t) in double precision, for building tables at compile time
+constexpr double constexprSinTurns(double t) {
+    t -= static_cast<double>(static_cast<int64_t>(t));     // (-1, 1)
+    if (t > 0.5) t -= 1.0;
+    if (t < -0.5) t += 1.0;
+    if (t > 0.25) t = 0.5 - t;
+    if (t < -0.25) t = -0.5 - t;
+
+    const double x = t * 6.283185307179586;
+    const double x2 = x * x;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 12; ++n) {
+        term *= -x2 / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+// 2^x in double precision, for building tables at compile time
+constexpr double constexprExp2(double x) {
+    int64_t whole = static_cast<int64_t>(x);
+    if (static_cast<double>(whole) > x) --whole;           // floor
+    const double y = (x - static_cast<double>(whole)) * 0.6931471805599453;
+
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 20; ++n) {
+        term *= y / n;
+        sum += term;
+    }
+    for (; whole > 0; --whole) sum *= 2.0;
+    for (; whole < 0; ++whole) sum *= 0.5;
+    return sum;
+}
+
+// One sine cycle plus a guard sample, for the Fast tier's scalar sine
+constexpr int SINE_TABLE_SIZE = 512;
+
+inline constexpr std::array<float, SINE_TABLE_SIZE + 1> SINE_TABLE = [] {
+    std::array<float, SINE_TABLE_SIZE + 1> table{};
+    for (int i = 0; i <= SINE_TABLE_SIZE; ++i) {
+        table[i] = static_cast<float>(constexprSinTurns(static_cast<double>(i) / SINE_TABLE_SIZE));
+    }
+    return table;
+}();
+
+// ============================================================================
+// Helpers
+// ============================================================================
+// floor() without a library call (|x| < 2^31)
+inline float mathFloor(float x) {
+    const float t = static_cast<float>(static_cast<int32_t>(x));
+    return t > x ? t - 1.0f : t;
+}
+
+// 2^n for integer n in [-126, 127]
+inline float mathExp2i(int32_t n) {
+    return std::bit_cast<float>(static_cast<uint32_t>(n + 127) << 23);
+}
+
+// Apply a scalar function to every lane (Exact tier)
+template <typename Fn>
+inline SimdFloat mathPerLane(SimdFloat x, Fn&& fn) {
+    alignas(32) float lanes[SIMD_LANES];
+    x.store(lanes);
+    for (float& lane : lanes) lane = fn(lane);
+    return SimdFloat::load(lanes);
+}
+
+// ============================================================================
+// Sine / Cosine
+// ============================================================================
+// sin(2*pi*turns) - the natural form for oscillator phases
+template <MathPrecision P = MATH_PRECISION>
+inline float fastSinTurns(float turns) {
+    if constexpr (P == MathPrecision::Exact) {
+        return std::sin(turns * MATH_TWO_PI);
+    } else if constexpr (P == MathPrecision::Fast) {
+        const float pos = (turns - mathFloor(turns)) * SINE_TABLE_SIZE;
+        const int i = std::min(static_cast<int>(pos), SINE_TABLE_SIZE - 1);
+        const float frac = pos - static_cast<float>(i);
+        return SINE_TABLE[i] + (SINE_TABLE[i + 1] - SINE_TABLE[i]) * frac;
+    } else {
+        // Nearest half turn k: sin(2*pi*turns) = (-1)^k * sin(2*pi*r), r in [-1/4, 1/4].
+        // (No folding around r = 1/4, which fast-math would reassociate.)
+        const float half = turns * 2.0f;
+        const int32_t k = static_cast<int32_t>(half + (half < 0.0f ? -0.5f : 0.5f));
+        const float r = (half - static_cast<float>(k)) * 0.5f;
+        const float r2 = r * r;
+        const float s = r * (SIN_HIGH[0] + r2 * (SIN_HIGH[1] + r2 * (SIN_HIGH[2] + r2 * (SIN_HIGH[3] + r2 * SIN_HIGH[4]))));
+        return std::bit_cast<float>(std::bit_cast<uint32_t>(s) ^ (static_cast<uint32_t>(k) << 31));
+    }
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline SimdFloat fastSinTurns(SimdFloat turns) {
+    if constexpr (P == MathPrecision::Exact) {
+        return mathPerLane(turns, [](float t) { return std::sin(t * MATH_TWO_PI); });
+    } else {
+        // As the scalar version; the sign of odd half turns is applied as a factor
+        const SimdFloat half = turns * 2.0f;
+        const SimdFloat k = simdFloor(half + 0.5f);
+        const SimdFloat r = (half - k) * 0.5f;
+        const SimdFloat sign = SimdFloat(1.0f) - (k - simdFloor(k * 0.5f) * 2.0f) * 2.0f;
+        const SimdFloat r2 = r * r;
+        if constexpr (P == MathPrecision::Fast) {
+            return sign * r * (SimdFloat(SIN_FAST[0]) + r2 * (SimdFloat(SIN_FAST[1]) + r2 * SIN_FAST[2]));
+        } else {
+            return sign * r * (SimdFloat(SIN_HIGH[0]) + r2 * (SimdFloat(SIN_HIGH[1]) + r2 * (SimdFloat(SIN_HIGH[2]) +
+                               r2 * (SimdFloat(SIN_HIGH[3]) + r2 * SIN_HIGH[4]))));
+        }
+    }
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline float fastSin(float x) {
+    if constexpr (P == MathPrecision::Exact) return std::sin(x);
+    else return fastSinTurns<P>(x * MATH_INV_TWO_PI);
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline float fastCos(float x) {
+    if constexpr (P == MathPrecision::Exact) return std::cos(x);
+    else return fastSinTurns<P>(x * MATH_INV_TWO_PI + 0.25f);
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline SimdFloat fastSin(SimdFloat x) {
+    if constexpr (P == MathPrecision::Exact) return mathPerLane(x, [](float v) { return std::sin(v); });
+    else return fastSinTurns<P>(x * MATH_INV_TWO_PI);
+}
+
+// ============================================================================
+// Exponentials
+// ============================================================================
+template <MathPrecision P = MATH_PRECISION>
+inline float fastExp2(float x) {
+    if constexpr (P == MathPrecision::Exact) {
+        return std::pow(2.0f, x);
+    } else {
+        x = std::clamp(x, -125.0f, 126.0f);
+        const float n = mathFloor(x);
+        const float f = x - n;
+        float p;
+        if constexpr (P == MathPrecision::Fast) {
+            p = EXP2_FAST[0] + f * (EXP2_FAST[1] + f * (EXP2_FAST[2] + f * EXP2_FAST[3]));
+        } else {
+            p = EXP2_HIGH[0] + f * (EXP2_HIGH[1] + f * (EXP2_HIGH[2] + f * (EXP2_HIGH[3] +
+                f * (EXP2_HIGH[4] + f * EXP2_HIGH[5]))));
+        }
+        return p * mathExp2i(static_cast<int32_t>(n));
+    }
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline SimdFloat fastExp2(SimdFloat x) {
+    if constexpr (P == MathPrecision::Exact) {
+        return mathPerLane(x, [](float v) { return std::pow(2.0f, v); });
+    } else {
+        x = simdMin(simdMax(x, -125.0f), 126.0f);
+        const SimdFloat n = simdFloor(x);
+        const SimdFloat f = x - n;
+        SimdFloat p;
+        if constexpr (P == MathPrecision::Fast) {
+            p = SimdFloat(EXP2_FAST[0]) + f * (SimdFloat(EXP2_FAST[1]) + f * (SimdFloat(EXP2_FAST[2]) + f * EXP2_FAST[3]));
+        } else {
+            p = SimdFloat(EXP2_HIGH[0]) + f * (SimdFloat(EXP2_HIGH[1]) + f * (SimdFloat(EXP2_HIGH[2]) +
+                f * (SimdFloat(EXP2_HIGH[3]) + f * (SimdFloat(EXP2_HIGH[4]) + f * EXP2_HIGH[5]))));
+        }
+        return p * simdExp2i(n);
+    }
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline float fastExp(float x) {
+    if constexpr (P == MathPrecision::Exact) return std::exp(x);
+    else return fastExp2<P>(x * MATH_LOG2_E);
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline SimdFloat fastExp(SimdFloat x) {
+    if constexpr (P == MathPrecision::Exact) return mathPerLane(x, [](float v) { return std::exp(v); });
+    else return fastExp2<P>(x * MATH_LOG2_E);
+}
+
+// Frequency ratio of a pitch offset: 2^(semitones / 12)
+template <MathPrecision P = MATH_PRECISION>
+inline float semitonesToRatio(float semitones) {
+    if constexpr (P == MathPrecision::Exact) return std::pow(2.0f, semitones / 12.0f);
+    else return fastExp2<P>(semitones * (1.0f / 12.0f));
+}
+
+// ============================================================================
+// Hyperbolic Tangent
+// ============================================================================
+// 1 - 2 / (e^2x + 1): saturates cleanly to +/-1 as exp2 clamps
+template <MathPrecision P = MATH_PRECISION>
+inline float fastTanh(float x) {
+    if constexpr (P == MathPrecision::Exact) return std::tanh(x);
+    else return 1.0f - 2.0f / (fastExp2<P>(x * (2.0f * MATH_LOG2_E)) + 1.0f);
+}
+
+template <MathPrecision P = MATH_PRECISION>
+inline SimdFloat fastTanh(SimdFloat x) {
+    if constexpr (P == MathPrecision::Exact) {
+        return mathPerLane(x, [](float v) { return std::tanh(v); });
+    } else {
+        return SimdFloat(1.0f) - SimdFloat(2.0f) / (fastExp2<P>(x * (2.0f * MATH_LOG2_E)) + 1.0f);
+    }
+}
+
+} // namespace ChiptuneTracker
@@ -0,0 +1,82 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - File Dialogs
+ *
+ * Native open/save dialogs for the editor. Kept apart from FileIO.h so
+ * the engine and the headless renderer do not depend on Win32.
+ */
+
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <commdlg.h>
+#endif
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// Windows File Dialogs
+// ============================================================================
+
+#ifdef _WIN32
+
+inline std::string openFileDialog(const char* filter, const char* defaultExt) {
+    char filename[MAX_PATH] = "";
+
+    OPENFILENAMEA ofn;
+    ZeroMemory(&ofn, sizeof(ofn));
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = NULL;
+    ofn.lpstrFilter = filter;
+    ofn.lpstrFile = filename;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.lpstrDefExt = defaultExt;
+    ofn.Flags = OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST;
+
+    if (GetOpenFileNameA(&ofn)) {
+        return std::string(filename);
+    }
+    return "";
+}
+
+inline std::string saveFileDialog(const char* filter, const char* defaultExt) {
+    char filename[MAX_PATH] = "";
+
+    OPENFILENAMEA ofn;
+    ZeroMemory(&ofn, sizeof(ofn));
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = NULL;
+    ofn.lpstrFilter = filter;
+    ofn.lpstrFile = filename;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.lpstrDefExt = defaultExt;
+    ofn.Flags = OFN_OVERWRITEPROMPT;
+
+    if (GetSaveFileNameA(&ofn)) {
+        return std::string(filename);
+    }
+    return "";
+}
+
+#else
+
+// Fallback for non-Windows (just use hardcoded paths for now)
+inline std::string openFileDialog(const char*, const char*) {
+    return "";
+}
+
+inline std::string saveFileDialog(const char*, const char*) {
+    return "";
+}
+
+#endif
+
+} // namespace ChiptuneTracker
@@ -3,22 +3,22 @@
 /*
  * ChiptuneTracker - File I/O and Audio Export
  *
- * Handles saving/loading projects and exporting audio
+ * Handles saving/loading projects and exporting audio. Has no UI or
+ * platform dependencies, so it builds into the headless renderer too;
+ * the editor's file dialogs live in FileDialogs.h.
  */
 
 #include "Types.h"
 #include "Sequencer.h"
+#include "WavWriter.h"
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 #include <cstring>
-
-// Windows file dialogs
-#ifdef _WIN32
-#include <windows.h>
-#include <commdlg.h>
-#include <shlobj.h>
-#endif
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
 
 namespace ChiptuneTracker {
 
@@ -33,6 +33,7 @@ inline std::string oscillatorTypeToString(OscillatorType type) {
         case OscillatorType::Sawtooth: return "Sawtooth";
         case OscillatorType::Sine: return "Sine";
         case OscillatorType::Noise: return "Noise";
+        case OscillatorType::Supersaw: return "Supersaw";
         case OscillatorType::Custom: return "Custom";
         // Synths
         case OscillatorType::SynthLead: return "SynthLead";
@@ -67,6 +68,36 @@ inline std::string oscillatorTypeToString(OscillatorType type) {
         case OscillatorType::Conga: return "Conga";
         case OscillatorType::Maracas: return "Maracas";
         case OscillatorType::Tambourine: return "Tambourine";
+        // Synthwave
+        case OscillatorType::SynthwaveLead: return "SynthwaveLead";
+        case OscillatorType::SynthwaveBass: return "SynthwaveBass";
+        case OscillatorType::SynthwavePad: return "SynthwavePad";
+        case OscillatorType::SynthwaveArp: return "SynthwaveArp";
+        case OscillatorType::SynthwaveChord: return "SynthwaveChord";
+        case OscillatorType::SynthwaveFM: return "SynthwaveFM";
+        // Techno/Electronic
+        case OscillatorType::AcidBass: return "AcidBass";
+        case OscillatorType::TechnoStab: return "TechnoStab";
+        case OscillatorType::Hoover: return "Hoover";
+        case OscillatorType::RaveChord: return "RaveChord";
+        case OscillatorType::Reese: return "Reese";
+        // Hip Hop
+        case OscillatorType::SubBass808: return "SubBass808";
+        case OscillatorType::LoFiKeys: return "LoFiKeys";
+        case OscillatorType::VinylNoise: return "VinylNoise";
+        case OscillatorType::TrapLead: return "TrapLead";
+        // Additional Synthwave
+        case OscillatorType::GatedPad: return "GatedPad";
+        case OscillatorType::PolySynth: return "PolySynth";
+        case OscillatorType::SyncLead: return "SyncLead";
+        // Reggaeton
+        case OscillatorType::ReggaetonBass: return "ReggaetonBass";
+        case OscillatorType::LatinBrass: return "LatinBrass";
+        case OscillatorType::Guira: return "Guira";
+        case OscillatorType::Bongo: return "Bongo";
+        case OscillatorType::Timbale: return "Timbale";
+        case OscillatorType::Dembow808: return "Dembow808";
+        case OscillatorType::DembowSnare: return "DembowSnare";
         default: return "Pulse";
     }
 }
@@ -77,6 +108,7 @@ inline OscillatorType stringToOscillatorType(const std::string& str) {
     if (str == "Sawtooth") return OscillatorType::Sawtooth;
     if (str == "Sine") return OscillatorType::Sine;
     if (str == "Noise") return OscillatorType::Noise;
+    if (str == "Supersaw") return OscillatorType::Supersaw;
     if (str == "Custom") return OscillatorType::Custom;
     // Synths
     if (str == "SynthLead") return OscillatorType::SynthLead;
@@ -111,6 +143,31 @@ inline OscillatorType stringToOscillatorType(const std::string& str) {
     if (str == "Conga") return OscillatorType::Conga;
     if (str == "Maracas") return OscillatorType::Maracas;
     if (str == "Tambourine") return OscillatorType::Tambourine;
+    if (str == "SynthwaveLead") return OscillatorType::SynthwaveLead;
+    if (str == "SynthwaveBass") return OscillatorType::SynthwaveBass;
+    if (str == "SynthwavePad") return OscillatorType::SynthwavePad;
+    if (str == "SynthwaveArp") return OscillatorType::SynthwaveArp;
+    if (str == "SynthwaveChord") return OscillatorType::SynthwaveChord;
+    if (str == "SynthwaveFM") return OscillatorType::SynthwaveFM;
+    if (str == "AcidBass") return OscillatorType::AcidBass;
+    if (str == "TechnoStab") return OscillatorType::TechnoStab;
+    if (str == "Hoover") return OscillatorType::Hoover;
+    if (str == "RaveChord") return OscillatorType::RaveChord;
+    if (str == "Reese") return OscillatorType::Reese;
+    if (str == "SubBass808") return OscillatorType::SubBass808;
+    if (str == "LoFiKeys") return OscillatorType::LoFiKeys;
+    if (str == "VinylNoise") return OscillatorType::VinylNoise;
+    if (str == "TrapLead") return OscillatorType::TrapLead;
+    if (str == "GatedPad") return OscillatorType::GatedPad;
+    if (str == "PolySynth") return OscillatorType::PolySynth;
+    if (str == "SyncLead") return OscillatorType::SyncLead;
+    if (str == "ReggaetonBass") return OscillatorType::ReggaetonBass;
+    if (str == "LatinBrass") return OscillatorType::LatinBrass;
+    if (str == "Guira") return OscillatorType::Guira;
+    if (str == "Bongo") return OscillatorType::Bongo;
+    if (str == "Timbale") return OscillatorType::Timbale;
+    if (str == "Dembow808") return OscillatorType::Dembow808;
+    if (str == "DembowSnare") return OscillatorType::DembowSnare;
     return OscillatorType::Pulse;
 }
 
@@ -124,6 +181,11 @@ inline bool saveProject(const Project& project, const std::string& filepath) {
     file << "BPM " << project.bpm << "\n";
     file << "BEATS_PER_MEASURE " << project.beatsPerMeasure << "\n";
     file << "MASTER_VOLUME " << project.masterVolume << "\n";
+    file << "MASTER_OVERSAMPLING " << static_cast<int>(project.masterOversampling) << "\n";
+    file << "AUX_REVERB " << project.aux.reverbRoomSize << " " << project.aux.reverbDamping << " "
+         << project.aux.reverbReturn << "\n";
+    file << "AUX_DELAY " << project.aux.delayTime << " " << project.aux.delayFeedback << " "
+         << project.aux.delayReturn << "\n";
     file << "SONG_LENGTH " << project.songLength << "\n";
     file << "\n";
 
@@ -165,8 +227,10 @@ inline bool loadProject(Project& project, const std::string& filepath) {
         return false;
     }
 
-    // Clear existing patterns
+    // Clear existing patterns; aux buses not in the file (older versions)
+    // keep their defaults
     project.patterns.clear();
+    project.aux = AuxBusConfig();
 
     Pattern* currentPattern = nullptr;
 
@@ -189,6 +253,25 @@ inline bool loadProject(Project& project, const std::string& filepath) {
         else if (cmd == "MASTER_VOLUME") {
             iss >> project.masterVolume;
         }
+        else if (cmd == "MASTER_OVERSAMPLING") {
+            int factor = 0;
+            iss >> factor;
+            project.masterOversampling = static_cast<Oversampling>(std::clamp(factor, 0, 3));
+        }
+        else if (cmd == "AUX_REVERB") {
+            AuxBusConfig& aux = project.aux;
+            iss >> aux.reverbRoomSize >> aux.reverbDamping >> aux.reverbReturn;
+            aux.reverbRoomSize = std::clamp(aux.reverbRoomSize, 0.1f, 1.0f);
+            aux.reverbDamping = std::clamp(aux.reverbDamping, 0.0f, 1.0f);
+            aux.reverbReturn = std::clamp(aux.reverbReturn, 0.0f, 1.0f);
+        }
+        else if (cmd == "AUX_DELAY") {
+            AuxBusConfig& aux = project.aux;
+            iss >> aux.delayTime >> aux.delayFeedback >> aux.delayReturn;
+            aux.delayTime = std::clamp(aux.delayTime, 0.01f, 1.0f);
+            aux.delayFeedback = std::clamp(aux.delayFeedback, 0.0f, 0.95f);
+            aux.delayReturn = std::clamp(aux.delayReturn, 0.0f, 1.0f);
+        }
         else if (cmd == "SONG_LENGTH") {
             iss >> project.songLength;
         }
@@ -234,6 +317,10 @@ inline bool loadProject(Project& project, const std::string& filepath) {
         project.patterns[0].name = "Pattern 1";
     }
 
+    for (Pattern& pattern : project.patterns) {
+        pattern.touch();
+    }
+
     file.close();
     return true;
 }
@@ -242,201 +329,188 @@ inline bool loadProject(Project& project, const std::string& filepath) {
 // WAV Export
 // ============================================================================
 
-#pragma pack(push, 1)
-struct WavHeader {
-    char riff[4] = {'R', 'I', 'F', 'F'};
-    uint32_t fileSize;
-    char wave[4] = {'W', 'A', 'V', 'E'};
-    char fmt[4] = {'f', 'm', 't', ' '};
-    uint32_t fmtSize = 16;
-    uint16_t audioFormat = 1;  // PCM
-    uint16_t numChannels = 2;  // Stereo
-    uint32_t sampleRate = 44100;
-    uint32_t byteRate;
-    uint16_t blockAlign;
-    uint16_t bitsPerSample = 16;
-    char data[4] = {'d', 'a', 't', 'a'};
-    uint32_t dataSize;
-};
-#pragma pack(pop)
-
-// Render project to audio buffer
-inline bool renderToBuffer(Project& project, Sequencer& seq,
-                           std::vector<float>& leftBuffer,
-                           std::vector<float>& rightBuffer,
-                           float durationBeats) {
+// Frames renderProject() produces for durationBeats: the song plus a
+// second for release tails
+inline size_t renderLengthFrames(const Project& project, float durationBeats) {
     float sampleRate = 44100.0f;
-    float bpm = project.bpm;
-    float durationSeconds = durationBeats * 60.0f / bpm;
-    size_t totalSamples = static_cast<size_t>(durationSeconds * sampleRate) + 44100; // Extra second for release
+    float durationSeconds = durationBeats * 60.0f / project.bpm;
+    return static_cast<size_t>(durationSeconds * sampleRate) + 44100; // Extra second for release
+}
+
+// Beats worth rendering: to the end of the last arrangement clip, or to
+// the end of the given pattern (plus a beat, at least 4) with no clips
+inline float projectLengthBeats(const Project& project, int patternIndex = 0) {
+    float maxEnd = 0.0f;
+    if (!project.arrangement.empty()) {
+        for (const Clip& clip : project.arrangement) {
+            maxEnd = std::max(maxEnd, clip.startBeat + clip.lengthBeats);
+        }
+        return maxEnd;
+    }
 
-    leftBuffer.resize(totalSamples);
-    rightBuffer.resize(totalSamples);
+    if (patternIndex >= 0 && patternIndex < static_cast<int>(project.patterns.size())) {
+        for (const Note& n : project.patterns[patternIndex].notes) {
+            maxEnd = std::max(maxEnd, n.startTime + n.duration);
+        }
+    }
+    return std::max(4.0f, maxEnd + 1.0f);
+}
 
-    // Reset sequencer
+// An offline sequencer that plays 'project' the way 'live' plays its own
+// (same preview pattern, loop and voice count). The editor exports through
+// one of these on a copy of the project: the live sequencer belongs to the
+// audio device's callback and is never driven from another thread.
+inline std::unique_ptr<Sequencer> makeExportSequencer(const Sequencer& live, Project& project) {
+    auto sequencer = std::make_unique<Sequencer>();
+    sequencer->setSampleRate(44100.0f);
+    sequencer->setRenderThreads(0, RenderMode::Offline);
+    sequencer->setVoicePoolSize(live.voicePoolSize());
+    if (live.previewPattern() >= 0) {
+        sequencer->setPreviewPattern(live.previewPattern(), live.previewChannel());
+    }
+    sequencer->setProject(&project);
+
+    const PlaybackState state = live.getState();
+    sequencer->setLoop(state.loop, state.loopStart, state.loopEnd);
+    return sequencer;
+}
+
+// Render the project block by block from the start, handing each block
+// to sink(left, right, frameCount). Renders durationBeats plus a second
+// for release tails.
+template <typename Sink>
+inline void renderProject(Project& project, Sequencer& seq, float durationBeats, Sink&& sink) {
+    size_t totalSamples = renderLengthFrames(project, durationBeats);
+
+    // Reset sequencer, with the long oversampling filters for the render
+    seq.setOversampleQuality(OversampleQuality::High);
+    seq.publishProject();
     seq.stop();
     seq.setPosition(0.0f);
     seq.play();
 
     // Render in chunks
-    const uint32_t chunkSize = 512;
+    constexpr uint32_t chunkSize = 4096;
     std::vector<float> tempLeft(chunkSize);
     std::vector<float> tempRight(chunkSize);
 
     size_t samplesRendered = 0;
     while (samplesRendered < totalSamples) {
-        uint32_t samplesToRender = std::min(chunkSize, static_cast<uint32_t>(totalSamples - samplesRendered));
+        uint32_t samplesToRender = static_cast<uint32_t>(std::min<size_t>(chunkSize, totalSamples - samplesRendered));
 
         seq.process(tempLeft.data(), tempRight.data(), samplesToRender);
-
-        for (uint32_t i = 0; i < samplesToRender; ++i) {
-            leftBuffer[samplesRendered + i] = tempLeft[i];
-            rightBuffer[samplesRendered + i] = tempRight[i];
-        }
+        if (!sink(tempLeft.data(), tempRight.data(), samplesToRender)) break;
 
         samplesRendered += samplesToRender;
     }
 
     seq.stop();
-    return true;
+    seq.setOversampleQuality(OversampleQuality::Realtime);
 }
 
-// Export to WAV file
-inline bool exportWav(Project& project, Sequencer& seq, const std::string& filepath, float durationBeats) {
-    std::vector<float> leftBuffer, rightBuffer;
-
-    if (!renderToBuffer(project, seq, leftBuffer, rightBuffer, durationBeats)) {
-        return false;
-    }
-
-    std::ofstream file(filepath, std::ios::binary);
-    if (!file.is_open()) return false;
-
-    size_t numSamples = leftBuffer.size();
-
-    WavHeader header;
-    header.numChannels = 2;
-    header.sampleRate = 44100;
-    header.bitsPerSample = 16;
-    header.blockAlign = header.numChannels * header.bitsPerSample / 8;
-    header.byteRate = header.sampleRate * header.blockAlign;
-    header.dataSize = static_cast<uint32_t>(numSamples * header.blockAlign);
-    header.fileSize = 36 + header.dataSize;
-
-    file.write(reinterpret_cast<char*>(&header), sizeof(header));
-
-    // Write interleaved 16-bit samples
-    for (size_t i = 0; i < numSamples; ++i) {
-        // Clamp and convert to 16-bit
-        float l = std::max(-1.0f, std::min(1.0f, leftBuffer[i]));
-        float r = std::max(-1.0f, std::min(1.0f, rightBuffer[i]));
+// Render project to audio buffer
+inline bool renderToBuffer(Project& project, Sequencer& seq,
+                           std::vector<float>& leftBuffer,
+                           std::vector<float>& rightBuffer,
+                           float durationBeats) {
+    leftBuffer.clear();
+    rightBuffer.clear();
+
+    renderProject(project, seq, durationBeats,
+        [&](const float* left, const float* right, uint32_t frameCount) {
+            leftBuffer.insert(leftBuffer.end(), left, left + frameCount);
+            rightBuffer.insert(rightBuffer.end(), right, right + frameCount);
+            return true;
+        });
+    return true;
+}
 
-        int16_t left16 = static_cast<int16_t>(l * 32767.0f);
-        int16_t right16 = static_cast<int16_t>(r * 32767.0f);
+// Export to WAV file (streamed, so memory use does not grow with length)
+inline bool exportWav(Project& project, Sequencer& seq, const std::string& filepath, float durationBeats,
+                      SampleFormat format = SampleFormat::Int16) {
+    WavWriter writer;
+    if (!writer.open(filepath, 44100, format)) return false;
 
-        file.write(reinterpret_cast<char*>(&left16), sizeof(int16_t));
-        file.write(reinterpret_cast<char*>(&right16), sizeof(int16_t));
-    }
+    bool ok = true;
+    renderProject(project, seq, durationBeats,
+        [&](const float* left, const float* right, uint32_t frameCount) {
+            ok = writer.write(left, right, frameCount);
+            return ok;
+        });
 
-    file.close();
-    return true;
+    return writer.close() && ok;
 }
 
 // ============================================================================
 // MP3 Export (uses LAME encoder)
 // ============================================================================
 
-// Check if LAME is available on the system
-inline bool isLameAvailable() {
+// True if an executable with this name is in a PATH directory
+inline bool isOnPath(const std::string& program) {
+    const char* path = std::getenv("PATH");
+    if (!path) return false;
+
 #ifdef _WIN32
-    // Try to find lame.exe in PATH
-    char buffer[MAX_PATH];
-    DWORD result = SearchPathA(NULL, "lame.exe", NULL, MAX_PATH, buffer, NULL);
-    return result > 0;
+    const char separator = ';';
+    const std::string filename = program + ".exe";
 #else
-    // On Linux/Mac, check if lame is in PATH
-    return system("which lame > /dev/null 2>&1") == 0;
+    const char separator = ':';
+    const std::string& filename = program;
 #endif
+
+    std::istringstream dirs(path);
+    std::string dir;
+    while (std::getline(dirs, dir, separator)) {
+        if (dir.empty()) continue;
+        std::error_code error;
+        if (std::filesystem::is_regular_file(std::filesystem::path(dir) / filename, error)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Check if LAME is available on the system
+inline bool isLameAvailable() {
+    return isOnPath("lame");
 }
 
 // Check if FFmpeg is available on the system
 inline bool isFFmpegAvailable() {
-#ifdef _WIN32
-    char buffer[MAX_PATH];
-    DWORD result = SearchPathA(NULL, "ffmpeg.exe", NULL, MAX_PATH, buffer, NULL);
-    return result > 0;
-#else
-    return system("which ffmpeg > /dev/null 2>&1") == 0;
-#endif
+    return isOnPath("ffmpeg");
 }
 
-// Export to MP3 file (requires LAME or FFmpeg)
+// Export to MP3 file (requires LAME or FFmpeg; false if neither is found)
 inline bool exportMp3(Project& project, Sequencer& seq, const std::string& filepath,
                       float durationBeats, int bitrate = 192) {
+    const bool useLame = isLameAvailable();
+    if (!useLame && !isFFmpegAvailable()) {
+        return false;
+    }
+
     // First, export to a temporary WAV file
     std::string tempWavPath = filepath + ".temp.wav";
 
     if (!exportWav(project, seq, tempWavPath, durationBeats)) {
+        std::remove(tempWavPath.c_str());
         return false;
     }
 
-    bool success = false;
     std::string command;
-
-#ifdef _WIN32
-    // Windows: Try LAME first, then FFmpeg
-    if (isLameAvailable()) {
+    if (useLame) {
         // LAME command: lame -b <bitrate> input.wav output.mp3
         command = "lame -b " + std::to_string(bitrate) + " --quiet \"" +
                   tempWavPath + "\" \"" + filepath + "\"";
-        success = (system(command.c_str()) == 0);
-    }
-    else if (isFFmpegAvailable()) {
-        // FFmpeg command: ffmpeg -i input.wav -b:a <bitrate>k output.mp3
-        command = "ffmpeg -y -i \"" + tempWavPath + "\" -b:a " +
-                  std::to_string(bitrate) + "k \"" + filepath + "\" -loglevel quiet";
-        success = (system(command.c_str()) == 0);
     }
     else {
-        // No encoder available - try using Windows PowerShell with .NET
-        // This is a fallback that may work on some Windows systems
-        MessageBoxA(NULL,
-            "MP3 export requires LAME or FFmpeg.\n\n"
-            "Please install one of the following:\n"
-            "- LAME: https://lame.sourceforge.io/\n"
-            "- FFmpeg: https://ffmpeg.org/\n\n"
-            "Add the executable to your system PATH.",
-            "MP3 Encoder Not Found", MB_OK | MB_ICONWARNING);
-
-        // Clean up temp file
-        DeleteFileA(tempWavPath.c_str());
-        return false;
-    }
-#else
-    // Linux/Mac
-    if (isLameAvailable()) {
-        command = "lame -b " + std::to_string(bitrate) + " --quiet \"" +
-                  tempWavPath + "\" \"" + filepath + "\"";
-        success = (system(command.c_str()) == 0);
-    }
-    else if (isFFmpegAvailable()) {
+        // FFmpeg command: ffmpeg -i input.wav -b:a <bitrate>k output.mp3
         command = "ffmpeg -y -i \"" + tempWavPath + "\" -b:a " +
                   std::to_string(bitrate) + "k \"" + filepath + "\" -loglevel quiet";
-        success = (system(command.c_str()) == 0);
     }
-    else {
-        // Clean up and return failure
-        remove(tempWavPath.c_str());
-        return false;
-    }
-#endif
+    bool success = (std::system(command.c_str()) == 0);
 
     // Clean up temporary WAV file
-#ifdef _WIN32
-    DeleteFileA(tempWavPath.c_str());
-#else
-    remove(tempWavPath.c_str());
-#endif
+    std::remove(tempWavPath.c_str());
 
     return success;
 }
@@ -454,61 +528,4 @@ inline std::string getMp3EncoderStatus() {
     }
 }
 
-// ============================================================================
-// Windows File Dialogs
-// ============================================================================
-
-#ifdef _WIN32
-
-inline std::string openFileDialog(const char* filter, const char* defaultExt) {
-    char filename[MAX_PATH] = "";
-
-    OPENFILENAMEA ofn;
-    ZeroMemory(&ofn, sizeof(ofn));
-    ofn.lStructSize = sizeof(ofn);
-    ofn.hwndOwner = NULL;
-    ofn.lpstrFilter = filter;
-    ofn.lpstrFile = filename;
-    ofn.nMaxFile = MAX_PATH;
-    ofn.lpstrDefExt = defaultExt;
-    ofn.Flags = OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST;
-
-    if (GetOpenFileNameA(&ofn)) {
-        return std::string(filename);
-    }
-    return "";
-}
-
-inline std::string saveFileDialog(const char* filter, const char* defaultExt) {
-    char filename[MAX_PATH] = "";
-
-    OPENFILENAMEA ofn;
-    ZeroMemory(&ofn, sizeof(ofn));
-    ofn.lStructSize = sizeof(ofn);
-    ofn.hwndOwner = NULL;
-    ofn.lpstrFilter = filter;
-    ofn.lpstrFile = filename;
-    ofn.nMaxFile = MAX_PATH;
-    ofn.lpstrDefExt = defaultExt;
-    ofn.Flags = OFN_OVERWRITEPROMPT;
-
-    if (GetSaveFileNameA(&ofn)) {
-        return std::string(filename);
-    }
-    return "";
-}
-
-#else
-
-// Fallback for non-Windows (just use hardcoded paths for now)
-inline std::string openFileDialog(const char*, const char*) {
-    return "";
-}
-
-inline std::string saveFileDialog(const char*, const char*) {
-    return "";
-}
-
-#endif
-
 } // namespace ChiptuneTracker
@@ -0,0 +1,143 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - LFSR Noise
+ *
+ * The NES-style 15-bit noise register behind the Noise oscillator and
+ * the drum generators. Each clock shifts the register right and feeds
+ * bit 0 XOR a tap bit back into bit 14. Instead of clocking it bit by
+ * bit:
+ *
+ *   lfsrAdvance()  jumps several clocks with a few word operations (the
+ *                  feedback bits of up to 14 clocks, 9 for Bit6 taps,
+ *                  only depend on the starting state)
+ *   LfsrTable      every state laid out once in cycle order, so a block
+ *                  of noise output is a walk along one array
+ *
+ *   Bit1 taps (bit 0 ^ bit 1)  one cycle through all 32767 non-zero states
+ *   Bit6 taps (bit 0 ^ bit 6)  352 cycles of 93 states and one of 31
+ *
+ * Both give exactly the states clocking the register by hand does.
+ */
+
+#include <array>
+#include <cstdint>
+
+namespace ChiptuneTracker {
+
+constexpr int LFSR_STATES = 1 << 15;
+
+enum class LfsrTaps : uint8_t {
+    Bit1,   // Feedback from bit 0 ^ bit 1
+    Bit6,   // Feedback from bit 0 ^ bit 6
+};
+
+constexpr int lfsrTap(LfsrTaps taps) { return taps == LfsrTaps::Bit1 ? 1 : 6; }
+
+// One clock of the register
+constexpr uint16_t lfsrClock(uint16_t state, LfsrTaps taps) {
+    const uint16_t feedback = ((state >> 0) ^ (state >> lfsrTap(taps))) & 1;
+    return static_cast<uint16_t>((state >> 1) | (feedback << 14));
+}
+
+// The state 'clocks' clocks later. Clock j feeds back bit j ^ bit (j +
+// tap) of the starting state as long as j + tap < 15, so that many clocks
+// are one shift of the state plus its feedback bits on top.
+constexpr uint16_t lfsrAdvance(uint16_t state, uint32_t clocks, LfsrTaps taps) {
+    const int tap = lfsrTap(taps);
+    const uint32_t maxJump = 15 - tap;
+    uint32_t s = state;
+    while (clocks > 0) {
+        const uint32_t jump = clocks < maxJump ? clocks : maxJump;
+        const uint32_t feedback = (s ^ (s >> tap)) & ((1u << jump) - 1);
+        s = (s >> jump) | (feedback << (15 - jump));
+        clocks -= jump;
+    }
+    return static_cast<uint16_t>(s);
+}
+
+// ============================================================================
+// LFSR Table - every state of one tap setting, in cycle order
+// ============================================================================
+class LfsrTable {
+public:
+    explicit LfsrTable(LfsrTaps taps) {
+        std::array<bool, LFSR_STATES> placed{};
+        uint32_t next = 0;
+        for (int first = 0; first < LFSR_STATES; ++first) {
+            if (placed[first]) continue;
+
+            // Walk the cycle through 'first' (clocking is invertible,
+            // so every state is on exactly one cycle)
+            const uint32_t start = next;
+            uint16_t state = static_cast<uint16_t>(first);
+            do {
+                placed[state] = true;
+                m_entries[state].position = static_cast<uint16_t>(next);
+                m_states[next++] = state;
+                state = lfsrClock(state, taps);
+            } while (state != first);
+
+            for (uint32_t i = start; i < next; ++i) {
+                m_entries[m_states[i]].cycleStart = static_cast<uint16_t>(start);
+                m_entries[m_states[i]].cycleLength = static_cast<uint16_t>(next - start);
+            }
+        }
+    }
+
+    // The Noise oscillator for 'count' samples: each sample adds
+    // clocksPerSample to the clock accumulator, clocks the register once
+    // per whole clock and outputs bit 0 as +-1. Writes every 'stride'-th
+    // float so several voices can be interleaved for SIMD; updates the
+    // state and accumulator.
+    void renderNoise(uint16_t& state, float& accum, float clocksPerSample,
+                     float* out, uint32_t count, uint32_t stride) const {
+        const Entry entry = m_entries[state];
+        const uint16_t* cycle = &m_states[entry.cycleStart];
+        uint32_t offset = entry.position - entry.cycleStart;
+        if (clocksPerSample < 1.0f) {
+            // At most one clock per sample: compare and subtract keeps the
+            // float -> int conversion off the accumulator's dependency chain
+            for (uint32_t i = 0; i < count; ++i) {
+                accum += clocksPerSample;
+                const bool clock = accum >= 1.0f;
+                accum -= clock ? 1.0f : 0.0f;
+                offset += clock;
+                if (offset == entry.cycleLength) offset = 0;
+                out[i * stride] = (cycle[offset] & 1) ? 1.0f : -1.0f;
+            }
+            state = cycle[offset];
+            return;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            accum += clocksPerSample;
+            const int32_t clocks = static_cast<int32_t>(accum);
+            accum -= static_cast<float>(clocks);    // Exact, as subtracting 1 per clock was
+            offset += clocks;
+            if (offset >= entry.cycleLength) offset %= entry.cycleLength;
+            out[i * stride] = (cycle[offset] & 1) ? 1.0f : -1.0f;
+        }
+        state = cycle[offset];
+    }
+
+private:
+    // Where a state sits, and the cycle it is on
+    struct Entry {
+        uint16_t position;
+        uint16_t cycleStart;    // Position of the cycle's first state
+        uint16_t cycleLength;
+    };
+
+    std::array<uint16_t, LFSR_STATES> m_states{};      // State at each position
+    std::array<Entry, LFSR_STATES> m_entries{};        // Indexed by state
+};
+
+// Shared tables, built on first use. Every Synthesizer constructor
+// touches both, so the audio thread never builds them.
+inline const LfsrTable& lfsrTable(LfsrTaps taps) {
+    static const LfsrTable bit1(LfsrTaps::Bit1);
+    static const LfsrTable bit6(LfsrTaps::Bit6);
+    return taps == LfsrTaps::Bit1 ? bit1 : bit6;
+}
+
+} // namespace ChiptuneTracker
@@ -0,0 +1,281 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Audio Profiler
+ *
+ * Times the render path from inside the audio thread: every callback,
+ * and (while detailed timing is on) every channel synth, every enabled
+ * effect, the mix and the aux buses. Each callback's timings are pushed as one frame
+ * through a lock-free queue; the UI thread drains them into rolling
+ * histograms and reads p50/p99/max from those. Callbacks that take
+ * longer than the audio they produce are counted as xruns.
+ */
+
+#include "RingBuffer.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+namespace ChiptuneTracker {
+
+// Monotonic timestamp in nanoseconds
+inline int64_t profileNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ============================================================================
+// Profiled Stages
+// ============================================================================
+// Effects in EffectsChain order, then the sidechain pass
+enum class ProfileEffect : uint8_t {
+    TapeSaturation,
+    Bitcrusher,
+    Distortion,
+    Filter,
+    RingMod,
+    Tremolo,
+    Phaser,
+    Chorus,
+    Sidechain,
+    COUNT
+};
+
+constexpr int PROFILE_EFFECT_COUNT = static_cast<int>(ProfileEffect::COUNT);
+constexpr int PROFILE_CHANNELS = 8;
+
+inline const char* profileEffectName(int effect) {
+    static const char* names[PROFILE_EFFECT_COUNT] = {
+        "Tape", "Bitcrusher", "Distortion", "Filter", "Ring Mod", "Tremolo",
+        "Phaser", "Chorus", "Sidechain"
+    };
+    return (effect >= 0 && effect < PROFILE_EFFECT_COUNT) ? names[effect] : "?";
+}
+
+// One channel's time in a callback. Written only by the task rendering
+// that channel; aligned so parallel tasks never share a cache line.
+struct alignas(64) ChannelProfile {
+    int64_t synthNs = 0;                                    // Voices
+    std::array<int64_t, PROFILE_EFFECT_COUNT> effectNs{};   // Per effect
+    uint32_t effectMask = 0;                                // Effects that ran
+
+    void addEffect(ProfileEffect effect, int64_t ns) {
+        effectNs[static_cast<int>(effect)] += ns;
+        effectMask |= 1u << static_cast<int>(effect);
+    }
+};
+
+// Timings of one audio callback
+struct ProfileFrame {
+    uint32_t frames = 0;
+    float sampleRate = 44100.0f;
+    int64_t callbackNs = 0;
+    bool detailed = false;      // Channel and mix timings below are valid
+    int64_t mixNs = 0;
+    int64_t auxNs = 0;          // Shared reverb and delay
+    std::array<ChannelProfile, PROFILE_CHANNELS> channels{};
+
+    // Time the callback's audio lasts - the most it may take
+    double budgetNs() const {
+        return sampleRate > 0.0f ? frames * 1.0e9 / sampleRate : 0.0;
+    }
+};
+
+// ============================================================================
+// Audio Profiler - collects timings on the audio thread
+// ============================================================================
+class AudioProfiler {
+public:
+    static constexpr size_t FRAME_CAPACITY = 32;   // ~0.4 s of 512-frame callbacks
+
+    // Any thread: turn per-channel, per-effect and mix timing on or off.
+    // Callback time and xruns are always recorded.
+    void setDetailed(bool detailed) { m_detailed.store(detailed, std::memory_order_relaxed); }
+    bool isDetailed() const { return m_detailed.load(std::memory_order_relaxed); }
+
+    // ========================================================================
+    // Audio Thread
+    // ========================================================================
+    void beginCallback() {
+        m_frame.detailed = m_detailed.load(std::memory_order_relaxed);
+        if (m_frame.detailed) {
+            m_frame.mixNs = 0;
+            m_frame.auxNs = 0;
+            m_frame.channels.fill(ChannelProfile{});
+        }
+        m_start = profileNow();
+    }
+
+    void endCallback(uint32_t frames, float sampleRate) {
+        m_frame.callbackNs = profileNow() - m_start;
+        m_frame.frames = frames;
+        m_frame.sampleRate = sampleRate;
+
+        if (m_frame.callbackNs > m_frame.budgetNs()) {
+            m_xruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_callbacks.fetch_add(1, std::memory_order_relaxed);
+
+        if (!m_frames.push(m_frame)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Where a channel's timings go this callback (nullptr when not detailed)
+    ChannelProfile* channel(int ch) {
+        return m_frame.detailed ? &m_frame.channels[ch] : nullptr;
+    }
+
+    bool isTimingMix() const { return m_frame.detailed; }
+    void addMix(int64_t ns) { m_frame.mixNs += ns; }
+    void addAux(int64_t ns) { m_frame.auxNs += ns; }
+
+    // ========================================================================
+    // UI Thread
+    // ========================================================================
+    bool pop(ProfileFrame& frame) { return m_frames.pop(frame); }
+
+    uint64_t callbacks() const { return m_callbacks.load(std::memory_order_relaxed); }
+    uint64_t xruns() const { return m_xruns.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> m_detailed{false};
+
+    // Callback in progress (audio thread only)
+    ProfileFrame m_frame;
+    int64_t m_start = 0;
+
+    LockFreeRingBuffer<ProfileFrame, FRAME_CAPACITY> m_frames;
+    std::atomic<uint64_t> m_callbacks{0};
+    std::atomic<uint64_t> m_xruns{0};
+    std::atomic<uint64_t> m_dropped{0};
+};
+
+// ============================================================================
+// Profile Histogram - rolling window of timings in log-spaced buckets
+// ============================================================================
+// Buckets are a quarter octave wide starting at 0.25 us, so percentiles
+// are exact to within ~19%; the maximum is exact.
+class ProfileHistogram {
+public:
+    static constexpr int WINDOW = 512;     // Samples kept (~6 s of callbacks)
+    static constexpr int BUCKETS = 64;
+
+    void add(float us) {
+        if (m_count == WINDOW) {
+            m_buckets[bucketOf(m_window[m_next])]--;
+        } else {
+            m_count++;
+        }
+        m_window[m_next] = us;
+        m_buckets[bucketOf(us)]++;
+        m_next = (m_next + 1) % WINDOW;
+    }
+
+    void clear() {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_next = 0;
+    }
+
+    int count() const { return m_count; }
+
+    // Upper edge of the bucket holding the given fraction (0-1) of samples
+    float percentile(float fraction) const {
+        if (m_count == 0) return 0.0f;
+
+        const int rank = std::max(1, static_cast<int>(std::ceil(fraction * m_count)));
+        int seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += m_buckets[b];
+            if (seen >= rank) return std::min(upperEdge(b), max());
+        }
+        return max();
+    }
+
+    float max() const {
+        float result = 0.0f;
+        for (int i = 0; i < m_count; ++i) {
+            result = std::max(result, m_window[i]);
+        }
+        return result;
+    }
+
+private:
+    static int bucketOf(float us) {
+        if (!(us >= 0.25f)) return 0;
+        return std::min(BUCKETS - 1, 1 + static_cast<int>(4.0f * std::log2(us * 4.0f)));
+    }
+
+    static float upperEdge(int bucket) {
+        return 0.25f * std::exp2(bucket * 0.25f);
+    }
+
+    std::array<float, WINDOW> m_window{};
+    std::array<int, BUCKETS> m_buckets{};
+    int m_count = 0;
+    int m_next = 0;
+};
+
+// ============================================================================
+// Audio Profile Stats - UI-side view of the profiler
+// ============================================================================
+struct AudioProfileStats {
+    ProfileHistogram callback;      // us per callback
+    ProfileHistogram load;          // Callback time as % of its budget
+    ProfileHistogram mix;
+    ProfileHistogram aux;
+    std::array<ProfileHistogram, PROFILE_CHANNELS> synth;
+    std::array<std::array<ProfileHistogram, PROFILE_EFFECT_COUNT>, PROFILE_CHANNELS> effects;
+    std::array<uint32_t, PROFILE_CHANNELS> activeEffects{};     // Effect masks of the latest frame
+    float budgetUs = 0.0f;          // Of the latest callback
+
+    // Drain every frame the audio thread has published
+    void update(AudioProfiler& profiler) {
+        ProfileFrame frame;
+        while (profiler.pop(frame)) {
+            add(frame);
+        }
+    }
+
+    void add(const ProfileFrame& frame) {
+        const double budgetNs = frame.budgetNs();
+        budgetUs = static_cast<float>(budgetNs * 1.0e-3);
+        callback.add(frame.callbackNs * 1.0e-3f);
+        if (budgetNs > 0.0) {
+            load.add(static_cast<float>(frame.callbackNs * 100.0 / budgetNs));
+        }
+        if (!frame.detailed) return;
+
+        mix.add(frame.mixNs * 1.0e-3f);
+        aux.add(frame.auxNs * 1.0e-3f);
+        for (int ch = 0; ch < PROFILE_CHANNELS; ++ch) {
+            const ChannelProfile& channel = frame.channels[ch];
+            synth[ch].add(channel.synthNs * 1.0e-3f);
+            activeEffects[ch] = channel.effectMask;
+            for (int e = 0; e < PROFILE_EFFECT_COUNT; ++e) {
+                if (channel.effectMask & (1u << e)) {
+                    effects[ch][e].add(channel.effectNs[e] * 1.0e-3f);
+                }
+            }
+        }
+    }
+
+    // Forget detailed timings (e.g. when detailed timing is switched back on)
+    void clearDetailed() {
+        mix.clear();
+        aux.clear();
+        for (int ch = 0; ch < PROFILE_CHANNELS; ++ch) {
+            synth[ch].clear();
+            for (auto& histogram : effects[ch]) {
+                histogram.clear();
+            }
+        }
+    }
+};
+
+} // namespace ChiptuneTracker
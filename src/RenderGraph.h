@@ -0,0 +1,336 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Render Graph
+ *
+ * Runs a block's rendering work (one task per channel synth, plus tasks
+ * that read another channel's output, like sidechain) on a small pool of
+ * pinned worker threads. Tasks form a dependency graph: a task becomes
+ * ready once every task it depends on has finished, and idle threads
+ * steal ready tasks from each other's queues. The calling thread takes
+ * part in every execution, so a block never waits on a sleeping worker.
+ */
+
+#include <atomic>
+#include <array>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace ChiptuneTracker {
+
+// Hint to the CPU that this is a spin-wait loop
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// Pin a thread to one CPU core (best effort)
+inline void pinThreadToCore(std::thread& thread, int core) {
+#if defined(_WIN32)
+    SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1) << (core % 64));
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+    (void)thread;
+    (void)core;
+#endif
+}
+
+// ============================================================================
+// Task Deque - fixed-size work-stealing deque (Chase-Lev)
+// ============================================================================
+// The owning thread pushes and pops at the bottom; any other thread may
+// steal from the top. Indices only ever grow, so the deque never needs
+// resetting between executions.
+class TaskDeque {
+public:
+    static constexpr int64_t CAPACITY = 64;     // Power of two, > tasks per execution
+
+    // Owner only
+    void push(int task) {
+        const int64_t bottom = m_bottom.load();
+        m_tasks[bottom & (CAPACITY - 1)].store(task);
+        m_bottom.store(bottom + 1);
+    }
+
+    // Owner only - returns -1 if empty
+    int pop() {
+        const int64_t bottom = m_bottom.load() - 1;
+        m_bottom.store(bottom);
+        int64_t top = m_top.load();
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1);
+            return -1;
+        }
+
+        int task = m_tasks[bottom & (CAPACITY - 1)].load();
+        if (top == bottom) {
+            // Last task: race any thief for it
+            if (!m_top.compare_exchange_strong(top, top + 1)) task = -1;
+            m_bottom.store(bottom + 1);
+        }
+        return task;
+    }
+
+    // Any thread - returns -1 if empty or lost a race
+    int steal() {
+        int64_t top = m_top.load();
+        const int64_t bottom = m_bottom.load();
+        if (top >= bottom) return -1;
+
+        int task = m_tasks[top & (CAPACITY - 1)].load();
+        if (!m_top.compare_exchange_strong(top, top + 1)) return -1;
+        return task;
+    }
+
+private:
+    alignas(64) std::atomic<int64_t> m_top{0};
+    alignas(64) std::atomic<int64_t> m_bottom{0};
+    std::array<std::atomic<int>, CAPACITY> m_tasks{};
+};
+
+// ============================================================================
+// Render Mode
+// ============================================================================
+enum class RenderMode : uint8_t {
+    Realtime,   // Audio callback: workers spin between blocks, caller never sleeps
+    Offline     // File rendering: workers sleep sooner, caller yields while joining
+};
+
+// ============================================================================
+// Render Graph - dependency graph of tasks plus the worker pool running it
+// ============================================================================
+class RenderGraph {
+public:
+    static constexpr int MAX_TASKS = 32;
+    static constexpr int MAX_WORKERS = 15;
+
+    // Called once per task with the payload given to addTask()
+    using TaskFn = void (*)(void* context, int payload);
+
+    RenderGraph() = default;
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
+    ~RenderGraph() { stopWorkers(); }
+
+    // ========================================================================
+    // Worker Pool (not from the audio thread, never during execute())
+    // ========================================================================
+    void startWorkers(int count, RenderMode mode) {
+        stopWorkers();
+
+        m_mode = mode;
+        count = std::clamp(count, 0, MAX_WORKERS);
+        const int cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+        m_stopping.store(false);
+        m_workers.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            // Participant 0 is the thread calling execute()
+            m_workers.emplace_back([this, i] { workerLoop(i + 1); });
+            pinThreadToCore(m_workers.back(), (i + 1) % cores);
+        }
+    }
+
+    void stopWorkers() {
+        if (m_workers.empty()) return;
+
+        m_stopping.store(true);
+        m_generation.fetch_add(1);
+        m_generation.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+    }
+
+    int workerCount() const { return static_cast<int>(m_workers.size()); }
+
+    // ========================================================================
+    // Graph Building (tasks must be added in dependency order)
+    // ========================================================================
+    void clear() {
+        m_taskCount = 0;
+    }
+
+    // Returns the task index, or -1 if the graph is full
+    int addTask(int payload) {
+        if (m_taskCount >= MAX_TASKS) return -1;
+
+        Task& task = m_tasks[m_taskCount];
+        task.payload = payload;
+        task.dependencies = 0;
+        task.successorCount = 0;
+        return m_taskCount++;
+    }
+
+    // Task 'to' waits for task 'from' (from must have been added first)
+    void addEdge(int from, int to) {
+        if (from < 0 || to < 0 || from >= to || to >= m_taskCount) return;
+
+        Task& source = m_tasks[from];
+        for (int i = 0; i < source.successorCount; ++i) {
+            if (source.successors[i] == to) return;
+        }
+        source.successors[source.successorCount++] = static_cast<uint8_t>(to);
+        m_tasks[to].dependencies++;
+    }
+
+    int taskCount() const { return m_taskCount; }
+
+    // ========================================================================
+    // Execution
+    // ========================================================================
+    // Runs every task and returns once all have finished (the join). With
+    // no workers, or parallel == false, tasks run inline in the order
+    // they were added.
+    void execute(TaskFn fn, void* context, bool parallel = true) {
+        if (!parallel || m_workers.empty() || m_taskCount <= 1) {
+            for (int i = 0; i < m_taskCount; ++i) {
+                fn(context, m_tasks[i].payload);
+            }
+            return;
+        }
+
+        m_fn = fn;
+        m_context = context;
+        for (int i = 0; i < m_taskCount; ++i) {
+            m_pending[i].store(m_tasks[i].dependencies, std::memory_order_relaxed);
+        }
+        m_remaining.store(m_taskCount, std::memory_order_relaxed);
+
+        // Seed the caller's queue with the tasks that are ready now
+        for (int i = m_taskCount - 1; i >= 0; --i) {
+            if (m_tasks[i].dependencies == 0) m_deques[0].push(i);
+        }
+
+        // Wake the pool (only sleeping workers need the kernel)
+        m_generation.fetch_add(1);
+        if (m_sleepers.load() > 0) {
+            m_generation.notify_all();
+        }
+
+        participate(0);
+    }
+
+private:
+    static constexpr int REALTIME_SPIN_ITERATIONS = 1 << 15;
+    static constexpr int OFFLINE_SPIN_ITERATIONS = 1 << 10;
+
+    struct Task {
+        int payload = 0;
+        int dependencies = 0;
+        int successorCount = 0;
+        std::array<uint8_t, MAX_TASKS> successors{};
+    };
+
+    // Run and steal tasks until the current execution has finished
+    void participate(int self) {
+        const int participants = workerCount() + 1;
+        int victim = self;
+
+        while (m_remaining.load(std::memory_order_acquire) > 0) {
+            int task = m_deques[self].pop();
+
+            // Own queue empty: try everyone else once, round robin
+            for (int tries = 1; task < 0 && tries < participants; ++tries) {
+                victim = (victim + 1) % participants;
+                if (victim != self) task = m_deques[victim].steal();
+            }
+
+            if (task >= 0) {
+                runTask(self, task);
+            } else if (self == 0 && m_mode == RenderMode::Offline) {
+                std::this_thread::yield();
+            } else {
+                cpuRelax();
+            }
+        }
+    }
+
+    void runTask(int self, int index) {
+        const Task& task = m_tasks[index];
+        m_fn(m_context, task.payload);
+
+        // Release successors whose last dependency this was
+        for (int i = 0; i < task.successorCount; ++i) {
+            const int successor = task.successors[i];
+            if (m_pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                m_deques[self].push(successor);
+            }
+        }
+        m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void workerLoop(int self) {
+        uint64_t seen = m_generation.load();
+        const int spinLimit = (m_mode == RenderMode::Realtime) ? REALTIME_SPIN_ITERATIONS
+                                                               : OFFLINE_SPIN_ITERATIONS;
+
+        while (true) {
+            // Bounded spin for the next execution, then sleep until woken
+            uint64_t generation = m_generation.load();
+            for (int i = 0; i < spinLimit && generation == seen; ++i) {
+                cpuRelax();
+                generation = m_generation.load();
+            }
+            if (generation == seen) {
+                m_sleepers.fetch_add(1);
+                m_generation.wait(seen);
+                m_sleepers.fetch_sub(1);
+                continue;
+            }
+
+            seen = generation;
+            if (m_stopping.load()) return;
+            participate(self);
+        }
+    }
+
+    // Graph (built by the calling thread between executions)
+    std::array<Task, MAX_TASKS> m_tasks;
+    int m_taskCount = 0;
+
+    // Per-execution state
+    TaskFn m_fn = nullptr;
+    void* m_context = nullptr;
+    std::array<std::atomic<int>, MAX_TASKS> m_pending{};
+    alignas(64) std::atomic<int> m_remaining{0};
+    std::array<TaskDeque, MAX_WORKERS + 1> m_deques;
+
+    // Worker pool
+    RenderMode m_mode = RenderMode::Realtime;
+    std::vector<std::thread> m_workers;
+    alignas(64) std::atomic<uint64_t> m_generation{0};
+    std::atomic<int> m_sleepers{0};
+    std::atomic<bool> m_stopping{false};
+};
+
+} // namespace ChiptuneTracker
@@ -0,0 +1,359 @@
+/*
+ * ChiptuneTracker - Headless Renderer
+ *
+ * Renders projects to WAV files without the editor:
+ *
+ *   chiptune-render <project.ctp> <output.wav> [options]
+ *   chiptune-render --batch <manifest> [options]
+ *
+ * A single render drives one Sequencer on the offline render graph. A
+ * batch runs one independent Project and Sequencer per worker thread
+ * (see BatchRender.h). Both report wall time, realtime factor and peak
+ * memory when they finish.
+ */
+
+#include "Types.h"
+#include "Sequencer.h"
+#include "FileIO.h"
+#include "BatchRender.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace ChiptuneTracker;
+
+// ============================================================================
+// Heap Accounting - live and peak heap bytes per batch worker
+// ============================================================================
+// Every allocation records the slot of the thread that made it, so each
+// job's peak can be measured while other jobs allocate concurrently.
+// Slot 0 collects the main thread and anything else.
+namespace {
+
+constexpr int MEMORY_SLOTS = 65;
+
+struct alignas(64) MemorySlot {
+    std::atomic<int64_t> current{0};
+    std::atomic<int64_t> peak{0};
+};
+
+MemorySlot g_memorySlots[MEMORY_SLOTS];
+thread_local int t_memorySlot = 0;
+
+struct AllocationHeader {
+    void* base;
+    size_t size;
+    int slot;
+};
+
+void* trackedAllocate(size_t size, size_t alignment) {
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    void* base = std::malloc(size + alignment + sizeof(AllocationHeader));
+    if (!base) return nullptr;
+
+    uintptr_t address = reinterpret_cast<uintptr_t>(base) + sizeof(AllocationHeader);
+    address = (address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+
+    auto* header = reinterpret_cast<AllocationHeader*>(address) - 1;
+    header->base = base;
+    header->size = size;
+    header->slot = t_memorySlot;
+
+    MemorySlot& slot = g_memorySlots[header->slot];
+    const int64_t current = slot.current.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) +
+                            static_cast<int64_t>(size);
+    int64_t peak = slot.peak.load(std::memory_order_relaxed);
+    while (current > peak && !slot.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {}
+
+    return reinterpret_cast<void*>(address);
+}
+
+void trackedFree(void* pointer) {
+    if (!pointer) return;
+
+    auto* header = static_cast<AllocationHeader*>(pointer) - 1;
+    g_memorySlots[header->slot].current.fetch_sub(static_cast<int64_t>(header->size), std::memory_order_relaxed);
+    std::free(header->base);
+}
+
+void* allocateOrThrow(size_t size, size_t alignment) {
+    void* pointer = trackedAllocate(size, alignment);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+// Peak resident set size of the whole process (0 where unsupported)
+uint64_t processPeakBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);          // Bytes
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;   // Kilobytes
+#endif
+#endif
+}
+
+double megabytes(uint64_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} // namespace
+
+void* operator new(size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size, alignof(std::max_align_t)); }
+
+void operator delete(void* pointer) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { trackedFree(pointer); }
+
+// ============================================================================
+// Command Line
+// ============================================================================
+namespace {
+
+struct RenderOptions {
+    RenderJob job;              // Single render (input, output, length, format)
+    std::string manifestPath;   // Batch render when set
+    int threads = -1;           // Render workers, or batch jobs at once (-1 = auto)
+    bool listSamples = false;
+};
+
+void printUsage(const char* program) {
+    std::printf(
+        "Usage: %s <project.ctp> <output.wav> [options]\n"
+        "       %s --batch <manifest> [options]\n"
+        "       %s --list-samples\n"
+        "\n"
+        "A project is a .ctp path or sample:<name or index> for a bundled sample track.\n"
+        "Manifest lines are: <project> <output.wav> [beats]  ('#' starts a comment)\n"
+        "\n"
+        "Options:\n"
+        "  --beats <n>      Length to render in beats (default: whole project)\n"
+        "  --seconds <s>    Length to render in seconds\n"
+        "  --pattern <i>    Render pattern i (0-based) instead of the arrangement\n"
+        "  --channel <c>    Channel the pattern plays on (default: 0)\n"
+        "  --format <f>     16, 24 or float (default: 16)\n"
+        "  --threads <n>    Render worker threads, or with --batch the number of\n"
+        "                   jobs rendered at once (default: one per core)\n",
+        program, program, program);
+}
+
+bool parseFormat(const char* text, SampleFormat& format) {
+    if (std::strcmp(text, "16") == 0) format = SampleFormat::Int16;
+    else if (std::strcmp(text, "24") == 0) format = SampleFormat::Int24;
+    else if (std::strcmp(text, "float") == 0 || std::strcmp(text, "32") == 0) format = SampleFormat::Float32;
+    else return false;
+    return true;
+}
+
+bool parseArguments(int argc, char** argv, RenderOptions& options, float& seconds) {
+    RenderJob& job = options.job;
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--list-samples") == 0) {
+            options.listSamples = true;
+        } else if (std::strcmp(arg, "--batch") == 0 && hasValue) {
+            options.manifestPath = argv[++i];
+        } else if (std::strcmp(arg, "--beats") == 0 && hasValue) {
+            job.beats = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--seconds") == 0 && hasValue) {
+            seconds = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(arg, "--pattern") == 0 && hasValue) {
+            job.pattern = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--channel") == 0 && hasValue) {
+            job.channel = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--threads") == 0 && hasValue) {
+            options.threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--format") == 0 && hasValue) {
+            if (!parseFormat(argv[++i], job.format)) {
+                std::fprintf(stderr, "Unknown format: %s\n", argv[i]);
+                return false;
+            }
+        } else if (arg[0] == '-' && arg[1] == '-') {
+            std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg);
+            return false;
+        } else if (positional == 0) {
+            job.input = arg;
+            ++positional;
+        } else if (positional == 1) {
+            job.output = arg;
+            ++positional;
+        } else {
+            std::fprintf(stderr, "Unexpected argument: %s\n", arg);
+            return false;
+        }
+    }
+
+    if (options.listSamples) return true;
+    if (!options.manifestPath.empty()) return positional == 0;
+    return positional == 2;
+}
+
+int listSampleTracks() {
+    for (int i = 0; i < g_NumSampleTracks; ++i) {
+        const SampleTrack& track = g_SampleTracks[i];
+        std::printf("%2d  %-16s  %-10s  %3d BPM  %s\n",
+                    i, track.name, track.genre, track.bpm, track.description);
+    }
+    return 0;
+}
+
+int renderSingle(const RenderOptions& options, float seconds) {
+    RenderJob job = options.job;
+
+    // Seconds need the project's tempo; convert once it is known
+    if (seconds > 0.0f) {
+        Project project;
+        std::string error;
+        if (!loadJobProject(job, project, error)) {
+            std::fprintf(stderr, "Failed: %s\n", error.c_str());
+            return 1;
+        }
+        job.beats = seconds * project.bpm / 60.0f;
+    }
+
+    // The caller renders too, so leave one core for it
+    int workers = options.threads;
+    if (workers < 0) workers = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+    workers = std::clamp(workers, 0, Sequencer::MAX_CHANNELS - 1);
+
+    const RenderJobResult result = renderJob(job, workers);
+    if (!result.ok) {
+        std::fprintf(stderr, "Failed: %s\n", result.error.c_str());
+        return 1;
+    }
+
+    std::printf("Wrote %s: %.1f beats at %.0f BPM, %.1f s of audio in %.3f s "
+                "(%.1fx realtime, %d worker thread%s, peak heap %.1f MB, peak RSS %.1f MB)\n",
+                job.output.c_str(), result.beats, result.bpm, result.audioSeconds, result.wallSeconds,
+                result.realtimeFactor(), workers, workers == 1 ? "" : "s",
+                megabytes(static_cast<uint64_t>(g_memorySlots[0].peak.load())),
+                megabytes(processPeakBytes()));
+    return 0;
+}
+
+int renderBatch(const RenderOptions& options, float seconds) {
+    if (seconds > 0.0f) {
+        std::fprintf(stderr, "--seconds is not supported with --batch; put beats in the manifest\n");
+        return 2;
+    }
+
+    std::vector<RenderJob> jobs;
+    std::string error;
+    if (!parseRenderManifest(options.manifestPath, jobs, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    for (RenderJob& job : jobs) {
+        job.format = options.job.format;
+        job.pattern = options.job.pattern;
+        job.channel = options.job.channel;
+        if (job.beats <= 0.0f) job.beats = options.job.beats;
+    }
+
+    // One job per core; each renders on its own thread only
+    int threads = options.threads > 0 ? options.threads
+                                      : static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::clamp(threads, 1, MEMORY_SLOTS - 1);
+
+    std::printf("Rendering %zu job%s on %d thread%s\n",
+                jobs.size(), jobs.size() == 1 ? "" : "s", threads, threads == 1 ? "" : "s");
+
+    std::vector<int64_t> baseline(threads, 0);
+    std::atomic<int> finished{0};
+    std::atomic<int> failed{0};
+    std::atomic<int64_t> audioMicroseconds{0};
+
+    const auto start = std::chrono::steady_clock::now();
+    runRenderJobs(jobs, threads,
+        [&](size_t, int worker) {
+            // Measure this job from what the worker still holds now
+            t_memorySlot = worker + 1;
+            MemorySlot& slot = g_memorySlots[worker + 1];
+            baseline[worker] = slot.current.load();
+            slot.peak.store(baseline[worker]);
+        },
+        [&](size_t index, int worker, const RenderJobResult& result) {
+            const int64_t peak = g_memorySlots[worker + 1].peak.load() - baseline[worker];
+            const int done = finished.fetch_add(1) + 1;
+
+            if (result.ok) {
+                audioMicroseconds.fetch_add(static_cast<int64_t>(result.audioSeconds * 1e6));
+                std::printf("[%3d/%zu] %-40s %8.1f s audio  %8.3f s  %7.1fx  peak heap %6.1f MB\n",
+                            done, jobs.size(), jobs[index].output.c_str(), result.audioSeconds,
+                            result.wallSeconds, result.realtimeFactor(),
+                            megabytes(static_cast<uint64_t>(std::max<int64_t>(peak, 0))));
+            } else {
+                failed.fetch_add(1);
+                std::printf("[%3d/%zu] %-40s FAILED: %s\n",
+                            done, jobs.size(), jobs[index].output.c_str(), result.error.c_str());
+            }
+            std::fflush(stdout);
+        });
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double audioSeconds = static_cast<double>(audioMicroseconds.load()) / 1e6;
+
+    std::printf("Rendered %d of %zu jobs: %.1f s of audio in %.3f s (%.1fx realtime), peak RSS %.1f MB\n",
+                finished.load() - failed.load(), jobs.size(), audioSeconds, wallSeconds,
+                wallSeconds > 0.0 ? audioSeconds / wallSeconds : 0.0, megabytes(processPeakBytes()));
+    return failed.load() == 0 ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RenderOptions options;
+    float seconds = 0.0f;
+    if (!parseArguments(argc, argv, options, seconds)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    if (options.listSamples) return listSampleTracks();
+    if (!options.manifestPath.empty()) return renderBatch(options, seconds);
+    return renderSingle(options, seconds);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Ring Buffer
+ *
+ * Single-producer / single-consumer queue for passing data between the
+ * UI thread and the audio thread without locks or allocations.
+ */
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// Lock-Free Ring Buffer for UI <-> Audio Thread Communication
+// ============================================================================
+template<typename T, size_t Capacity>
+class LockFreeRingBuffer {
+public:
+    LockFreeRingBuffer() : m_head(0), m_tail(0) {}
+
+    // Producer - Returns true if push succeeded
+    bool push(const T& item) {
+        const size_t currentTail = m_tail.load(std::memory_order_relaxed);
+        const size_t nextTail = (currentTail + 1) % Capacity;
+
+        if (nextTail == m_head.load(std::memory_order_acquire)) {
+            return false; // Buffer full
+        }
+
+        m_buffer[currentTail] = item;
+        m_tail.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer - Returns true if pop succeeded
+    bool pop(T& item) {
+        const size_t currentHead = m_head.load(std::memory_order_relaxed);
+
+        if (currentHead == m_tail.load(std::memory_order_acquire)) {
+            return false; // Buffer empty
+        }
+
+        item = m_buffer[currentHead];
+        m_head.store((currentHead + 1) % Capacity, std::memory_order_release);
+        return true;
+    }
+
+    // Producer - True if the next push would fail
+    bool full() const {
+        const size_t nextTail = (m_tail.load(std::memory_order_relaxed) + 1) % Capacity;
+        return nextTail == m_head.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, Capacity> m_buffer;
+    std::atomic<size_t> m_head;
+    std::atomic<size_t> m_tail;
+};
+
+} // namespace ChiptuneTracker
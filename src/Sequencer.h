@@ -9,9 +9,14 @@
 
 #include "Types.h"
 #include "Synthesizer.h"
+#include "Timeline.h"
+#include "Snapshot.h"
+#include "Commands.h"
+#include "RingBuffer.h"
+#include "RenderGraph.h"
 #include <array>
+#include <atomic>
 #include <algorithm>
-#include <cstdlib>
 
 namespace ChiptuneTracker {
 
@@ -22,56 +27,122 @@ class Sequencer {
 public:
     static constexpr int MAX_CHANNELS = 8;
 
+    static constexpr int DEFAULT_VOICE_POOL_SIZE = 256;
+
     Sequencer() {
-        for (auto& synth : m_synths) {
-            synth.setSampleRate(44100.0f);
-        }
+        setVoicePoolSize(DEFAULT_VOICE_POOL_SIZE);
+        m_reverbBus.mix = 1.0f;     // Buses return only the wet signal
+        m_delayBus.mix = 1.0f;
+        setSampleRate(44100.0f);
     }
 
+    // Also starts rendering the rate's drum one-shots in the background
     void setSampleRate(float sr) {
         m_sampleRate = sr;
+        const DrumCache& drums = DrumCache::forSampleRate(sr);
         for (auto& synth : m_synths) {
             synth.setSampleRate(sr);
+            synth.setDrumCache(&drums);
+        }
+        m_reverbBus.setSampleRate(sr);
+        m_delayBus.setSampleRate(sr);
+        m_sleepFrames = static_cast<uint32_t>(SilenceDetector::HOLD_SECONDS * sr);
+    }
+
+    // Render channels on a pool of worker threads (0 = all on the calling
+    // thread). Call before audio starts or while it is stopped.
+    void setRenderThreads(int workers, RenderMode mode) {
+        m_graph.startWorkers(workers, mode);
+    }
+
+    // Voices shared by all channels; drums may hold up to a quarter of
+    // them. Drops every playing voice - call while audio is stopped.
+    void setVoicePoolSize(int voices) {
+        m_voicePool.resize(voices, MAX_CHANNELS);
+        m_voicePool.setDrumLimit(std::max(1, m_voicePool.size() / 4));
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+            m_synths[ch].attachVoicePool(&m_voicePool, ch);
         }
     }
 
+    int voicePoolSize() const { return m_voicePool.size(); }
+
+    // The voices themselves, read-only (for diagnostics and tests; only
+    // stable while audio is not running)
+    const VoicePool& voicePool() const { return m_voicePool; }
+
     void setProject(Project* project) {
         m_project = project;
         updateChannelConfigs();
+        publishProject();
+    }
+
+    // ========================================================================
+    // Project Snapshot (Called from UI thread)
+    // ========================================================================
+    // Hands the audio thread a fresh snapshot if the project or preview
+    // selection changed since the last one. Call once per UI frame after
+    // editing, and before rendering offline.
+    void publishProject() {
+        if (!m_project) return;
+
+        PlaybackSettings settings(*m_project, m_sampleRate);
+        const ProjectSnapshot* latest = m_snapshots.latest();
+        if (latest && latest->settings == settings &&
+            !latest->timeline.needsRebuild(*m_project, m_previewPattern, m_previewChannel, settings.tempo)) {
+            m_snapshots.reclaim();
+            return;
+        }
+
+        auto* snapshot = new ProjectSnapshot();
+        snapshot->settings = settings;
+        snapshot->timeline.build(*m_project, m_previewPattern, m_previewChannel, settings.tempo);
+        m_snapshots.publish(snapshot);
     }
 
     // ========================================================================
-    // Transport Controls
+    // Transport Controls (queued, applied by the audio thread)
     // ========================================================================
     void play() {
-        m_state.isPlaying = true;
+        schedule(makeCommand(AudioCommandType::Play));
     }
 
     void pause() {
-        m_state.isPlaying = false;
+        schedule(makeCommand(AudioCommandType::Pause));
     }
 
     void stop() {
-        m_state.isPlaying = false;
-        m_state.currentBeat = 0.0f;
-        m_state.currentTime = 0.0f;
-        allNotesOff();
+        schedule(makeCommand(AudioCommandType::Stop));
     }
 
     void setPosition(float beat) {
-        m_state.currentBeat = beat;
-        m_state.currentTime = beatToTime(beat);
-        allNotesOff();
+        AudioCommand cmd = makeCommand(AudioCommandType::SetPosition);
+        cmd.data.beat = beat;
+        schedule(cmd);
     }
 
     void setLoop(bool enabled, float start, float end) {
-        m_state.loop = enabled;
-        m_state.loopStart = start;
-        m_state.loopEnd = end;
+        m_loop = {enabled, start, end};
+
+        AudioCommand cmd = makeCommand(AudioCommandType::SetLoop);
+        cmd.data.loop = m_loop;
+        schedule(cmd);
     }
 
     void setLoopEnabled(bool enabled) {
-        m_state.loop = enabled;
+        m_loop.enabled = enabled;
+
+        AudioCommand cmd = makeCommand(AudioCommandType::SetLoopEnabled);
+        cmd.data.enabled = enabled;
+        schedule(cmd);
+    }
+
+    // Filter length of every oversampled stage, channel effects and the
+    // master clip alike: Realtime for playback, High for rendering to file
+    void setOversampleQuality(OversampleQuality quality) {
+        AudioCommand cmd = makeCommand(AudioCommandType::SetOversampleQuality);
+        cmd.data.oversampleQuality = quality;
+        schedule(cmd);
     }
 
     void setBPM(float bpm) {
@@ -80,114 +151,100 @@ public:
         }
     }
 
+    // ========================================================================
+    // Command Queue
+    // ========================================================================
+    // Queue a command for the audio thread. It is applied before the frame
+    // cmd.frame on the engine clock (see renderedFrames()); frames already
+    // rendered mean the start of the next block. False if the queue is full.
+    bool schedule(const AudioCommand& cmd) {
+        return m_commands.push(cmd);
+    }
+
+    // Frames rendered since the sequencer was created (the engine clock)
+    int64_t renderedFrames() const {
+        return m_renderedFrames.load(std::memory_order_acquire);
+    }
+
     // ========================================================================
     // State Queries
     // ========================================================================
-    const PlaybackState& getState() const { return m_state; }
-    float getCurrentBeat() const { return m_state.currentBeat; }
-    float getCurrentTime() const { return m_state.currentTime; }
-    bool isPlaying() const { return m_state.isPlaying; }
+    // Transport as of the last rendered block, with the loop settings as
+    // last requested
+    PlaybackState getState() const {
+        PlaybackState state;
+        state.isPlaying = isPlaying();
+        state.loop = m_loop.enabled;
+        state.loopStart = m_loop.start;
+        state.loopEnd = m_loop.end;
+        state.currentBeat = getCurrentBeat();
+        state.currentTime = getCurrentTime();
+        return state;
+    }
+    float getCurrentBeat() const { return m_displayBeat.load(std::memory_order_relaxed); }
+    float getCurrentTime() const { return m_displayTime.load(std::memory_order_relaxed); }
+    bool isPlaying() const { return m_displayPlaying.load(std::memory_order_relaxed); }
+    int getActiveVoices() const { return m_displayVoices.load(std::memory_order_relaxed); }
+
+    // Render timings, published once per process() call
+    AudioProfiler& profiler() { return m_profiler; }
 
     // ========================================================================
     // Audio Processing (Called from audio thread)
     // ========================================================================
     void process(float* leftOut, float* rightOut, uint32_t frameCount) {
-        if (!m_project) {
-            std::fill_n(leftOut, frameCount, 0.0f);
-            std::fill_n(rightOut, frameCount, 0.0f);
-            return;
-        }
-
-        float bpm = m_project->bpm;
-        float beatsPerSample = bpm / 60.0f / m_sampleRate;
-
-        for (uint32_t i = 0; i < frameCount; ++i) {
-            float prevBeat = m_state.currentBeat;
-
-            // Advance time if playing
-            if (m_state.isPlaying) {
-                m_state.currentBeat += beatsPerSample;
-                m_state.currentTime += 1.0f / m_sampleRate;
-
-                // Get the actual end time based on notes in the pattern
-                float effectiveEnd = getPatternEndTime();
-
-                // Handle looping or stop at end of last note
-                if (m_state.currentBeat >= effectiveEnd && effectiveEnd > 0.0f) {
-                    if (m_state.loop) {
-                        // Loop back to start
-                        m_state.currentBeat = m_state.loopStart;
-                        allNotesOff();
-                    } else {
-                        // Stop playback when last note ends
-                        m_state.isPlaying = false;
-                        m_state.currentBeat = effectiveEnd;
-                        allNotesOff();
-                    }
-                }
-
-                // Process note events that occurred in this sample
-                processNoteEvents(prevBeat, m_state.currentBeat);
-            }
+        m_profiler.beginCallback();
 
-            // ============================================================
-            // Two-pass mix for sidechain support
-            // ============================================================
+        // Take queued commands before the snapshot: a snapshot published
+        // ahead of a command is then guaranteed to be picked up with it
+        drainCommands();
 
-            // Pass 1: Generate all channel samples (pre-sidechain)
-            std::array<float, MAX_CHANNELS> channelSamples = {};
+        // Pick up the latest published project snapshot
+        const ProjectSnapshot* snapshot = m_snapshots.acquire();
+        if (snapshot != m_snapshot) {
+            m_snapshot = snapshot;
+            m_seekPending = true;
             for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
-                channelSamples[ch] = m_synths[ch].process(m_state.currentTime);
+                m_synths[ch].setChannelWavetable(m_snapshot ? m_snapshot->settings.wavetables[ch].get() : nullptr);
             }
+        }
 
-            // Pass 2: Update sidechain envelopes and apply sidechain compression
-            for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
-                auto& fx = m_synths[ch].effects();
-                if (fx.sidechainEnabled && fx.sidechainSource >= 0 && fx.sidechainSource < MAX_CHANNELS) {
-                    // Update envelope from source channel
-                    fx.sidechain.updateEnvelope(channelSamples[fx.sidechainSource]);
-                    // Apply sidechain compression to this channel
-                    channelSamples[ch] = fx.sidechain.process(channelSamples[ch]);
-                }
-            }
+        // Follow tempo changes, keeping the current beat position
+        if (m_snapshot && m_snapshot->settings.tempo != m_tempo) {
+            const Tempo& tempo = m_snapshot->settings.tempo;
+            m_state.position = tempo.beatToFrame(m_tempo.frameToBeat(m_state.position));
+            m_tempo = tempo;
+        }
 
-            // Pass 3: Mix channels to stereo output
-            float left = 0.0f;
-            float right = 0.0f;
+        // Render between command timestamps, applying each before its frame
+        const int64_t blockStart = m_renderedFrames.load(std::memory_order_relaxed);
+        const int64_t blockEnd = blockStart + frameCount;
+        uint32_t done = 0;
+        while (done < frameCount) {
+            applyCommands(blockStart + done);
 
-            // Check for solo state once
-            bool hasSolo = false;
-            for (int c = 0; c < MAX_CHANNELS; ++c) {
-                if (m_project->channels[c].solo) {
-                    hasSolo = true;
-                    break;
-                }
+            uint32_t span = frameCount - done;
+            if (m_scheduledCount > 0 && m_scheduled[0].frame < blockEnd) {
+                span = static_cast<uint32_t>(m_scheduled[0].frame - (blockStart + done));
             }
 
-            for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
-                if (m_project->channels[ch].muted) continue;
-                if (hasSolo && !m_project->channels[ch].solo) continue;
-
-                float sample = channelSamples[ch];
-                float volume = m_project->channels[ch].volume;
-                float pan = m_project->channels[ch].pan;
-
-                // Pan law (constant power)
-                float leftGain = std::cos((pan + 1.0f) * 0.25f * PI) * volume;
-                float rightGain = std::sin((pan + 1.0f) * 0.25f * PI) * volume;
-
-                left += sample * leftGain;
-                right += sample * rightGain;
+            if (m_snapshot) {
+                renderSpan(leftOut + done, rightOut + done, span);
+            } else {
+                std::fill_n(leftOut + done, span, 0.0f);
+                std::fill_n(rightOut + done, span, 0.0f);
             }
+            done += span;
+        }
 
-            // Apply master volume and soft clip
-            float master = m_project->masterVolume;
-            left = std::tanh(left * master);
-            right = std::tanh(right * master);
+        // Publish the clock and display state for the UI thread
+        m_renderedFrames.store(blockEnd, std::memory_order_release);
+        m_displayPlaying.store(m_state.isPlaying, std::memory_order_relaxed);
+        m_displayBeat.store(static_cast<float>(m_tempo.frameToBeat(m_state.position)), std::memory_order_relaxed);
+        m_displayTime.store(static_cast<float>(songTime()), std::memory_order_relaxed);
+        m_displayVoices.store(m_voicePool.activeCount(), std::memory_order_relaxed);
 
-            leftOut[i] = left;
-            rightOut[i] = right;
-        }
+        m_profiler.endCallback(frameCount, m_sampleRate);
     }
 
     // ========================================================================
@@ -195,85 +252,278 @@ public:
     // ========================================================================
     void triggerNote(int channel, int note, float velocity) {
         if (channel >= 0 && channel < MAX_CHANNELS) {
-            m_synths[channel].noteOn(note, velocity, m_state.currentTime);
+            AudioCommand cmd = makeCommand(AudioCommandType::NoteOn);
+            cmd.data.noteEvent = {static_cast<uint8_t>(channel), static_cast<uint8_t>(note), velocity,
+                                  OscillatorType::Pulse, 0.0f};
+            schedule(cmd);
         }
     }
 
     void releaseNote(int channel, int note) {
         if (channel >= 0 && channel < MAX_CHANNELS) {
-            m_synths[channel].noteOff(note, m_state.currentTime);
+            AudioCommand cmd = makeCommand(AudioCommandType::NoteOff);
+            cmd.data.noteEvent = {static_cast<uint8_t>(channel), static_cast<uint8_t>(note), 0.0f,
+                                  OscillatorType::Pulse, 0.0f};
+            schedule(cmd);
         }
     }
 
     // Preview note with specific oscillator type (for sound preview when placing)
     void previewNote(int note, float velocity, OscillatorType oscType, float durationSec = 0.3f) {
-        // Use a dedicated preview channel (last channel)
-        const int previewChannel = MAX_CHANNELS - 1;
+        AudioCommand cmd = makeCommand(AudioCommandType::PreviewNote);
+        cmd.data.noteEvent = {static_cast<uint8_t>(MAX_CHANNELS - 1), static_cast<uint8_t>(note), velocity,
+                              oscType, durationSec};
+        schedule(cmd);
+    }
+
+    // ========================================================================
+    // Channel Access
+    // ========================================================================
+    const Synthesizer& getSynth(int channel) const {
+        return m_synths[channel % MAX_CHANNELS];
+    }
+
+    void updateChannelConfigs() {
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+            updateChannelConfig(ch);
+        }
+    }
+
+    // Send one channel's oscillator, envelope and effects settings
+    void updateChannelConfig(int channel) {
+        if (!m_project || channel < 0 || channel >= MAX_CHANNELS) return;
+        const auto& config = m_project->channels[channel];
+
+        AudioCommand cmd = makeCommand(AudioCommandType::SetChannelConfig);
+        ChannelSynthConfig& synth = cmd.data.channelConfig;
+        synth.channel = static_cast<uint8_t>(channel);
+        synth.oscillator = config.oscillator;
+        synth.envelope = config.envelope;
+        synth.effects = config.effects;
+        schedule(cmd);
+    }
+
+    // A channel's sidechain ducking as of the last rendered block
+    // (0 = none, 1 = full)
+    float sidechainGainReduction(int channel) const {
+        if (channel < 0 || channel >= MAX_CHANNELS) return 0.0f;
+        return m_displayGainReduction[channel].load(std::memory_order_relaxed);
+    }
+
+    // Oscillator and envelope for one channel's synth (live sound shaping)
+    void setSynthConfig(int channel, const OscillatorConfig& osc, const Envelope& env) {
+        if (channel < 0 || channel >= MAX_CHANNELS) return;
+
+        AudioCommand cmd = makeCommand(AudioCommandType::SetSynthConfig);
+        cmd.data.synthConfig = {static_cast<uint8_t>(channel), osc, env};
+        schedule(cmd);
+    }
+
+private:
+    // ========================================================================
+    // Internal Helpers
+    // ========================================================================
+    // A command stamped with the current engine time (next block start)
+    AudioCommand makeCommand(AudioCommandType type) const {
+        AudioCommand cmd;
+        cmd.type = type;
+        cmd.frame = renderedFrames();
+        return cmd;
+    }
+
+    // Move queued commands into the time-ordered schedule
+    void drainCommands() {
+        AudioCommand cmd;
+        while (m_scheduledCount < COMMAND_CAPACITY && m_commands.pop(cmd)) {
+            // Insert after everything due at or before it (keeps queue order)
+            size_t index = m_scheduledCount;
+            while (index > 0 && m_scheduled[index - 1].frame > cmd.frame) {
+                m_scheduled[index] = m_scheduled[index - 1];
+                --index;
+            }
+            m_scheduled[index] = cmd;
+            ++m_scheduledCount;
+        }
+    }
+
+    // Apply every scheduled command due at or before the given frame
+    void applyCommands(int64_t frame) {
+        size_t due = 0;
+        while (due < m_scheduledCount && m_scheduled[due].frame <= frame) {
+            applyCommand(m_scheduled[due]);
+            ++due;
+        }
+        if (due == 0) return;
+
+        std::copy(m_scheduled.begin() + due, m_scheduled.begin() + m_scheduledCount, m_scheduled.begin());
+        m_scheduledCount -= due;
+    }
+
+    void applyCommand(const AudioCommand& cmd) {
+        switch (cmd.type) {
+            case AudioCommandType::Play:
+                m_state.isPlaying = true;
+                break;
+
+            case AudioCommandType::Pause:
+                m_state.isPlaying = false;
+                break;
+
+            case AudioCommandType::Stop:
+                m_state.isPlaying = false;
+                m_state.position = 0;
+                m_state.elapsed = 0;
+                allNotesOff();
+                m_seekPending = true;
+                break;
+
+            case AudioCommandType::SetPosition:
+                m_state.position = m_tempo.beatToFrame(cmd.data.beat);
+                m_state.elapsed = m_state.position;
+                allNotesOff();
+                m_seekPending = true;
+                break;
+
+            case AudioCommandType::SetLoop:
+                m_state.loop = cmd.data.loop.enabled;
+                m_state.loopStart = cmd.data.loop.start;
+                m_state.loopEnd = cmd.data.loop.end;
+                break;
+
+            case AudioCommandType::SetLoopEnabled:
+                m_state.loop = cmd.data.enabled;
+                break;
+
+            case AudioCommandType::NoteOn: {
+                const NoteCommand& note = cmd.data.noteEvent;
+                m_synths[note.channel].noteOn(note.note, note.velocity, songTime());
+                break;
+            }
+
+            case AudioCommandType::NoteOff: {
+                const NoteCommand& note = cmd.data.noteEvent;
+                m_synths[note.channel].noteOff(note.note, songTime());
+                break;
+            }
+
+            case AudioCommandType::PreviewNote:
+                applyPreviewNote(cmd.data.noteEvent);
+                break;
+
+            case AudioCommandType::SetChannelConfig:
+                applyChannelConfig(cmd.data.channelConfig);
+                break;
+
+            case AudioCommandType::SetOversampleQuality:
+                for (auto& synth : m_synths) synth.effects().setOversampleQuality(cmd.data.oversampleQuality);
+                for (auto& clip : m_masterClip) clip.setQuality(cmd.data.oversampleQuality);
+                break;
+
+            case AudioCommandType::SetSynthConfig: {
+                const SynthConfigCommand& config = cmd.data.synthConfig;
+                m_synths[config.channel].setConfig(config.oscillator, config.envelope);
+                break;
+            }
+
+            default:
+                break;  // AudioEngine commands
+        }
+    }
+
+    void applyPreviewNote(const NoteCommand& preview) {
+        Synthesizer& synth = m_synths[preview.channel];
 
         // Stop any currently playing preview sounds first
-        m_synths[previewChannel].allNotesOff();
+        synth.allNotesOff();
 
         // For drums, use their natural duration
-        if (isDrumType(oscType)) {
-            durationSec = getDrumDecayTime(oscType) * 1.5f;
+        float durationSec = preview.durationSec;
+        if (isDrumType(preview.oscillatorType)) {
+            durationSec = getDrumDecayTime(preview.oscillatorType) * 1.5f;
         }
 
-        m_synths[previewChannel].noteOn(
-            note, velocity, m_state.currentTime,
+        synth.noteOn(
+            preview.note, preview.velocity, songTime(),
             0.0f,  // fadeIn
             0.05f, // fadeOut (short fade to avoid clicks)
             durationSec,
-            oscType
+            preview.oscillatorType
         );
     }
 
-    // ========================================================================
-    // Channel Access
-    // ========================================================================
-    Synthesizer& getSynth(int channel) {
-        return m_synths[channel % MAX_CHANNELS];
+    void applyChannelConfig(const ChannelSynthConfig& config) {
+        Synthesizer& synth = m_synths[config.channel];
+        synth.setConfig(config.oscillator, config.envelope);
+
+        // Reverb and delay are the shared aux buses, not in the chain
+        synth.effects().apply(config.effects);
     }
 
-    void updateChannelConfigs() {
-        if (!m_project) return;
+    // Render the transport for a span of frames with no commands inside it
+    void renderSpan(float* leftOut, float* rightOut, uint32_t frameCount) {
+        const Timeline& timeline = m_snapshot->timeline;
+        if (m_seekPending) {
+            m_cursor = timeline.seek(m_state.position);
+            m_seekPending = false;
+        }
 
-        for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
-            const auto& config = m_project->channels[ch];
-            m_synths[ch].setConfig(config.oscillator, config.envelope);
-
-            // Sync effect enables
-            auto& fx = m_synths[ch].effects();
-            fx.bitcrusherEnabled = config.bitcrusherEnabled;
-            fx.distortionEnabled = config.distortionEnabled;
-            fx.filterEnabled = config.filterEnabled;
-            fx.delayEnabled = config.delayEnabled;
-
-            // Sync genre effects (reverb, chorus, delay settings)
-            fx.reverbEnabled = config.reverbEnabled;
-            fx.reverb.mix = config.reverbMix;
-            fx.reverb.roomSize = config.reverbRoomSize;
-            fx.reverb.damping = config.reverbDamping;
-
-            fx.chorusEnabled = config.chorusEnabled;
-            fx.chorus.mix = config.chorusMix;
-            fx.chorus.rate = config.chorusRate;
-
-            // Extended delay settings
-            if (config.delayEnabled) {
-                fx.delay.mix = config.delayMix;
-                fx.delay.delayTime = config.delayTime;
-                fx.delay.feedback = config.delayFeedback;
+        // Get the actual end frame based on notes in the pattern
+        const int64_t endFrame = getPatternEndFrame();
+        const double secondsPerFrame = 1.0 / m_sampleRate;
+
+        // The span is rendered in runs of frames between transport events.
+        // Each frame advances the clock first and anything due on it is
+        // applied before it is rendered, so such a frame starts a new run.
+        uint32_t done = 0;
+        while (done < frameCount) {
+            if (!m_state.isPlaying) {
+                // Song time stands still while stopped
+                renderRun(leftOut + done, rightOut + done, frameCount - done, songTime(), 0.0);
+                break;
+            }
+
+            // Advance the clock to this frame
+            ++m_state.position;
+            ++m_state.elapsed;
+
+            // Handle looping or stop at end of last note
+            if (endFrame > 0 && m_state.position >= endFrame) {
+                if (m_state.loop) {
+                    // Loop back to start
+                    m_state.position = m_tempo.beatToFrame(m_state.loopStart);
+                } else {
+                    // Stop playback when last note ends
+                    m_state.isPlaying = false;
+                    m_state.position = endFrame;
+                }
+                allNotesOff();
+                m_cursor = timeline.seek(m_state.position);
+                if (!m_state.isPlaying) continue;
+            }
+
+            // Fire the events that occurred in this frame
+            processNoteEvents(m_state.position);
+
+            // Frames until the next event or the end, this one included
+            int64_t run = frameCount - done;
+            if (m_cursor < timeline.size()) {
+                run = std::min(run, timeline[m_cursor].frame - m_state.position + 1);
+            }
+            if (endFrame > 0) {
+                run = std::min(run, endFrame - m_state.position);
             }
+            uint32_t n = static_cast<uint32_t>(std::max<int64_t>(run, 1));
+
+            renderRun(leftOut + done, rightOut + done, n, songTime(), secondsPerFrame);
+            m_state.position += n - 1;
+            m_state.elapsed += n - 1;
+            done += n;
         }
     }
 
-private:
-    // ========================================================================
-    // Internal Helpers
-    // ========================================================================
-    float beatToTime(float beat) const {
-        if (!m_project) return 0.0f;
-        return beat * 60.0f / m_project->bpm;
+    // Song time in seconds, exact from the frame clock
+    double songTime() const {
+        return static_cast<double>(m_state.elapsed) / m_sampleRate;
     }
 
     void allNotesOff() {
@@ -282,182 +532,330 @@ private:
         }
     }
 
-    void processNoteEvents(float fromBeat, float toBeat) {
-        if (!m_project) return;
-
-        // Check all clips in arrangement
-        for (const auto& clip : m_project->arrangement) {
-            if (clip.patternIndex < 0 ||
-                clip.patternIndex >= static_cast<int>(m_project->patterns.size())) {
+    // Render and mix a run of frames with no transport events inside it
+    void renderRun(float* leftOut, float* rightOut, uint32_t frameCount, double time, double timeStep) {
+        while (frameCount > 0) {
+            uint32_t n = std::min(frameCount, RENDER_BLOCK_SIZE);
+
+            // Every channel and bus asleep: silence, without waking the
+            // render workers, until a note on wakes a channel
+            if (engineAsleep()) {
+                std::fill_n(leftOut, n, 0.0f);
+                std::fill_n(rightOut, n, 0.0f);
+                sleepSidechains(n);
+                time += timeStep * n;
+                leftOut += n;
+                rightOut += n;
+                frameCount -= n;
                 continue;
             }
 
-            const auto& pattern = m_project->patterns[clip.patternIndex];
+            // Passes 1 and 2: channel synths, then sidechain compression,
+            // run as a task graph (joins before the mix)
+            updateRenderGraph();
+            m_taskFrames = n;
+            m_taskTime = time;
+            m_taskTimeStep = timeStep;
+            m_graph.execute(&Sequencer::runRenderTask, this, n >= PARALLEL_MIN_FRAMES);
 
-            // Check if this clip is active in current beat range
-            float clipEnd = clip.startBeat + clip.lengthBeats;
-            if (toBeat < clip.startBeat || fromBeat > clipEnd) {
-                continue;
-            }
+            // Pass 3: Mix channels to stereo output
+            const int64_t mixStart = m_profiler.isTimingMix() ? profileNow() : 0;
+            const PlaybackSettings& settings = m_snapshot->settings;
 
-            // Process notes in this pattern
-            for (const auto& note : pattern.notes) {
-                float noteAbsStart = clip.startBeat + note.startTime;
-                float noteAbsEnd = noteAbsStart + note.duration;
-
-                // Note on
-                if (noteAbsStart >= fromBeat && noteAbsStart < toBeat) {
-                    // Convert fade times from beats to seconds
-                    float fadeInSec = beatsToSeconds(note.fadeIn);
-                    float fadeOutSec = beatsToSeconds(note.fadeOut);
-                    float durationSec = beatsToSeconds(note.duration);
-
-                    m_synths[clip.channelIndex].noteOn(
-                        note.pitch, note.velocity, m_state.currentTime,
-                        fadeInSec, fadeOutSec, durationSec, note.oscillatorType,
-                        note.vibrato, note.arpeggio, note.slide,
-                        note.dutyCycle, note.useDutyCycle,
-                        note.sweepDirection, note.sweepSpeed, note.sweepAmount,
-                        note.tremolo, note.tremoloSpeed);
+            // Check for solo state once
+            bool hasSolo = false;
+            for (int c = 0; c < MAX_CHANNELS; ++c) {
+                if (settings.channels[c].solo) {
+                    hasSolo = true;
+                    break;
                 }
+            }
 
-                // Note off
-                if (noteAbsEnd >= fromBeat && noteAbsEnd < toBeat) {
-                    m_synths[clip.channelIndex].noteOff(
-                        note.pitch, m_state.currentTime);
-                }
+            // Pan law (constant power), once per run
+            std::array<int, MAX_CHANNELS> mixChannels;
+            std::array<float, MAX_CHANNELS> leftGains;
+            std::array<float, MAX_CHANNELS> rightGains;
+            std::array<float, MAX_CHANNELS> reverbSends;
+            std::array<float, MAX_CHANNELS> delaySends;
+            int mixCount = 0;
+            bool reverbActive = false;
+            bool delayActive = false;
+            for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+                if (settings.channels[ch].muted) continue;
+                if (hasSolo && !settings.channels[ch].solo) continue;
+                if (m_synths[ch].isAsleep()) continue;     // Silent buffer
+
+                float volume = settings.channels[ch].volume;
+                float pan = settings.channels[ch].pan;
+                mixChannels[mixCount] = ch;
+                leftGains[mixCount] = fastCos((pan + 1.0f) * 0.25f * PI) * volume;
+                rightGains[mixCount] = fastSin((pan + 1.0f) * 0.25f * PI) * volume;
+
+                // Sends are post-fader, pre-pan
+                reverbSends[mixCount] = settings.channels[ch].reverbSend * volume;
+                delaySends[mixCount] = settings.channels[ch].delaySend * volume;
+                reverbActive |= reverbSends[mixCount] > 0.0f;
+                delayActive |= delaySends[mixCount] > 0.0f;
+                ++mixCount;
             }
-        }
 
-        // Also check pattern preview (current selected pattern, not on timeline)
-        if (m_previewPattern >= 0 &&
-            m_previewPattern < static_cast<int>(m_project->patterns.size())) {
+            for (uint32_t i = 0; i < n; ++i) {
+                float left = 0.0f;
+                float right = 0.0f;
+                for (int m = 0; m < mixCount; ++m) {
+                    float sample = m_channelBuffers[mixChannels[m]][i];
+                    left += sample * leftGains[m];
+                    right += sample * rightGains[m];
+                }
+                leftOut[i] = left;
+                rightOut[i] = right;
+            }
+            if (m_profiler.isTimingMix()) m_profiler.addMix(profileNow() - mixStart);
+
+            // Pass 4: aux buses, each run once for all the channels sending
+            // to it, and on until its tail has died away
+            const bool reverbAwake = reverbActive || !m_reverbAsleep;
+            const bool delayAwake = delayActive || !m_delayAsleep;
+            if (reverbAwake || delayAwake) {
+                const int64_t auxStart = m_profiler.isTimingMix() ? profileNow() : 0;
+                if (reverbAwake) {
+                    sumSends(m_reverbSend.data(), reverbSends, mixChannels, mixCount, n);
+                    const float inputPeak = SilenceDetector::peak(m_reverbSend.data(), n);
+                    m_reverbBus.roomSize = settings.aux.reverbRoomSize;
+                    m_reverbBus.damping = settings.aux.reverbDamping;
+                    m_reverbBus.processStereoBlock(m_reverbSend.data(), m_auxLeft.data(), m_auxRight.data(), n);
+                    const float gain = settings.aux.reverbReturn * AUX_RETURN_GAIN;
+                    for (uint32_t i = 0; i < n; ++i) {
+                        leftOut[i] += m_auxLeft[i] * gain;
+                        rightOut[i] += m_auxRight[i] * gain;
+                    }
+                    m_reverbSilence.update(std::max({inputPeak, SilenceDetector::peak(m_auxLeft.data(), n),
+                                                     SilenceDetector::peak(m_auxRight.data(), n)}), n);
+                    m_reverbAsleep = !reverbActive && m_reverbSilence.silentFor(m_sleepFrames);
+                }
+                if (delayAwake) {
+                    sumSends(m_delaySend.data(), delaySends, mixChannels, mixCount, n);
+                    const float inputPeak = SilenceDetector::peak(m_delaySend.data(), n);
+                    m_delayBus.delayTime = settings.aux.delayTime;
+                    m_delayBus.feedback = settings.aux.delayFeedback;
+                    m_delayBus.processBlock(m_delaySend.data(), n);
+                    const float gain = settings.aux.delayReturn * AUX_RETURN_GAIN;
+                    for (uint32_t i = 0; i < n; ++i) {
+                        const float wet = m_delaySend[i] * gain;
+                        leftOut[i] += wet;
+                        rightOut[i] += wet;
+                    }
 
-            const auto& pattern = m_project->patterns[m_previewPattern];
+                    // Input and output silent for a whole delay line longer
+                    // than the hold: nothing is left in the line to come back
+                    m_delaySilence.update(std::max(inputPeak, SilenceDetector::peak(m_delaySend.data(), n)), n);
+                    const auto delayFrames = static_cast<uint32_t>(Delay::MAX_DELAY_SAMPLES);
+                    m_delayAsleep = !delayActive && m_delaySilence.silentFor(m_sleepFrames + delayFrames);
+                }
+                if (m_profiler.isTimingMix()) m_profiler.addAux(profileNow() - auxStart);
+            }
 
-            // Use actual note extent for loop length, not fixed pattern.length
-            // This ensures notes placed beyond the original pattern boundary still play
-            float actualNoteExtent = getPatternEndTime();
-            float loopLength = (actualNoteExtent > 0.0f) ? actualNoteExtent : static_cast<float>(pattern.length);
+            // Master volume and soft clip, oversampled if the project asks
+            const int64_t clipStart = m_profiler.isTimingMix() ? profileNow() : 0;
+            const float master = settings.masterVolume;
+            auto softClip = [master](float* block, uint32_t count) {
+                const SimdFloat masterGain(master);
+                uint32_t i = 0;
+                for (; i + SIMD_LANES <= count; i += SIMD_LANES) {
+                    fastTanh(SimdFloat::load(block + i) * masterGain).store(block + i);
+                }
+                for (; i < count; ++i) block[i] = fastTanh(block[i] * master);
+            };
+            m_masterClip[0].process(leftOut, n, settings.masterOversampling, softClip);
+            m_masterClip[1].process(rightOut, n, settings.masterOversampling, softClip);
+            if (m_profiler.isTimingMix()) m_profiler.addMix(profileNow() - clipStart);
+
+            time += timeStep * n;
+            leftOut += n;
+            rightOut += n;
+            frameCount -= n;
+        }
+    }
 
-            // Wrap beat position for pattern preview (only when looping)
-            float localFrom, localTo;
-            if (m_state.loop && loopLength > 0.0f) {
-                localFrom = std::fmod(fromBeat, loopLength);
-                localTo = std::fmod(toBeat, loopLength);
-            } else {
-                // Non-looping: use raw beat positions so notes beyond original length play
-                localFrom = fromBeat;
-                localTo = toBeat;
-            }
+    bool engineAsleep() const {
+        if (!m_reverbAsleep || !m_delayAsleep) return false;
+        for (const auto& synth : m_synths) {
+            if (!synth.isAsleep()) return false;
+        }
+        return true;
+    }
 
-            // Handle wrap-around
-            if (localTo < localFrom) {
-                processPatternNotes(pattern, localFrom, loopLength);
-                processPatternNotes(pattern, 0.0f, localTo);
-            } else {
-                processPatternNotes(pattern, localFrom, localTo);
-            }
+    // Sidechain envelopes release while the whole engine sleeps, as they
+    // would following a silent source
+    void sleepSidechains(uint32_t n) {
+        for (auto& synth : m_synths) {
+            if (synth.effects().sidechainEnabled) synth.effects().sidechain.releaseEnvelope(n);
         }
     }
 
-    void processPatternNotes(const Pattern& pattern, float fromBeat, float toBeat) {
-        for (const auto& note : pattern.notes) {
-            // Apply swing to note start time
-            float swungStart = applySwing(note.startTime);
+    // One aux bus's input: every mixed channel at its send level
+    void sumSends(float* out, const std::array<float, MAX_CHANNELS>& sends,
+                  const std::array<int, MAX_CHANNELS>& mixChannels, int mixCount, uint32_t n) {
+        std::fill(out, out + n, 0.0f);
+        for (int m = 0; m < mixCount; ++m) {
+            if (sends[m] <= 0.0f) continue;
+            const float* in = m_channelBuffers[mixChannels[m]].data();
+            for (uint32_t i = 0; i < n; ++i) out[i] += in[i] * sends[m];
+        }
+    }
 
-            // Note on
-            if (swungStart >= fromBeat && swungStart < toBeat) {
-                // Convert fade times from beats to seconds
-                float fadeInSec = beatsToSeconds(note.fadeIn);
-                float fadeOutSec = beatsToSeconds(note.fadeOut);
-                float durationSec = beatsToSeconds(note.duration);
+    // ========================================================================
+    // Render Graph
+    // ========================================================================
+    // Source channel of each channel's sidechain (-1 when off)
+    std::array<int, MAX_CHANNELS> sidechainSources() const {
+        std::array<int, MAX_CHANNELS> sources;
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+            const auto& fx = m_synths[ch].effects();
+            bool valid = fx.sidechainEnabled && fx.sidechainSource >= 0 && fx.sidechainSource < MAX_CHANNELS;
+            sources[ch] = valid ? fx.sidechainSource : -1;
+        }
+        return sources;
+    }
 
-                // Apply humanize
-                float startTime = m_state.currentTime;
-                float velocity = note.velocity;
-                applyHumanize(startTime, velocity);
+    // Rebuild the task graph when the sidechain routing has changed.
+    // One synth task per channel, then one sidechain task per sidechained
+    // channel. A sidechain task waits for its own and its source's synth;
+    // two sidechain tasks where either reads the other's channel run in
+    // channel order, which matches the original per-sample channel loop.
+    void updateRenderGraph() {
+        const auto sources = sidechainSources();
+        if (m_graph.taskCount() > 0 && sources == m_graphSources) return;
+        m_graphSources = sources;
+
+        m_graph.clear();
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+            m_graph.addTask(ch);
+        }
 
-                m_synths[m_previewChannel].noteOn(
-                    note.pitch, velocity, startTime,
-                    fadeInSec, fadeOutSec, durationSec, note.oscillatorType,
-                    note.vibrato, note.arpeggio, note.slide,
-                    note.dutyCycle, note.useDutyCycle,
-                    note.sweepDirection, note.sweepSpeed, note.sweepAmount,
-                    note.tremolo, note.tremoloSpeed);
+        std::array<int, MAX_CHANNELS> sidechainTask;
+        sidechainTask.fill(-1);
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+            if (sources[ch] < 0) continue;
+
+            int task = m_graph.addTask(MAX_CHANNELS + ch);
+            m_graph.addEdge(ch, task);
+            m_graph.addEdge(sources[ch], task);
+            for (int other = 0; other < ch; ++other) {
+                if (sidechainTask[other] >= 0 && (sources[ch] == other || sources[other] == ch)) {
+                    m_graph.addEdge(sidechainTask[other], task);
+                }
             }
+            sidechainTask[ch] = task;
+        }
+    }
 
-            // Note off (also swing the end time)
-            float noteEnd = applySwing(note.startTime) + note.duration;
-            if (noteEnd >= fromBeat && noteEnd < toBeat) {
-                m_synths[m_previewChannel].noteOff(note.pitch, m_state.currentTime);
-            }
+    static void runRenderTask(void* context, int payload) {
+        auto* self = static_cast<Sequencer*>(context);
+        if (payload < MAX_CHANNELS) {
+            self->renderChannel(payload);
+        } else {
+            self->applySidechain(payload - MAX_CHANNELS);
         }
     }
 
-    // Convert beats to seconds based on current BPM
-    float beatsToSeconds(float beats) const {
-        if (!m_project || m_project->bpm <= 0.0f) return 0.0f;
-        return beats * 60.0f / m_project->bpm;
+    // Pass 1: Generate one channel buffer (pre-sidechain)
+    void renderChannel(int ch) {
+        m_synths[ch].process(m_channelBuffers[ch].data(), m_taskFrames, m_taskTime, m_taskTimeStep,
+                             m_profiler.channel(ch));
+    }
+
+    // Pass 2: Update a channel's sidechain envelope and apply compression
+    void applySidechain(int ch) {
+        ChannelProfile* profile = m_profiler.channel(ch);
+        const int64_t start = profile ? profileNow() : 0;
+
+        auto& fx = m_synths[ch].effects();
+        if (m_synths[ch].isAsleep() && m_synths[m_graphSources[ch]].isAsleep()) {
+            // Silent source and nothing to duck
+            fx.sidechain.releaseEnvelope(m_taskFrames);
+        } else {
+            const float* source = m_channelBuffers[m_graphSources[ch]].data();
+            fx.sidechain.processBlock(m_channelBuffers[ch].data(), source, m_taskFrames);
+        }
+        m_displayGainReduction[ch].store(fx.sidechain.getGainReduction(), std::memory_order_relaxed);
+        if (profile) profile->addEffect(ProfileEffect::Sidechain, profileNow() - start);
     }
 
-    // Apply swing to a beat position
-    // Swing shifts off-beat notes forward in time (e.g., 8th note upbeats)
-    float applySwing(float beat) const {
-        if (!m_project || m_project->swing <= 0.0f) return beat;
+    // Fire every timeline event before the given frame, advancing the cursor
+    void processNoteEvents(int64_t toFrame) {
+        const Timeline& timeline = m_snapshot->timeline;
+        while (m_cursor < timeline.size() && timeline[m_cursor].frame < toFrame) {
+            const TimelineEvent& event = timeline[m_cursor++];
+            const Note& note = timeline.note(event);
+            Synthesizer& synth = m_synths[event.channel];
+
+            if (!event.noteOn) {
+                synth.noteOff(note.pitch, songTime());
+                continue;
+            }
 
-        float grid = m_project->swingGrid;  // e.g., 0.5 for 8th notes
-        float swing = m_project->swing;     // 0.0 to 1.0
+            // Convert fade times from beats to seconds
+            float fadeInSec = beatsToSeconds(note.fadeIn);
+            float fadeOutSec = beatsToSeconds(note.fadeOut);
+            float durationSec = beatsToSeconds(note.duration);
 
-        // Find position within the grid
-        float gridPos = std::fmod(beat, grid * 2.0f);
+            // Apply humanize to pattern preview notes
+            double startTime = songTime();
+            float velocity = note.velocity;
+            if (event.preview) {
+                applyHumanize(startTime, velocity);
+            }
 
-        // Check if this is an off-beat (second half of the pair)
-        if (gridPos >= grid - 0.001f && gridPos < grid * 2.0f - 0.001f) {
-            // This is an off-beat - shift it forward
-            // Maximum swing (1.0) creates triplet feel (shift by grid/3)
-            float swingOffset = grid * swing * 0.333f;
-            float basePos = std::floor(beat / grid) * grid;
-            float offBeatStart = basePos + grid;
-            return offBeatStart + swingOffset;
+            synth.noteOn(
+                note.pitch, velocity, startTime,
+                fadeInSec, fadeOutSec, durationSec, note.oscillatorType,
+                note.vibrato, note.arpeggio, note.slide,
+                note.dutyCycle, note.useDutyCycle,
+                note.sweepDirection, note.sweepSpeed, note.sweepAmount,
+                note.tremolo, note.tremoloSpeed);
         }
+    }
 
-        return beat;
+    // Convert beats to seconds based on current BPM
+    float beatsToSeconds(float beats) const {
+        float bpm = m_snapshot->settings.bpm;
+        if (bpm <= 0.0f) return 0.0f;
+        return beats * 60.0f / bpm;
     }
 
     // Apply humanize (random timing/velocity variation)
-    void applyHumanize(float& startTime, float& velocity) const {
-        if (!m_project || !m_project->humanize) return;
+    void applyHumanize(double& startTime, float& velocity) {
+        const PlaybackSettings& settings = m_snapshot->settings;
+        if (!settings.humanize) return;
 
         // Add random timing variation
-        float timeVariation = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 2.0f;
-        startTime += timeVariation * m_project->humanizeAmount;
+        float timeVariation = randomBipolar();
+        startTime += timeVariation * settings.humanizeAmount;
 
         // Add random velocity variation
-        float velVariation = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 2.0f;
-        velocity = std::max(0.1f, std::min(1.0f, velocity + velVariation * m_project->humanizeVelocity));
+        float velVariation = randomBipolar();
+        velocity = std::max(0.1f, std::min(1.0f, velocity + velVariation * settings.humanizeVelocity));
     }
 
-    // Calculate when the last note in the pattern ends
-    float getPatternEndTime() const {
-        if (!m_project || m_previewPattern < 0 ||
-            m_previewPattern >= static_cast<int>(m_project->patterns.size())) {
-            return m_state.loopEnd;  // Fallback to fixed loop end
-        }
-
-        const Pattern& pattern = m_project->patterns[m_previewPattern];
-        if (pattern.notes.empty()) {
-            return 0.0f;  // No notes, end immediately
-        }
+    // Uniform in [-1, 1] (per sequencer, so engines in one process do not
+    // share the C library's generator)
+    float randomBipolar() {
+        // xorshift32
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 17;
+        m_randomState ^= m_randomState << 5;
+        return static_cast<float>(m_randomState >> 8) * (2.0f / 16777215.0f) - 1.0f;
+    }
 
-        float maxEndTime = 0.0f;
-        for (const Note& note : pattern.notes) {
-            float noteEnd = note.startTime + note.duration;
-            if (noteEnd > maxEndTime) {
-                maxEndTime = noteEnd;
-            }
+    // Frame where the last note in the preview pattern ends (from its
+    // metadata, captured when the timeline was built)
+    int64_t getPatternEndFrame() const {
+        const Timeline& timeline = m_snapshot->timeline;
+        if (!timeline.hasPreview()) {
+            return m_tempo.beatToFrame(m_state.loopEnd);  // Fallback to fixed loop end
         }
-        return maxEndTime;
+        return timeline.previewEnd();  // 0 with no notes: end immediately
     }
 
 public:
@@ -470,16 +868,85 @@ public:
         m_previewPattern = -1;
     }
 
+    int previewPattern() const { return m_previewPattern; }
+    int previewChannel() const { return m_previewChannel; }
+
 private:
     float m_sampleRate = 44100.0f;
     Project* m_project = nullptr;
     PlaybackState m_state;
 
+    VoicePool m_voicePool;
     std::array<Synthesizer, MAX_CHANNELS> m_synths;
 
+    // Per-channel scratch buffers for block rendering
+    static constexpr uint32_t RENDER_BLOCK_SIZE = 256;
+    std::array<std::array<float, RENDER_BLOCK_SIZE>, MAX_CHANNELS> m_channelBuffers = {};
+
+    // Shared reverb and delay, fed by the channels' aux sends. Returns come
+    // back at the gain of a center-panned channel.
+    static constexpr float AUX_RETURN_GAIN = 0.70710678f;
+    Reverb m_reverbBus;
+    Delay m_delayBus;
+    std::array<float, RENDER_BLOCK_SIZE> m_reverbSend = {};
+    std::array<float, RENDER_BLOCK_SIZE> m_delaySend = {};
+    std::array<float, RENDER_BLOCK_SIZE> m_auxLeft = {};
+    std::array<float, RENDER_BLOCK_SIZE> m_auxRight = {};
+
+    // Buses sleep like channels (see Synthesizer::isAsleep)
+    SilenceDetector m_reverbSilence;
+    SilenceDetector m_delaySilence;
+    uint32_t m_sleepFrames = 0;
+    bool m_reverbAsleep = true;
+    bool m_delayAsleep = true;
+
+    // Master soft clip, left and right
+    std::array<Oversampler, 2> m_masterClip;
+
     // Pattern preview mode
     int m_previewPattern = -1;
     int m_previewChannel = 0;
+
+    // Tempo the transport clock is currently counting in
+    Tempo m_tempo;
+
+    // Humanize random source
+    uint32_t m_randomState = 0x9E3779B9u;
+
+    // Channel render tasks and the sub-block they are rendering
+    static constexpr uint32_t PARALLEL_MIN_FRAMES = 32;
+    RenderGraph m_graph;
+    std::array<int, MAX_CHANNELS> m_graphSources = {};
+    uint32_t m_taskFrames = 0;
+    double m_taskTime = 0.0;
+    double m_taskTimeStep = 0.0;
+
+    // Commands from the UI thread, and those waiting for their frame
+    static constexpr size_t COMMAND_CAPACITY = 256;
+    LockFreeRingBuffer<AudioCommand, COMMAND_CAPACITY> m_commands;
+    std::array<AudioCommand, COMMAND_CAPACITY> m_scheduled;
+    size_t m_scheduledCount = 0;
+    std::atomic<int64_t> m_renderedFrames{0};
+
+    // Display state (updated by audio thread, read by UI)
+    std::atomic<bool> m_displayPlaying{false};
+    std::atomic<float> m_displayBeat{0.0f};
+    std::atomic<float> m_displayTime{0.0f};
+    std::atomic<int> m_displayVoices{0};
+    std::array<std::atomic<float>, MAX_CHANNELS> m_displayGainReduction{};
+
+    // Render timings for the UI thread
+    AudioProfiler m_profiler;
+
+    // Loop settings as last requested by the UI thread
+    LoopCommand m_loop{true, 0.0f, 16.0f};
+
+    // Project snapshots from the UI thread; m_snapshot is the one the
+    // audio thread is playing, and m_cursor indexes into its timeline
+    SnapshotExchange m_snapshots;
+    const ProjectSnapshot* m_snapshot = nullptr;
+    size_t m_cursor = 0;
+    bool m_seekPending = true;
 };
 
 } // namespace ChiptuneTracker
@@ -0,0 +1,308 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - SIMD
+ *
+ * A minimal float vector for code that processes several voices (or
+ * channels) side by side: AVX (8 lanes) when the compiler targets it,
+ * SSE2 or NEON (4 lanes), or plain arrays elsewhere. Only the operations
+ * the engine needs are provided. Comparisons return a mask used by
+ * select(); simdMaskFirst(n) sets only the first n lanes. simdExp2i(n)
+ * builds 2^n from integer-valued lanes (n in [-126, 127]).
+ */
+
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define CHIPTUNE_SIMD_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CHIPTUNE_SIMD_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define CHIPTUNE_SIMD_NEON 1
+#endif
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// AVX - 8 lanes
+// ============================================================================
+#if defined(CHIPTUNE_SIMD_AVX)
+
+constexpr int SIMD_LANES = 8;
+
+struct SimdMask {
+    __m256 v;
+    SimdMask operator&(SimdMask o) const { return {_mm256_and_ps(v, o.v)}; }
+    SimdMask operator|(SimdMask o) const { return {_mm256_or_ps(v, o.v)}; }
+    SimdMask andNot(SimdMask o) const { return {_mm256_andnot_ps(o.v, v)}; }  // this & ~o
+    bool any() const { return _mm256_movemask_ps(v) != 0; }
+    bool lane(int i) const { return (_mm256_movemask_ps(v) >> i) & 1; }
+};
+
+struct SimdFloat {
+    __m256 v;
+
+    SimdFloat() = default;
+    SimdFloat(__m256 x) : v(x) {}
+    SimdFloat(float x) : v(_mm256_set1_ps(x)) {}
+
+    static SimdFloat load(const float* p) { return {_mm256_loadu_ps(p)}; }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+
+    SimdFloat operator+(SimdFloat o) const { return {_mm256_add_ps(v, o.v)}; }
+    SimdFloat operator-(SimdFloat o) const { return {_mm256_sub_ps(v, o.v)}; }
+    SimdFloat operator*(SimdFloat o) const { return {_mm256_mul_ps(v, o.v)}; }
+    SimdFloat operator/(SimdFloat o) const { return {_mm256_div_ps(v, o.v)}; }
+
+    SimdMask operator<(SimdFloat o) const { return {_mm256_cmp_ps(v, o.v, _CMP_LT_OQ)}; }
+    SimdMask operator>(SimdFloat o) const { return {_mm256_cmp_ps(v, o.v, _CMP_GT_OQ)}; }
+    SimdMask operator>=(SimdFloat o) const { return {_mm256_cmp_ps(v, o.v, _CMP_GE_OQ)}; }
+    SimdMask operator==(SimdFloat o) const { return {_mm256_cmp_ps(v, o.v, _CMP_EQ_OQ)}; }
+    SimdMask operator!=(SimdFloat o) const { return {_mm256_cmp_ps(v, o.v, _CMP_NEQ_UQ)}; }
+
+    // Sum of all lanes
+    float sum() const {
+        __m128 x = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+        x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+};
+
+inline SimdFloat select(SimdMask mask, SimdFloat a, SimdFloat b) {
+    return {_mm256_blendv_ps(b.v, a.v, mask.v)};
+}
+
+inline SimdMask simdMaskFirst(int lanes) {
+    alignas(32) static const int32_t bits[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+    return {_mm256_loadu_ps(reinterpret_cast<const float*>(bits + 8 - lanes))};
+}
+
+inline SimdFloat simdMin(SimdFloat a, SimdFloat b) { return {_mm256_min_ps(a.v, b.v)}; }
+inline SimdFloat simdMax(SimdFloat a, SimdFloat b) { return {_mm256_max_ps(a.v, b.v)}; }
+inline SimdFloat simdFloor(SimdFloat x) { return {_mm256_floor_ps(x.v)}; }
+
+inline SimdFloat simdExp2i(SimdFloat n) {
+    // (n + 127) << 23 without AVX2 integer ops: scale, then convert exactly
+    const __m256 biased = _mm256_mul_ps(_mm256_add_ps(n.v, _mm256_set1_ps(127.0f)), _mm256_set1_ps(8388608.0f));
+    return {_mm256_castsi256_ps(_mm256_cvtps_epi32(biased))};
+}
+
+// ============================================================================
+// SSE2 - 4 lanes
+// ============================================================================
+#elif defined(CHIPTUNE_SIMD_SSE2)
+
+constexpr int SIMD_LANES = 4;
+
+struct SimdMask {
+    __m128 v;
+    SimdMask operator&(SimdMask o) const { return {_mm_and_ps(v, o.v)}; }
+    SimdMask operator|(SimdMask o) const { return {_mm_or_ps(v, o.v)}; }
+    SimdMask andNot(SimdMask o) const { return {_mm_andnot_ps(o.v, v)}; }  // this & ~o
+    bool any() const { return _mm_movemask_ps(v) != 0; }
+    bool lane(int i) const { return (_mm_movemask_ps(v) >> i) & 1; }
+};
+
+struct SimdFloat {
+    __m128 v;
+
+    SimdFloat() = default;
+    SimdFloat(__m128 x) : v(x) {}
+    SimdFloat(float x) : v(_mm_set1_ps(x)) {}
+
+    static SimdFloat load(const float* p) { return {_mm_loadu_ps(p)}; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+
+    SimdFloat operator+(SimdFloat o) const { return {_mm_add_ps(v, o.v)}; }
+    SimdFloat operator-(SimdFloat o) const { return {_mm_sub_ps(v, o.v)}; }
+    SimdFloat operator*(SimdFloat o) const { return {_mm_mul_ps(v, o.v)}; }
+    SimdFloat operator/(SimdFloat o) const { return {_mm_div_ps(v, o.v)}; }
+
+    SimdMask operator<(SimdFloat o) const { return {_mm_cmplt_ps(v, o.v)}; }
+    SimdMask operator>(SimdFloat o) const { return {_mm_cmpgt_ps(v, o.v)}; }
+    SimdMask operator>=(SimdFloat o) const { return {_mm_cmpge_ps(v, o.v)}; }
+    SimdMask operator==(SimdFloat o) const { return {_mm_cmpeq_ps(v, o.v)}; }
+    SimdMask operator!=(SimdFloat o) const { return {_mm_cmpneq_ps(v, o.v)}; }
+
+    // Sum of all lanes
+    float sum() const {
+        __m128 x = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 1));
+        return _mm_cvtss_f32(x);
+    }
+};
+
+inline SimdFloat select(SimdMask mask, SimdFloat a, SimdFloat b) {
+    return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+}
+
+inline SimdMask simdMaskFirst(int lanes) {
+    alignas(16) static const int32_t bits[8] = {-1, -1, -1, -1, 0, 0, 0, 0};
+    return {_mm_loadu_ps(reinterpret_cast<const float*>(bits + 4 - lanes))};
+}
+
+inline SimdFloat simdMin(SimdFloat a, SimdFloat b) { return {_mm_min_ps(a.v, b.v)}; }
+inline SimdFloat simdMax(SimdFloat a, SimdFloat b) { return {_mm_max_ps(a.v, b.v)}; }
+
+inline SimdFloat simdFloor(SimdFloat x) {
+    // Truncate, then step down where that rounded up (negative inputs)
+    const __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x.v));
+    return {_mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x.v), _mm_set1_ps(1.0f)))};
+}
+
+inline SimdFloat simdExp2i(SimdFloat n) {
+    const __m128i biased = _mm_add_epi32(_mm_cvttps_epi32(n.v), _mm_set1_epi32(127));
+    return {_mm_castsi128_ps(_mm_slli_epi32(biased, 23))};
+}
+
+// ============================================================================
+// NEON - 4 lanes
+// ============================================================================
+#elif defined(CHIPTUNE_SIMD_NEON)
+
+constexpr int SIMD_LANES = 4;
+
+struct SimdMask {
+    uint32x4_t v;
+    SimdMask operator&(SimdMask o) const { return {vandq_u32(v, o.v)}; }
+    SimdMask operator|(SimdMask o) const { return {vorrq_u32(v, o.v)}; }
+    SimdMask andNot(SimdMask o) const { return {vbicq_u32(v, o.v)}; }  // this & ~o
+    bool any() const { return vmaxvq_u32(v) != 0; }
+    bool lane(int i) const {
+        uint32_t bits[4];
+        vst1q_u32(bits, v);
+        return bits[i] != 0;
+    }
+};
+
+struct SimdFloat {
+    float32x4_t v;
+
+    SimdFloat() = default;
+    SimdFloat(float32x4_t x) : v(x) {}
+    SimdFloat(float x) : v(vdupq_n_f32(x)) {}
+
+    static SimdFloat load(const float* p) { return {vld1q_f32(p)}; }
+    void store(float* p) const { vst1q_f32(p, v); }
+
+    SimdFloat operator+(SimdFloat o) const { return {vaddq_f32(v, o.v)}; }
+    SimdFloat operator-(SimdFloat o) const { return {vsubq_f32(v, o.v)}; }
+    SimdFloat operator*(SimdFloat o) const { return {vmulq_f32(v, o.v)}; }
+    SimdFloat operator/(SimdFloat o) const { return {vdivq_f32(v, o.v)}; }
+
+    SimdMask operator<(SimdFloat o) const { return {vcltq_f32(v, o.v)}; }
+    SimdMask operator>(SimdFloat o) const { return {vcgtq_f32(v, o.v)}; }
+    SimdMask operator>=(SimdFloat o) const { return {vcgeq_f32(v, o.v)}; }
+    SimdMask operator==(SimdFloat o) const { return {vceqq_f32(v, o.v)}; }
+    SimdMask operator!=(SimdFloat o) const { return {vmvnq_u32(vceqq_f32(v, o.v))}; }
+
+    // Sum of all lanes
+    float sum() const { return vaddvq_f32(v); }
+};
+
+inline SimdFloat select(SimdMask mask, SimdFloat a, SimdFloat b) {
+    return {vbslq_f32(mask.v, a.v, b.v)};
+}
+
+inline SimdMask simdMaskFirst(int lanes) {
+    static const uint32_t bits[8] = {~0u, ~0u, ~0u, ~0u, 0, 0, 0, 0};
+    return {vld1q_u32(bits + 4 - lanes)};
+}
+
+inline SimdFloat simdMin(SimdFloat a, SimdFloat b) { return {vminq_f32(a.v, b.v)}; }
+inline SimdFloat simdMax(SimdFloat a, SimdFloat b) { return {vmaxq_f32(a.v, b.v)}; }
+inline SimdFloat simdFloor(SimdFloat x) { return {vrndmq_f32(x.v)}; }
+
+inline SimdFloat simdExp2i(SimdFloat n) {
+    const int32x4_t biased = vaddq_s32(vcvtq_s32_f32(n.v), vdupq_n_s32(127));
+    return {vreinterpretq_f32_s32(vshlq_n_s32(biased, 23))};
+}
+
+// ============================================================================
+// Scalar fallback - 4 lanes
+// ============================================================================
+#else
+
+constexpr int SIMD_LANES = 4;
+
+struct SimdMask {
+    bool v[4];
+    SimdMask operator&(SimdMask o) const { return {{v[0] && o.v[0], v[1] && o.v[1], v[2] && o.v[2], v[3] && o.v[3]}}; }
+    SimdMask operator|(SimdMask o) const { return {{v[0] || o.v[0], v[1] || o.v[1], v[2] || o.v[2], v[3] || o.v[3]}}; }
+    SimdMask andNot(SimdMask o) const { return {{v[0] && !o.v[0], v[1] && !o.v[1], v[2] && !o.v[2], v[3] && !o.v[3]}}; }
+    bool any() const { return v[0] || v[1] || v[2] || v[3]; }
+    bool lane(int i) const { return v[i]; }
+};
+
+struct SimdFloat {
+    float v[4];
+
+    SimdFloat() = default;
+    SimdFloat(float x) : v{x, x, x, x} {}
+
+    static SimdFloat load(const float* p) {
+        SimdFloat r;
+        for (int i = 0; i < 4; ++i) r.v[i] = p[i];
+        return r;
+    }
+    void store(float* p) const {
+        for (int i = 0; i < 4; ++i) p[i] = v[i];
+    }
+
+    template <typename Op>
+    SimdFloat map(SimdFloat o, Op op) const {
+        SimdFloat r;
+        for (int i = 0; i < 4; ++i) r.v[i] = op(v[i], o.v[i]);
+        return r;
+    }
+    template <typename Op>
+    SimdMask test(SimdFloat o, Op op) const {
+        SimdMask r;
+        for (int i = 0; i < 4; ++i) r.v[i] = op(v[i], o.v[i]);
+        return r;
+    }
+
+    SimdFloat operator+(SimdFloat o) const { return map(o, [](float a, float b) { return a + b; }); }
+    SimdFloat operator-(SimdFloat o) const { return map(o, [](float a, float b) { return a - b; }); }
+    SimdFloat operator*(SimdFloat o) const { return map(o, [](float a, float b) { return a * b; }); }
+    SimdFloat operator/(SimdFloat o) const { return map(o, [](float a, float b) { return a / b; }); }
+
+    SimdMask operator<(SimdFloat o) const { return test(o, [](float a, float b) { return a < b; }); }
+    SimdMask operator>(SimdFloat o) const { return test(o, [](float a, float b) { return a > b; }); }
+    SimdMask operator>=(SimdFloat o) const { return test(o, [](float a, float b) { return a >= b; }); }
+    SimdMask operator==(SimdFloat o) const { return test(o, [](float a, float b) { return a == b; }); }
+    SimdMask operator!=(SimdFloat o) const { return test(o, [](float a, float b) { return a != b; }); }
+
+    float sum() const { return (v[0] + v[1]) + (v[2] + v[3]); }
+};
+
+inline SimdFloat select(SimdMask mask, SimdFloat a, SimdFloat b) {
+    SimdFloat r;
+    for (int i = 0; i < 4; ++i) r.v[i] = mask.v[i] ? a.v[i] : b.v[i];
+    return r;
+}
+
+inline SimdMask simdMaskFirst(int lanes) {
+    return {{lanes > 0, lanes > 1, lanes > 2, lanes > 3}};
+}
+
+inline SimdFloat simdMin(SimdFloat a, SimdFloat b) { return a.map(b, [](float x, float y) { return std::min(x, y); }); }
+inline SimdFloat simdMax(SimdFloat a, SimdFloat b) { return a.map(b, [](float x, float y) { return std::max(x, y); }); }
+inline SimdFloat simdFloor(SimdFloat x) { return x.map(x, [](float a, float) { return std::floor(a); }); }
+
+inline SimdFloat simdExp2i(SimdFloat n) {
+    return n.map(n, [](float a, float) {
+        return std::bit_cast<float>(static_cast<uint32_t>(static_cast<int32_t>(a) + 127) << 23);
+    });
+}
+
+#endif
+
+} // namespace ChiptuneTracker
@@ -0,0 +1,137 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Snapshot Module
+ *
+ * Immutable, compiled copy of everything the audio thread needs from the
+ * project. The UI thread edits the Project directly and publishes a new
+ * snapshot when something changed; the audio thread picks it up with one
+ * atomic exchange. Snapshots the audio thread is done with are handed
+ * back and freed on the UI thread, so playback never locks or frees.
+ */
+
+#include "Types.h"
+#include "Timeline.h"
+#include "RingBuffer.h"
+#include <atomic>
+#include <array>
+#include <memory>
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// Playback Settings - per-project values read while mixing
+// ============================================================================
+struct ChannelMix {
+    float volume = 0.8f;
+    float pan = 0.0f;
+    bool muted = false;
+    bool solo = false;
+    float reverbSend = 0.0f;
+    float delaySend = 0.0f;
+
+    bool operator==(const ChannelMix&) const = default;
+};
+
+struct PlaybackSettings {
+    Tempo tempo;
+    float bpm = 120.0f;
+    float masterVolume = 0.7f;
+    Oversampling masterOversampling = Oversampling::Off;
+    bool humanize = false;
+    float humanizeAmount = 0.02f;
+    float humanizeVelocity = 0.1f;
+    std::array<ChannelMix, Project::MAX_CHANNELS> channels;
+    AuxBusConfig aux;
+    std::array<std::shared_ptr<const Wavetable>, Project::MAX_CHANNELS> wavetables;   // Kept alive while in use
+
+    PlaybackSettings() = default;
+    PlaybackSettings(const Project& project, float sampleRate)
+        : tempo(project.bpm, sampleRate),
+          bpm(project.bpm),
+          masterVolume(project.masterVolume),
+          masterOversampling(project.masterOversampling),
+          humanize(project.humanize),
+          humanizeAmount(project.humanizeAmount),
+          humanizeVelocity(project.humanizeVelocity),
+          aux(project.aux) {
+        for (int ch = 0; ch < Project::MAX_CHANNELS; ++ch) {
+            const auto& config = project.channels[ch];
+            channels[ch] = {config.volume, config.pan, config.muted, config.solo,
+                            config.reverbSend, config.delaySend};
+            wavetables[ch] = config.wavetable;
+        }
+    }
+
+    bool operator==(const PlaybackSettings&) const = default;
+};
+
+// ============================================================================
+// Project Snapshot
+// ============================================================================
+struct ProjectSnapshot {
+    Timeline timeline;
+    PlaybackSettings settings;
+};
+
+// ============================================================================
+// Snapshot Exchange - UI thread publishes, audio thread acquires
+// ============================================================================
+class SnapshotExchange {
+public:
+    SnapshotExchange() = default;
+    SnapshotExchange(const SnapshotExchange&) = delete;
+    SnapshotExchange& operator=(const SnapshotExchange&) = delete;
+
+    // Only once the audio thread has stopped calling acquire()
+    ~SnapshotExchange() {
+        reclaim();
+        delete m_pending.exchange(nullptr, std::memory_order_acquire);
+        delete m_current;
+    }
+
+    // UI thread: hand over a new snapshot (takes ownership)
+    void publish(ProjectSnapshot* snapshot) {
+        reclaim();
+
+        // A snapshot still pending was never seen by the audio thread
+        delete m_pending.exchange(snapshot, std::memory_order_acq_rel);
+        m_latest = snapshot;
+    }
+
+    // UI thread: free the snapshots the audio thread has let go of
+    void reclaim() {
+        ProjectSnapshot* snapshot = nullptr;
+        while (m_retired.pop(snapshot)) {
+            delete snapshot;
+        }
+    }
+
+    // UI thread: the most recently published snapshot (nullptr before the
+    // first publish). Stays valid until the next publish.
+    const ProjectSnapshot* latest() const { return m_latest; }
+
+    // Audio thread: the snapshot to play from, switching to a newly
+    // published one if there is room to retire the old one
+    const ProjectSnapshot* acquire() {
+        if (m_pending.load(std::memory_order_relaxed) == nullptr) return m_current;
+        if (m_current && m_retired.full()) return m_current;  // Try again next block
+
+        ProjectSnapshot* next = m_pending.exchange(nullptr, std::memory_order_acq_rel);
+        if (next) {
+            if (m_current) m_retired.push(m_current);
+            m_current = next;
+        }
+        return m_current;
+    }
+
+private:
+    static constexpr size_t RETIRE_CAPACITY = 16;
+
+    std::atomic<ProjectSnapshot*> m_pending{nullptr};   // Published, not yet acquired
+    ProjectSnapshot* m_current = nullptr;               // Owned by the audio thread
+    ProjectSnapshot* m_latest = nullptr;                // UI thread bookkeeping
+    LockFreeRingBuffer<ProjectSnapshot*, RETIRE_CAPACITY> m_retired;  // Audio -> UI
+};
+
+} // namespace ChiptuneTracker
@@ -9,8 +9,18 @@
 
 #include "Types.h"
 #include "Effects.h"
+#include "Simd.h"
+#include "Lfsr.h"
+#include "Tuning.h"
+#include "Wavetable.h"
 #include <cmath>
 #include <array>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <algorithm>
 
 namespace ChiptuneTracker {
 
@@ -30,6 +40,12 @@ struct Voice {
 
     // LFSR for noise
     uint16_t lfsr = 0x0001;
+    float noiseAccum = 0.0f;        // LFSR clock accumulator
+
+    // Generator filter state (per voice so channels can render in parallel)
+    float filterState = 0.0f;       // AcidBass resonant lowpass
+    float hissFilter = 0.0f;        // VinylNoise hiss highpass
+    float gateSmooth = 1.0f;        // GatedPad gate smoothing
 
     // Envelope state
     enum class EnvStage { Attack, Decay, Sustain, Release, Off };
@@ -38,8 +54,8 @@ struct Voice {
     float envTime = 0.0f;
 
     // Note timing
-    float startTime = 0.0f;
-    float releaseTime = 0.0f;
+    double startTime = 0.0;    // Song time in seconds
+    double releaseTime = 0.0;
     float realTimeElapsed = 0.0f;  // Real time elapsed since noteOn (for preview cutoff)
 
     // Fade in/out (in seconds)
@@ -76,6 +92,16 @@ struct Voice {
     float tremoloSpeed = 4.0f;      // Hz
     float tremoloPhase = 0.0f;      // Current tremolo LFO phase
 
+    // Control-rate modulation: frequency and gain at the end of the last
+    // control block, ramped from on the next one (invalid until evaluated)
+    bool controlValid = false;
+    float controlFrequency = 440.0f;
+    float controlGain = 1.0f;
+
+    // Pre-rendered drum hit being played back (empty = synthesize live)
+    std::span<const float> oneShot;
+    uint32_t oneShotPosition = 0;
+
     void reset() {
         active = false;
         phase = 0.0f;
@@ -84,6 +110,10 @@ struct Voice {
         envTime = 0.0f;
         realTimeElapsed = 0.0f;
         lfsr = 0x0001;
+        noiseAccum = 0.0f;
+        filterState = 0.0f;
+        hissFilter = 0.0f;
+        gateSmooth = 1.0f;
         fadeInDuration = 0.0f;
         fadeOutDuration = 0.0f;
         noteDuration = 0.0f;
@@ -108,6 +138,9 @@ struct Voice {
         tremoloDepth = 0.0f;
         tremoloSpeed = 4.0f;
         tremoloPhase = 0.0f;
+        controlValid = false;
+        oneShot = {};
+        oneShotPosition = 0;
     }
 };
 
@@ -228,129 +261,389 @@ inline float getDrumDecayTime(OscillatorType type) {
     }
 }
 
+// ============================================================================
+// Voice Pool - voices shared by every channel
+// ============================================================================
+// Channels take voices from one pool and keep a compact list of the ones
+// they are playing, so idle channels cost nothing and CPU follows the real
+// voice count. When the pool is full a voice is stolen: released voices
+// first, then drum one-shots, then held notes, the quietest of each class
+// first. Drums are capped at a share of the pool and past the cap only
+// steal from each other, so dense drum parts cannot starve melodic ones.
+//
+// Threading: allocate(), voices() and steal only from the thread that
+// sends notes (between renders). During a render each channel may only
+// touch its own list; finished voices go back via release() and are
+// reclaimed on the next allocate().
+class VoicePool {
+public:
+    static constexpr int MAX_SIZE = 4096;
+
+    VoicePool(int size = 256, int channels = 8) {
+        resize(size, channels);
+    }
+
+    // Drops every voice (not while rendering)
+    void resize(int size, int channels) {
+        size = std::clamp(size, 1, MAX_SIZE);
+        channels = std::max(1, channels);
+
+        m_voices.assign(size, Voice());
+        m_owner.assign(size, -1);
+        m_isDrum.assign(size, 0);
+        m_free.resize(size);
+        for (int i = 0; i < size; ++i) {
+            m_free[i] = static_cast<uint16_t>(size - 1 - i);   // Lowest index first
+        }
+        m_freeCount = size;
+        m_drumCount = 0;
+        m_drumLimit = size;
+
+        m_active.assign(channels, std::vector<uint16_t>(size));
+        m_activeCount.assign(channels, 0);
+        m_released.assign(channels, std::vector<uint16_t>(size));
+        m_releasedCount.assign(channels, 0);
+    }
+
+    int size() const { return static_cast<int>(m_voices.size()); }
+    int channels() const { return static_cast<int>(m_active.size()); }
+
+    // Most voices drums may hold at once (default: the whole pool)
+    void setDrumLimit(int limit) { m_drumLimit = std::clamp(limit, 1, size()); }
+    int drumLimit() const { return m_drumLimit; }
+
+    Voice& voice(int index) { return m_voices[index]; }
+    const Voice& voice(int index) const { return m_voices[index]; }
+
+    // A channel's voices, oldest first
+    const uint16_t* voices(int channel) const { return m_active[channel].data(); }
+    int voiceCount(int channel) const { return m_activeCount[channel]; }
+
+    // Voices playing across all channels
+    int activeCount() const { return size() - m_freeCount; }
+
+    // Take a voice for a new note on a channel (always succeeds, stealing
+    // if need be). The voice is appended to the channel's list.
+    int allocate(int channel, bool drum) {
+        reclaim();
+
+        int index = -1;
+        if (drum && m_drumCount >= m_drumLimit) {
+            index = findVictim(true);
+        } else if (m_freeCount > 0) {
+            index = m_free[--m_freeCount];
+        } else {
+            index = findVictim(false);
+        }
+
+        if (m_owner[index] >= 0) {
+            detach(index);
+        }
+
+        m_owner[index] = channel;
+        m_isDrum[index] = drum ? 1 : 0;
+        if (drum) m_drumCount++;
+        m_active[channel][m_activeCount[channel]++] = static_cast<uint16_t>(index);
+        return index;
+    }
+
+    // Drop a channel's finished voices from its list, keeping the order.
+    // Safe from the channel's render task.
+    void compact(int channel) {
+        std::vector<uint16_t>& list = m_active[channel];
+        int kept = 0;
+        for (int i = 0; i < m_activeCount[channel]; ++i) {
+            const uint16_t index = list[i];
+            if (m_voices[index].active) {
+                list[kept++] = index;
+            } else {
+                m_released[channel][m_releasedCount[channel]++] = index;
+            }
+        }
+        m_activeCount[channel] = kept;
+    }
+
+private:
+    // Return every channel's finished voices to the free list
+    void reclaim() {
+        for (int ch = 0; ch < channels(); ++ch) {
+            for (int i = 0; i < m_releasedCount[ch]; ++i) {
+                const uint16_t index = m_released[ch][i];
+                if (m_isDrum[index]) m_drumCount--;
+                m_owner[index] = -1;
+                m_free[m_freeCount++] = index;
+            }
+            m_releasedCount[ch] = 0;
+        }
+    }
+
+    // Take a playing voice off its channel's list (and the drum count)
+    void detach(int index) {
+        std::vector<uint16_t>& list = m_active[m_owner[index]];
+        int& count = m_activeCount[m_owner[index]];
+        const auto end = list.begin() + count;
+        const auto it = std::find(list.begin(), end, static_cast<uint16_t>(index));
+        if (it != end) {
+            std::copy(it + 1, end, it);
+            count--;
+        }
+        if (m_isDrum[index]) m_drumCount--;
+        m_owner[index] = -1;
+    }
+
+    // Steal class (lower goes first): released notes, drums, held notes
+    int stealClass(int index) const {
+        const Voice& v = m_voices[index];
+        if (m_isDrum[index]) return 1;
+        return (v.envStage == Voice::EnvStage::Release || v.envStage == Voice::EnvStage::Off) ? 0 : 2;
+    }
+
+    // Rough current level, to pick the quietest voice within a class
+    float loudness(int index) const {
+        const Voice& v = m_voices[index];
+        if (!v.active) return 0.0f;
+        if (m_isDrum[index]) {
+            // Drums decay over about three times their decay time
+            const float length = getDrumDecayTime(v.oscillatorType) * 3.0f;
+            return v.velocity * std::max(0.0f, 1.0f - v.envTime / length);
+        }
+        // A note still in its attack is about to get louder
+        return v.velocity * (v.envStage == Voice::EnvStage::Attack ? 1.0f : v.envLevel);
+    }
+
+    // Seconds since the voice started, to steal the oldest among equals
+    float age(int index) const {
+        const Voice& v = m_voices[index];
+        return m_isDrum[index] ? v.envTime : v.realTimeElapsed;
+    }
+
+    int findVictim(bool drumsOnly) const {
+        int best = -1;
+        int bestClass = 3;
+        float bestLevel = 0.0f;
+        float bestAge = 0.0f;
+        for (int i = 0; i < size(); ++i) {
+            if (m_owner[i] < 0) continue;
+            if (drumsOnly && !m_isDrum[i]) continue;
+
+            const int cls = stealClass(i);
+            const float level = loudness(i);
+            const float voiceAge = age(i);
+            if (cls < bestClass ||
+                (cls == bestClass && (level < bestLevel || (level == bestLevel && voiceAge > bestAge)))) {
+                best = i;
+                bestClass = cls;
+                bestLevel = level;
+                bestAge = voiceAge;
+            }
+        }
+        return best >= 0 ? best : 0;
+    }
+
+    std::vector<Voice> m_voices;
+    std::vector<int> m_owner;           // Channel playing each voice (-1 = free)
+    std::vector<uint8_t> m_isDrum;
+    std::vector<uint16_t> m_free;
+    int m_freeCount = 0;
+    int m_drumCount = 0;
+    int m_drumLimit = 0;
+
+    // Per channel: voices playing, and finished voices awaiting reclaim
+    std::vector<std::vector<uint16_t>> m_active;
+    std::vector<int> m_activeCount;
+    std::vector<std::vector<uint16_t>> m_released;
+    std::vector<int> m_releasedCount;
+};
+
+// ============================================================================
+// Drum One-Shot Cache
+// ============================================================================
+// A drum hit never depends on the note: noteOn reseeds the LFSR, drums
+// skip the channel envelope, and velocity, fades and tremolo are applied
+// after the generator. So every drum type is rendered once per sample
+// rate on a background thread and drum voices play the buffer back. The
+// buffers come from the same generator code stepped the same way, so
+// playback is bit-identical to live synthesis; a drum that starts before
+// its buffer is ready is synthesized live.
+class DrumCache {
+public:
+    // The cache for a sample rate, shared by every synth. The first
+    // request for a rate starts rendering it; caches live until exit.
+    static const DrumCache& forSampleRate(float sampleRate);
+
+    explicit DrumCache(float sampleRate)
+        : m_sampleRate(sampleRate), m_filler([this](std::stop_token stop) { fill(stop); }) {}
+
+    float sampleRate() const { return m_sampleRate; }
+
+    // A drum type's hit, or empty while it is still being rendered
+    std::span<const float> oneShot(OscillatorType type) const {
+        const Shot& shot = m_shots[static_cast<int>(type)];
+        if (!shot.ready.load(std::memory_order_acquire)) return {};
+        return shot.samples;
+    }
+
+    // Block until every drum has been rendered (tools and benchmarks)
+    void wait() const { m_done.wait(false, std::memory_order_acquire); }
+
+private:
+    struct Shot {
+        std::vector<float> samples;
+        std::atomic<bool> ready{false};
+    };
+
+    void fill(std::stop_token stop);
+
+    float m_sampleRate;
+    std::array<Shot, OSCILLATOR_TYPE_COUNT> m_shots;
+    std::atomic<bool> m_done{false};
+    std::jthread m_filler;              // Last, so it starts once the rest exists
+};
+
 // ============================================================================
 // Synthesizer (Per-channel)
 // ============================================================================
 class Synthesizer {
 public:
-    static constexpr int MAX_VOICES = 8;  // Polyphony
+    static constexpr int MAX_VOICES = 8;  // Polyphony of a synth with its own voices
+    static constexpr uint32_t MAX_RUN_FRAMES = 256;
 
-    Synthesizer() {
-        for (auto& voice : m_voices) {
-            voice.reset();
-        }
+    Synthesizer()
+        : m_ownPool(std::make_unique<VoicePool>(MAX_VOICES, 1)), m_pool(m_ownPool.get()),
+          m_batchMix(MAX_RUN_FRAMES * SIMD_LANES, 0.0f), m_noiseBlock(MAX_RUN_FRAMES * SIMD_LANES, 0.0f) {
+        // Build both noise tables now, so the first Noise batch on the
+        // audio thread or a render worker never does
+        lfsrTable(LfsrTaps::Bit1);
+        lfsrTable(LfsrTaps::Bit6);
+    }
+
+    // Take voices from a pool shared with other channels instead of the
+    // synth's own (not while rendering)
+    void attachVoicePool(VoicePool* pool, int channel) {
+        m_pool = pool ? pool : m_ownPool.get();
+        m_channel = pool ? channel : 0;
     }
 
     void setSampleRate(float sr) {
         m_sampleRate = sr;
         m_effects.setSampleRate(sr);
+        m_sleepFrames = static_cast<uint32_t>(SilenceDetector::HOLD_SECONDS * sr);
     }
 
     void setConfig(const OscillatorConfig& osc, const Envelope& env) {
         m_oscConfig = osc;
         m_envelope = env;
+        m_envelopeRates = EnvelopeRates(env);
+        m_notes.configure(osc.tuning, osc.detune);
     }
 
+    // Play drum hits from a cache rendered at this synth's sample rate
+    // (nullptr = always synthesize them)
+    void setDrumCache(const DrumCache* cache) { m_drumCache = cache; }
+
+    // Waveform the Custom oscillator plays for WAVETABLE_CHANNEL (audio
+    // thread; must outlive its use)
+    void setChannelWavetable(const Wavetable* table) { m_channelWavetable = table; }
+
     // Trigger a note (with optional fade parameters and oscillator type)
-    void noteOn(int note, float velocity, float time,
+    void noteOn(int note, float velocity, double time,
                 float fadeInSec = 0.0f, float fadeOutSec = 0.0f, float durationSec = 0.0f,
                 OscillatorType oscType = OscillatorType::Pulse,
                 float vibrato = 0.0f, int arpeggio = 0, float slide = 0.0f,
                 DutyCycle dutyCycle = DutyCycle::Duty50, bool useDutyCycle = false,
                 SweepDirection sweepDir = SweepDirection::None, float sweepSpd = 1.0f, float sweepAmt = 12.0f,
                 float tremolo = 0.0f, float tremoloSpd = 4.0f) {
-        // Find free voice or steal oldest
-        int voiceIndex = -1;
-        float oldestTime = time;
-
-        for (int i = 0; i < MAX_VOICES; ++i) {
-            if (!m_voices[i].active) {
-                voiceIndex = i;
-                break;
-            }
-            if (m_voices[i].startTime < oldestTime) {
-                oldestTime = m_voices[i].startTime;
-                voiceIndex = i;
-            }
-        }
-
-        if (voiceIndex >= 0) {
-            Voice& v = m_voices[voiceIndex];
-            v.active = true;
-            v.note = note;
-            v.velocity = velocity;
-            v.frequency = noteToFrequency(note);
+        // Take a voice from the pool (stealing one if it is full)
+        const int voiceIndex = m_pool->allocate(m_channel, isDrumType(oscType));
+        Voice& v = m_pool->voice(voiceIndex);
+        v.active = true;
+        v.note = note;
+        v.velocity = velocity;
+
+        // Channel tuning and detune (only for non-drums)
+        if (!isDrumType(oscType)) {
+            v.frequency = m_notes.frequency(note);
             v.baseFrequency = v.frequency;  // Store original frequency
+            v.phaseIncrement = v.frequency / m_sampleRate;
+        } else {
+            v.frequency = noteToFrequency(note);
+            v.baseFrequency = v.frequency;
+            // Drums: initialize phaseIncrement to a sensible default (will be overridden by drum generators)
+            v.phaseIncrement = 150.0f / m_sampleRate;  // Typical kick start frequency
+        }
+        v.phase = m_oscConfig.phase;
+        v.startTime = time;
+        v.envStage = Voice::EnvStage::Attack;
+        v.envTime = 0.0f;
+        v.envLevel = 0.0f;
+        v.realTimeElapsed = 0.0f;
+        v.lfsr = 0x0001;
+        v.noiseAccum = 0.0f;
+        v.filterState = 0.0f;
+        v.hissFilter = 0.0f;
+        v.gateSmooth = 1.0f;
+
+        // Drums play their pre-rendered hit once it is ready, if it starts
+        // the way it was rendered (at phase 0)
+        v.oneShot = {};
+        v.oneShotPosition = 0;
+        if (isDrumType(oscType) && m_drumCache && m_drumCache->sampleRate() == m_sampleRate &&
+            m_oscConfig.phase == 0.0f) {
+            v.oneShot = m_drumCache->oneShot(oscType);
+        }
 
-            // Apply detune (only for non-drums)
-            if (!isDrumType(oscType)) {
-                float detuneMult = std::pow(2.0f, m_oscConfig.detune / 1200.0f);
-                v.frequency *= detuneMult;
-                v.baseFrequency *= detuneMult;
-                v.phaseIncrement = v.frequency / m_sampleRate;
-            } else {
-                // Drums: initialize phaseIncrement to a sensible default (will be overridden by drum generators)
-                v.phaseIncrement = 150.0f / m_sampleRate;  // Typical kick start frequency
-            }
-            v.phase = m_oscConfig.phase;
-            v.startTime = time;
-            v.envStage = Voice::EnvStage::Attack;
-            v.envTime = 0.0f;
-            v.envLevel = 0.0f;
-            v.realTimeElapsed = 0.0f;
-            v.lfsr = 0x0001;
-
-            // Fade parameters
-            v.fadeInDuration = fadeInSec;
-            v.fadeOutDuration = fadeOutSec;
-            v.noteDuration = durationSec;
-
-            // Per-note oscillator type
-            v.oscillatorType = oscType;
-
-            // Per-note effects
-            v.vibratoDepth = vibrato;       // 0.0 to 1.0 (1.0 = 1 semitone wobble)
-            v.vibratoSpeed = 5.0f;          // 5 Hz default
-            v.vibratoPhase = 0.0f;
-
-            // Arpeggio: packed as 0xXY (X = first offset, Y = second offset)
-            v.arpeggioX = (arpeggio >> 4) & 0x0F;  // Upper nibble
-            v.arpeggioY = arpeggio & 0x0F;          // Lower nibble
-            v.arpeggioStep = 0;
-            v.arpeggioTimer = 0.0f;
-
-            // Slide/portamento (semitones to slide from start)
-            if (slide != 0.0f) {
-                // slide is semitones offset - calculate target
-                v.slideTarget = v.baseFrequency;
-                // Start at offset frequency, slide to base
-                v.frequency = v.baseFrequency * std::pow(2.0f, slide / 12.0f);
-                v.slideSpeed = std::abs(slide) * 4.0f;  // Speed proportional to distance
-            } else {
-                v.slideTarget = 0.0f;
-                v.slideSpeed = 0.0f;
-            }
+        // Fade parameters
+        v.fadeInDuration = fadeInSec;
+        v.fadeOutDuration = fadeOutSec;
+        v.noteDuration = durationSec;
+
+        // Per-note oscillator type
+        v.oscillatorType = oscType;
+
+        // Per-note effects
+        v.vibratoDepth = vibrato;       // 0.0 to 1.0 (1.0 = 1 semitone wobble)
+        v.vibratoSpeed = 5.0f;          // 5 Hz default
+        v.vibratoPhase = 0.0f;
+
+        // Arpeggio: packed as 0xXY (X = first offset, Y = second offset)
+        v.arpeggioX = (arpeggio >> 4) & 0x0F;  // Upper nibble
+        v.arpeggioY = arpeggio & 0x0F;          // Lower nibble
+        v.arpeggioStep = 0;
+        v.arpeggioTimer = 0.0f;
+
+        // Slide/portamento (semitones to slide from start)
+        if (slide != 0.0f) {
+            // slide is semitones offset - calculate target
+            v.slideTarget = v.baseFrequency;
+            // Start at offset frequency, slide to base
+            v.frequency = v.baseFrequency * pitchRatio(slide);
+            v.slideSpeed = std::abs(slide) * 4.0f;  // Speed proportional to distance
+        } else {
+            v.slideTarget = 0.0f;
+            v.slideSpeed = 0.0f;
+        }
 
-            // NES-style Duty Cycle (for pulse waves)
-            v.dutyCycle = dutyCycle;
-            v.useDutyCycle = useDutyCycle;
+        // NES-style Duty Cycle (for pulse waves)
+        v.dutyCycle = dutyCycle;
+        v.useDutyCycle = useDutyCycle;
 
-            // Pitch Sweep (NES sweep unit)
-            v.sweepDirection = sweepDir;
-            v.sweepSpeed = sweepSpd;
-            v.sweepAmount = sweepAmt;
-            v.sweepProgress = 0.0f;
+        // Pitch Sweep (NES sweep unit)
+        v.sweepDirection = sweepDir;
+        v.sweepSpeed = sweepSpd;
+        v.sweepAmount = sweepAmt;
+        v.sweepProgress = 0.0f;
 
-            // Tremolo (volume modulation)
-            v.tremoloDepth = tremolo;
-            v.tremoloSpeed = tremoloSpd;
-            v.tremoloPhase = 0.0f;
-        }
+        // Tremolo (volume modulation)
+        v.tremoloDepth = tremolo;
+        v.tremoloSpeed = tremoloSpd;
+        v.tremoloPhase = 0.0f;
+        v.controlValid = false;
     }
 
     // Release a note
-    void noteOff(int note, float time) {
-        for (auto& v : m_voices) {
+    void noteOff(int note, double time) {
+        for (int i = 0; i < m_pool->voiceCount(m_channel); ++i) {
+            Voice& v = m_pool->voice(m_pool->voices(m_channel)[i]);
             if (v.active && v.note == note && v.envStage != Voice::EnvStage::Release) {
                 // Drums always play their full decay - ignore noteOff entirely
                 if (isDrumType(v.oscillatorType)) {
@@ -366,7 +659,8 @@ public:
 
     // All notes off
     void allNotesOff() {
-        for (auto& v : m_voices) {
+        for (int i = 0; i < m_pool->voiceCount(m_channel); ++i) {
+            Voice& v = m_pool->voice(m_pool->voices(m_channel)[i]);
             if (v.active) {
                 // Drums always play their full decay - let them continue
                 if (isDrumType(v.oscillatorType)) {
@@ -379,150 +673,89 @@ public:
         }
     }
 
-    // Generate one sample (called from audio thread)
-    float process(float time) {
-        float output = 0.0f;
-        float dt = 1.0f / m_sampleRate;
-
-        for (auto& voice : m_voices) {
-            if (!voice.active) continue;
-
-            // Check if this is a drum sound (drums have their own internal envelope)
-            bool isDrum = isDrumType(voice.oscillatorType);
-
-            // Apply per-note effects to frequency (before oscillator generation)
-            float effectFreq = voice.baseFrequency;
-
-            // 1. Apply portamento/slide effect
-            if (voice.slideTarget > 0.0f && voice.slideSpeed > 0.0f) {
-                float diff = voice.slideTarget - voice.frequency;
-                if (std::abs(diff) > 0.1f) {
-                    // Slide towards target
-                    float slideAmount = voice.slideSpeed * dt * voice.baseFrequency * 0.1f;
-                    if (diff > 0) {
-                        voice.frequency = std::min(voice.frequency + slideAmount, voice.slideTarget);
-                    } else {
-                        voice.frequency = std::max(voice.frequency - slideAmount, voice.slideTarget);
-                    }
-                } else {
-                    voice.frequency = voice.slideTarget;
-                    voice.slideTarget = 0.0f;  // Slide complete
-                }
-                effectFreq = voice.frequency;
-            }
-
-            // 2. Apply arpeggio effect (classic tracker-style 0xy command)
-            if (voice.arpeggioX > 0 || voice.arpeggioY > 0) {
-                // Step through: base note -> +X semitones -> +Y semitones
-                float arpFreq = voice.baseFrequency;
-                switch (voice.arpeggioStep) {
-                    case 0: arpFreq = voice.baseFrequency; break;
-                    case 1: arpFreq = voice.baseFrequency * std::pow(2.0f, voice.arpeggioX / 12.0f); break;
-                    case 2: arpFreq = voice.baseFrequency * std::pow(2.0f, voice.arpeggioY / 12.0f); break;
-                }
-                effectFreq = arpFreq;
-
-                // Advance arpeggio timer (step at ~15 Hz for classic tracker feel)
-                voice.arpeggioTimer += dt;
-                if (voice.arpeggioTimer >= 0.067f) {  // ~15 steps per second
-                    voice.arpeggioTimer = 0.0f;
-                    voice.arpeggioStep = (voice.arpeggioStep + 1) % 3;
-                }
-            }
-
-            // 3. Apply vibrato effect (pitch wobble)
-            if (voice.vibratoDepth > 0.0f) {
-                // Update vibrato LFO phase
-                voice.vibratoPhase += voice.vibratoSpeed * dt;
-                if (voice.vibratoPhase >= 1.0f) voice.vibratoPhase -= 1.0f;
+    // Render a run of frames (called from audio thread)
+    // time is the song time of the first frame and advances by timeStep per
+    // frame (0 while the transport is stopped); voices always advance in real time.
+    // With a profile, voice and per-effect times are added to it.
+    void process(float* output, uint32_t frameCount, double time, double timeStep,
+                 ChannelProfile* profile = nullptr) {
+        // Longer runs are rendered in pieces that fit the batch mix buffer
+        while (frameCount > MAX_RUN_FRAMES) {
+            process(output, MAX_RUN_FRAMES, time, timeStep, profile);
+            output += MAX_RUN_FRAMES;
+            time += timeStep * MAX_RUN_FRAMES;
+            frameCount -= MAX_RUN_FRAMES;
+        }
 
-                // Calculate vibrato modulation (sine wave, +/- semitones)
-                float vibratoMod = std::sin(voice.vibratoPhase * 2.0f * PI) * voice.vibratoDepth;
-                effectFreq *= std::pow(2.0f, vibratoMod / 12.0f);
+        const int64_t start = profile ? profileNow() : 0;
+        std::fill_n(output, frameCount, 0.0f);
+
+        const uint16_t* voices = m_pool->voices(m_channel);
+        const int voiceCount = m_pool->voiceCount(m_channel);
+        const bool anyVoice = voiceCount > 0;
+
+        // Asleep: no voice and the effect tails died away (the next note on
+        // wakes the channel by giving it a voice)
+        if (!anyVoice && m_asleep) return;
+
+        // Plain voices go into per-kind batches rendered SIMD_LANES at a
+        // time; everything else renders one voice at a time
+        std::array<VoiceBatch, BATCH_KINDS> batches;
+        bool batched = false;
+        auto flush = [&](int kind) {
+            if (!batched) std::fill_n(m_batchMix.begin(), frameCount * SIMD_LANES, 0.0f);
+            batched = true;
+            renderBatch(kind, batches[kind], frameCount);
+            batches[kind].count = 0;
+        };
+        for (int i = 0; i < voiceCount; ++i) {
+            Voice& voice = m_pool->voice(voices[i]);
+            const int kind = batchKind(voice);
+            if (kind < 0) {
+                renderVoice(voice, output, frameCount, time, timeStep);
+                continue;
             }
 
-            // 4. Apply pitch sweep effect (NES sweep unit - automatic pitch bend)
-            if (voice.sweepDirection != SweepDirection::None && voice.sweepProgress < 1.0f) {
-                // Calculate sweep progress (0 to 1)
-                voice.sweepProgress += voice.sweepSpeed * dt;
-                if (voice.sweepProgress > 1.0f) voice.sweepProgress = 1.0f;
-
-                // Apply sweep as semitone offset
-                float sweepSemitones = voice.sweepAmount * voice.sweepProgress;
-                if (voice.sweepDirection == SweepDirection::Down) {
-                    sweepSemitones = -sweepSemitones;  // Pitch falls (laser sound)
-                }
-                effectFreq *= std::pow(2.0f, sweepSemitones / 12.0f);
-            }
+            VoiceBatch& batch = batches[kind];
+            batch.voices[batch.count++] = &voice;
+            if (batch.count == SIMD_LANES) flush(kind);
+        }
+        for (int kind = 0; kind < BATCH_KINDS; ++kind) {
+            if (batches[kind].count > 0) flush(kind);
+        }
 
-            // Update phase increment with modified frequency (skip for drums - they manage their own)
-            if (!isDrum) {
-                voice.phaseIncrement = effectFreq / m_sampleRate;
+        // Batches mix lane by lane; fold the lanes into the output once
+        if (batched) {
+            for (uint32_t i = 0; i < frameCount; ++i) {
+                output[i] += SimdFloat::load(&m_batchMix[i * SIMD_LANES]).sum();
             }
-
-            // Generate oscillator sample
-            float sample = generateOscillator(voice);
-
-            // Apply envelope (skip ADSR for drums - they have internal envelopes)
-            float envGain = 1.0f;
-            if (isDrum) {
-                // Drums manage their own envelope internally
-                // Just update envTime for the drum generators
-                voice.envTime += dt;
-                // Deactivate drum voice after it's finished (based on decay time)
-                float maxDrumTime = getDrumDecayTime(voice.oscillatorType) * 3.0f;  // 3x decay time
-                if (voice.envTime > maxDrumTime) {
-                    voice.active = false;
-                }
+        }
+        if (anyVoice) m_pool->compact(m_channel);
+        if (profile) profile->synthNs += profileNow() - start;
+
+        // Apply effects chain, unless there is nothing to add and no effect
+        // that could still ring out
+        if (anyVoice || m_effects.anyEnabled()) {
+            if (profile) {
+                m_effects.processProfiled(output, frameCount, time, timeStep, *profile);
             } else {
-                // Track real time elapsed (independent of playback state and envelope stages)
-                voice.realTimeElapsed += dt;
-
-                // Auto-release synth notes when their duration is reached (for preview)
-                if (voice.noteDuration > 0.0f) {
-                    if (voice.realTimeElapsed >= voice.noteDuration && voice.envStage != Voice::EnvStage::Release) {
-                        voice.envStage = Voice::EnvStage::Release;
-                        voice.envTime = 0.0f;  // Reset envelope time for release phase
-                    }
-                    // Hard cutoff: deactivate after duration + short release time
-                    if (voice.realTimeElapsed >= voice.noteDuration + 0.2f) {
-                        voice.active = false;
-                        continue;  // Skip processing this voice
-                    }
-                }
-                envGain = processEnvelope(voice);
-            }
-
-            // Apply fade in/out
-            float fadeGain = calculateFadeGain(voice, time);
-
-            // Apply tremolo effect (volume modulation)
-            float tremoloGain = 1.0f;
-            if (voice.tremoloDepth > 0.0f) {
-                // Update tremolo LFO phase
-                voice.tremoloPhase += voice.tremoloSpeed * dt;
-                if (voice.tremoloPhase >= 1.0f) voice.tremoloPhase -= 1.0f;
-
-                // Calculate tremolo modulation (sine wave, 0 to 1)
-                float tremoloMod = (std::sin(voice.tremoloPhase * 2.0f * PI) + 1.0f) * 0.5f;
-                // Tremolo depth: 0 = no effect, 1 = full modulation (silence at trough)
-                tremoloGain = 1.0f - voice.tremoloDepth * (1.0f - tremoloMod);
+                m_effects.processBlock(output, frameCount, time, timeStep);
             }
-
-            sample *= envGain * voice.velocity * fadeGain * tremoloGain;
-
-            output += sample;
         }
 
-        // Apply effects chain
-        output = m_effects.process(output, time);
-
-        return output;
+        // Voices only ever render while awake, so sleeping needs none for
+        // the hold time as well as a silent output
+        m_silence.update(anyVoice ? 1.0f : SilenceDetector::peak(output, frameCount), frameCount);
+        m_asleep = m_silence.silentFor(m_sleepFrames);
     }
 
+    // True while process() skips synthesis and effects: no voices and a
+    // silent output for the hold time
+    bool isAsleep() const { return m_asleep && m_pool->voiceCount(m_channel) == 0; }
+
     // Calculate fade in/out gain for a voice
-    float calculateFadeGain(const Voice& voice, float currentTime) const {
-        float elapsed = currentTime - voice.startTime;
+    float calculateFadeGain(const Voice& voice, double currentTime) const {
+        float elapsed = static_cast<float>(currentTime - voice.startTime);
         float fadeGain = 1.0f;
 
         // Fade in
@@ -543,22 +776,458 @@ public:
         return std::max(0.0f, std::min(1.0f, fadeGain));
     }
 
+    // One hit of a drum exactly as renderVoice() synthesizes it, up to
+    // the frame its voice ends on (fills DrumCache)
+    std::vector<float> renderDrumOneShot(OscillatorType type) {
+        const float dt = 1.0f / m_sampleRate;
+        const float maxDrumTime = getDrumDecayTime(type) * 3.0f;
+
+        // Started like noteOn() starts a drum
+        Voice voice;
+        voice.active = true;
+        voice.oscillatorType = type;
+        voice.phase = 0.0f;
+        voice.phaseIncrement = 150.0f / m_sampleRate;
+
+        std::vector<float> samples;
+        samples.reserve(static_cast<size_t>(maxDrumTime * m_sampleRate) + 2);
+        do {
+            samples.push_back(generateOscillator(voice));
+            voice.envTime += dt;
+        } while (voice.envTime <= maxDrumTime);
+        return samples;
+    }
+
     // Accessors
     EffectsChain& effects() { return m_effects; }
+    const EffectsChain& effects() const { return m_effects; }
     Vibrato& vibrato() { return m_vibrato; }
     Arpeggiator& arpeggiator() { return m_arpeggiator; }
 
     void setVibratoEnabled(bool enabled) { m_vibratoEnabled = enabled; }
     void setArpeggiatorEnabled(bool enabled) { m_arpeggiatorEnabled = enabled; }
 
-    bool isActive() const {
-        for (const auto& v : m_voices) {
-            if (v.active) return true;
+    bool isActive() const { return m_pool->voiceCount(m_channel) > 0; }
+
+private:
+    // ========================================================================
+    // Voice Rendering
+    // ========================================================================
+
+    // Adds one voice's output for a run of frames into the buffer
+    void renderVoice(Voice& voice, float* output, uint32_t frameCount, double time, double timeStep) {
+        const float dt = 1.0f / m_sampleRate;
+
+        // Check if this is a drum sound (drums have their own internal envelope)
+        const bool isDrum = isDrumType(voice.oscillatorType);
+        const float maxDrumTime = isDrum ? getDrumDecayTime(voice.oscillatorType) * 3.0f : 0.0f;  // 3x decay time
+        const bool arpeggio = voice.arpeggioX > 0 || voice.arpeggioY > 0;
+
+        for (uint32_t i = 0; i < frameCount; ) {
+            // Control block: ends early on an arpeggio step so the step
+            // lands on its frame
+            uint32_t frames = std::min(CONTROL_BLOCK, frameCount - i);
+            uint32_t toStep = 0;
+            if (arpeggio) {
+                toStep = static_cast<uint32_t>(std::max(1.0f, std::ceil((0.067f - voice.arpeggioTimer) * m_sampleRate)));
+                frames = std::min(frames, toStep);
+            }
+
+            if (!voice.controlValid) {
+                const ControlPoint now = advanceControl(voice, 0, time);
+                voice.controlFrequency = now.frequency;
+                voice.controlGain = now.gain;
+                voice.controlValid = true;
+            }
+            const ControlPoint end = advanceControl(voice, frames, time + timeStep * frames);
+
+            // Ramp from the previous block's end to this one's
+            const float invFrames = 1.0f / static_cast<float>(frames);
+            const float frequencyStep = (end.frequency - voice.controlFrequency) * invFrames;
+            const float gainStep = (end.gain - voice.controlGain) * invFrames;
+            float frequency = voice.controlFrequency;
+            float gain = voice.controlGain;
+            voice.controlFrequency = end.frequency;
+            voice.controlGain = end.gain;
+
+            for (uint32_t k = 0; k < frames; ++k) {
+                frequency += frequencyStep;
+                gain += gainStep;
+
+                // Update phase increment with modified frequency (skip for drums - they manage their own)
+                if (!isDrum) {
+                    voice.phaseIncrement = frequency * dt;
+                }
+
+                // Generate oscillator sample (or play the drum's cached hit)
+                float sample;
+                if (!voice.oneShot.empty()) {
+                    sample = voice.oneShot[voice.oneShotPosition];
+                    if (++voice.oneShotPosition == voice.oneShot.size()) voice.active = false;
+                } else {
+                    sample = generateOscillator(voice);
+                }
+
+                // Apply envelope (skip ADSR for drums - they have internal envelopes)
+                float envGain = 1.0f;
+                if (isDrum) {
+                    // Drums manage their own envelope internally
+                    // Just update envTime for the drum generators
+                    voice.envTime += dt;
+                    // Deactivate drum voice after it's finished (based on decay time)
+                    if (voice.envTime > maxDrumTime) {
+                        voice.active = false;
+                    }
+                } else {
+                    // Track real time elapsed (independent of playback state and envelope stages)
+                    voice.realTimeElapsed += dt;
+
+                    // Auto-release synth notes when their duration is reached (for preview)
+                    if (voice.noteDuration > 0.0f) {
+                        if (voice.realTimeElapsed >= voice.noteDuration && voice.envStage != Voice::EnvStage::Release) {
+                            voice.envStage = Voice::EnvStage::Release;
+                            voice.envTime = 0.0f;  // Reset envelope time for release phase
+                        }
+                        // Hard cutoff: deactivate after duration + short release time
+                        if (voice.realTimeElapsed >= voice.noteDuration + 0.2f) {
+                            voice.active = false;
+                            return;  // Nothing more from this voice
+                        }
+                    }
+                    envGain = processEnvelope(voice, dt);
+                }
+
+                // Fades and tremolo are in the ramped gain
+                sample *= envGain * voice.velocity * gain;
+
+                output[i + k] += sample;
+
+                if (!voice.active) return;  // Drum finished on this frame
+            }
+
+            // Advance arpeggio (step at ~15 Hz for classic tracker feel);
+            // a step is a jump, so the next block starts from the new pitch
+            if (arpeggio) {
+                if (frames == toStep) {
+                    voice.arpeggioTimer = 0.0f;
+                    voice.arpeggioStep = (voice.arpeggioStep + 1) % 3;
+                    voice.controlValid = false;
+                } else {
+                    voice.arpeggioTimer += frames * dt;
+                }
+            }
+
+            i += frames;
+            time += timeStep * frames;
+        }
+    }
+
+    // ========================================================================
+    // Control-Rate Modulation
+    // ========================================================================
+    // Per-note modulation (slide, arpeggio, vibrato, sweep, tremolo and
+    // fades) changes far slower than audio, so renderVoice() evaluates it
+    // once per CONTROL_BLOCK frames and ramps frequency and gain linearly
+    // in between.
+    static constexpr uint32_t CONTROL_BLOCK = 32;   // ~0.7 ms at 44.1 kHz
+
+    struct ControlPoint {
+        float frequency;
+        float gain;
+    };
+
+    // Advances the voice's slide, LFOs and sweep by a number of frames (0
+    // to just read them) and returns the modulated frequency and gain at
+    // that point; time is the song time there
+    ControlPoint advanceControl(Voice& voice, uint32_t frames, double time) {
+        const float elapsed = static_cast<float>(frames) / m_sampleRate;
+        float frequency = voice.baseFrequency;
+
+        // 1. Apply portamento/slide effect
+        if (voice.slideTarget > 0.0f && voice.slideSpeed > 0.0f) {
+            float diff = voice.slideTarget - voice.frequency;
+            if (std::abs(diff) > 0.1f) {
+                // Slide towards target
+                float slideAmount = voice.slideSpeed * elapsed * voice.baseFrequency * 0.1f;
+                if (diff > 0) {
+                    voice.frequency = std::min(voice.frequency + slideAmount, voice.slideTarget);
+                } else {
+                    voice.frequency = std::max(voice.frequency - slideAmount, voice.slideTarget);
+                }
+            } else if (frames > 0) {
+                voice.frequency = voice.slideTarget;
+                voice.slideTarget = 0.0f;  // Slide complete
+            }
+            frequency = voice.frequency;
+        }
+
+        // 2. Apply arpeggio effect (classic tracker-style 0xy command):
+        // base note -> +X semitones -> +Y semitones, stepped by renderVoice()
+        switch (voice.arpeggioX > 0 || voice.arpeggioY > 0 ? voice.arpeggioStep : -1) {
+            case 0: frequency = voice.baseFrequency; break;
+            case 1: frequency = voice.baseFrequency * SEMITONE_RATIOS[PITCH_RANGE + voice.arpeggioX]; break;
+            case 2: frequency = voice.baseFrequency * SEMITONE_RATIOS[PITCH_RANGE + voice.arpeggioY]; break;
+            default: break;
+        }
+
+        // 3. Apply vibrato effect (pitch wobble)
+        if (voice.vibratoDepth > 0.0f) {
+            voice.vibratoPhase += voice.vibratoSpeed * elapsed;
+            voice.vibratoPhase -= std::floor(voice.vibratoPhase);
+
+            // Sine wave, +/- semitones
+            float vibratoMod = fastSinTurns(voice.vibratoPhase) * voice.vibratoDepth;
+            frequency *= pitchRatio(vibratoMod);
+        }
+
+        // 4. Apply pitch sweep effect (NES sweep unit - automatic pitch bend)
+        if (voice.sweepDirection != SweepDirection::None && voice.sweepProgress < 1.0f) {
+            voice.sweepProgress += voice.sweepSpeed * elapsed;
+            if (voice.sweepProgress >= 1.0f) {
+                // The sweep lets go of the pitch once it completes
+                voice.sweepProgress = 1.0f;
+                voice.controlValid = false;
+            }
+
+            // Apply sweep as semitone offset
+            float sweepSemitones = voice.sweepAmount * voice.sweepProgress;
+            if (voice.sweepDirection == SweepDirection::Down) {
+                sweepSemitones = -sweepSemitones;  // Pitch falls (laser sound)
+            }
+            frequency *= pitchRatio(sweepSemitones);
+        }
+
+        // Fade in/out
+        float gain = calculateFadeGain(voice, time);
+
+        // Tremolo (volume modulation)
+        if (voice.tremoloDepth > 0.0f) {
+            voice.tremoloPhase += voice.tremoloSpeed * elapsed;
+            voice.tremoloPhase -= std::floor(voice.tremoloPhase);
+
+            // Sine wave, 0 to 1
+            float tremoloMod = (fastSinTurns(voice.tremoloPhase) + 1.0f) * 0.5f;
+            // Tremolo depth: 0 = no effect, 1 = full modulation (silence at trough)
+            gain *= 1.0f - voice.tremoloDepth * (1.0f - tremoloMod);
+        }
+
+        return {frequency, gain};
+    }
+
+    // ========================================================================
+    // Batched Voice Rendering (SIMD across voices)
+    // ========================================================================
+    // Pulse, Triangle, Sawtooth, Sine and Noise voices without per-note
+    // effects or fades are rendered SIMD_LANES at a time. Their hot state
+    // (phase, envelope, timing) is gathered into lane vectors for the run
+    // and written back afterwards; the math is the same as renderVoice(),
+    // generateOscillator() and processEnvelope() step for step. Noise lanes
+    // are rendered from the LFSR table up front, interleaved.
+    enum BatchKindIndex { BATCH_PULSE, BATCH_TRIANGLE, BATCH_SAWTOOTH, BATCH_SINE, BATCH_NOISE, BATCH_KINDS };
+
+    struct VoiceBatch {
+        std::array<Voice*, SIMD_LANES> voices;
+        int count = 0;
+    };
+
+    // Batch a voice goes in, or -1 to render it on its own
+    static int batchKind(const Voice& voice) {
+        int kind;
+        switch (voice.oscillatorType) {
+            case OscillatorType::Pulse:    kind = BATCH_PULSE; break;
+            case OscillatorType::Triangle: kind = BATCH_TRIANGLE; break;
+            case OscillatorType::Sawtooth: kind = BATCH_SAWTOOTH; break;
+            case OscillatorType::Sine:     kind = BATCH_SINE; break;
+            case OscillatorType::Noise:    kind = BATCH_NOISE; break;
+            default: return -1;
+        }
+
+        const bool sliding = voice.slideTarget > 0.0f && voice.slideSpeed > 0.0f;
+        const bool arpeggio = voice.arpeggioX > 0 || voice.arpeggioY > 0;
+        const bool sweeping = voice.sweepDirection != SweepDirection::None && voice.sweepProgress < 1.0f;
+        const bool fading = voice.fadeInDuration > 0.0f ||
+                            (voice.noteDuration > 0.0f && voice.fadeOutDuration > 0.0f);
+        if (sliding || arpeggio || sweeping || fading ||
+            voice.vibratoDepth > 0.0f || voice.tremoloDepth > 0.0f) {
+            return -1;
+        }
+        return kind;
+    }
+
+    static SimdFloat polyBlep(SimdFloat t, SimdFloat dt) {
+        const SimdMask nearEdge = (t < dt) | (t > SimdFloat(1.0f) - dt);
+        if (!nearEdge.any()) return 0.0f;   // Usual case: no lane near a discontinuity
+
+        const SimdFloat a = t / dt;
+        const SimdFloat rising = a + a - a * a - 1.0f;
+        const SimdFloat b = (t - 1.0f) / dt;
+        const SimdFloat falling = b * b + b + b + 1.0f;
+        return select(t < dt, rising, select(t > SimdFloat(1.0f) - dt, falling, 0.0f));
+    }
+
+    // Adds the batch's lanes into m_batchMix (frameCount <= MAX_RUN_FRAMES)
+    void renderBatch(int kind, const VoiceBatch& batch, uint32_t frameCount) {
+        const float dt = 1.0f / m_sampleRate;
+
+        // Gather (unused lanes are silent and masked off)
+        alignas(32) float phase[SIMD_LANES] = {};
+        alignas(32) float increment[SIMD_LANES];
+        alignas(32) float width[SIMD_LANES];
+        alignas(32) float stage[SIMD_LANES];
+        alignas(32) float level[SIMD_LANES] = {};
+        alignas(32) float envTime[SIMD_LANES] = {};
+        alignas(32) float velocity[SIMD_LANES] = {};
+        alignas(32) float elapsed[SIMD_LANES] = {};
+        alignas(32) float duration[SIMD_LANES] = {};
+        for (int lane = 0; lane < SIMD_LANES; ++lane) {
+            increment[lane] = 0.01f;
+            width[lane] = 0.5f;
+            stage[lane] = static_cast<float>(Voice::EnvStage::Sustain);
+        }
+        for (int lane = 0; lane < batch.count; ++lane) {
+            const Voice& v = *batch.voices[lane];
+            phase[lane] = v.phase;
+            increment[lane] = v.baseFrequency / m_sampleRate;
+            width[lane] = v.useDutyCycle ? dutyCycleToFloat(v.dutyCycle) : m_oscConfig.pulseWidth;
+            stage[lane] = static_cast<float>(v.envStage);
+            level[lane] = v.envLevel;
+            envTime[lane] = v.envTime;
+            velocity[lane] = v.velocity;
+            elapsed[lane] = v.realTimeElapsed;
+            duration[lane] = v.noteDuration;
+        }
+
+        if (kind == BATCH_NOISE) {
+            const LfsrTable& table = lfsrTable(noiseTaps());
+            for (int lane = 0; lane < batch.count; ++lane) {
+                Voice& v = *batch.voices[lane];
+                table.renderNoise(v.lfsr, v.noiseAccum, (v.baseFrequency * dt) * 16.0f,
+                                  &m_noiseBlock[lane], frameCount, SIMD_LANES);
+            }
+        }
+
+        SimdFloat vPhase = SimdFloat::load(phase);
+        const SimdFloat vIncrement = SimdFloat::load(increment);
+        const SimdFloat vWidth = SimdFloat::load(width);
+        SimdFloat vStage = SimdFloat::load(stage);
+        SimdFloat vLevel = SimdFloat::load(level);
+        SimdFloat vEnvTime = SimdFloat::load(envTime);
+        const SimdFloat vVelocity = SimdFloat::load(velocity);
+        SimdFloat vElapsed = SimdFloat::load(elapsed);
+        const SimdFloat vDuration = SimdFloat::load(duration);
+        const SimdFloat vCutoff = vDuration + 0.2f;
+        const SimdMask hasDuration = vDuration > 0.0f;
+
+        const float slope = std::clamp(m_oscConfig.triangleSlope, 0.001f, 0.999f);
+        const Envelope& env = m_envelope;
+        const EnvelopeRates& rates = m_envelopeRates;
+        const SimdFloat attackStage(static_cast<float>(Voice::EnvStage::Attack));
+        const SimdFloat decayStage(static_cast<float>(Voice::EnvStage::Decay));
+        const SimdFloat sustainStage(static_cast<float>(Voice::EnvStage::Sustain));
+        const SimdFloat releaseStage(static_cast<float>(Voice::EnvStage::Release));
+        const SimdFloat offStage(static_cast<float>(Voice::EnvStage::Off));
+
+        SimdMask alive = simdMaskFirst(batch.count);
+        for (uint32_t i = 0; i < frameCount && alive.any(); ++i) {
+            // Oscillator
+            SimdFloat sample;
+            switch (kind) {
+                case BATCH_PULSE: {
+                    SimdFloat edge = vPhase - vWidth + 1.0f;
+                    edge = select(edge >= 1.0f, edge - 1.0f, edge);
+                    sample = select(vPhase < vWidth, 1.0f, -1.0f) + polyBlep(vPhase, vIncrement) -
+                             polyBlep(edge, vIncrement);
+                    break;
+                }
+                case BATCH_TRIANGLE:
+                    sample = select(vPhase < slope, SimdFloat(-1.0f) + SimdFloat(2.0f) * (vPhase / slope),
+                                    SimdFloat(1.0f) - SimdFloat(2.0f) * ((vPhase - slope) / (1.0f - slope)));
+                    break;
+                case BATCH_SAWTOOTH:
+                    sample = vPhase * 2.0f - 1.0f - polyBlep(vPhase, vIncrement);
+                    break;
+                case BATCH_SINE:
+                    sample = fastSinTurns(vPhase);
+                    break;
+                default:
+                    sample = SimdFloat::load(&m_noiseBlock[i * SIMD_LANES]);
+                    break;
+            }
+            vPhase = vPhase + vIncrement;
+            vPhase = select(vPhase >= 1.0f, vPhase - 1.0f, vPhase);
+
+            // Auto-release at the note's duration, hard cutoff 0.2 s later
+            vElapsed = vElapsed + dt;
+            const SimdMask release = (hasDuration & (vElapsed >= vDuration)) & (vStage != releaseStage);
+            vStage = select(release, releaseStage, vStage);
+            vEnvTime = select(release, 0.0f, vEnvTime);
+            alive = alive.andNot(hasDuration & (vElapsed >= vCutoff));
+
+            // ADSR (each stage any lane is in is computed for all lanes,
+            // then every lane picks its own)
+            vEnvTime = vEnvTime + dt;
+            const SimdMask isAttack = vStage == attackStage;
+            const SimdMask isDecay = vStage == decayStage;
+            const SimdMask isSustain = vStage == sustainStage;
+            const SimdMask isRelease = vStage == releaseStage;
+            const SimdMask isOff = vStage == offStage;
+
+            SimdFloat attackLevel(1.0f);
+            SimdMask attackDone = isAttack;
+            if (env.attack > 0.0f && isAttack.any()) {
+                attackLevel = vEnvTime * rates.attack;
+                attackDone = isAttack & (attackLevel >= 1.0f);
+                attackLevel = select(attackDone, 1.0f, attackLevel);
+            }
+
+            SimdFloat decayLevel(env.sustain);
+            SimdMask decayDone = isDecay;
+            if (env.decay > 0.0f && isDecay.any()) {
+                const SimdFloat t = vEnvTime * rates.decay;
+                decayDone = isDecay & (t >= 1.0f);
+                decayLevel = select(decayDone, env.sustain, SimdFloat(1.0f) - t * (1.0f - env.sustain));
+            }
+
+            SimdFloat releaseLevel(0.0f);
+            SimdMask releaseDone = isRelease;
+            if (env.release > 0.0f && isRelease.any()) {
+                const SimdFloat t = vEnvTime * rates.release;
+                releaseDone = isRelease & (t >= 1.0f);
+                releaseLevel = select(releaseDone, 0.0f, SimdFloat(env.sustain) * (SimdFloat(1.0f) - t));
+            }
+
+            vLevel = select(isAttack, attackLevel,
+                     select(isDecay, decayLevel,
+                     select(isSustain, env.sustain,
+                     select(isRelease, releaseLevel, 0.0f))));
+            vStage = select(attackDone, decayStage,
+                     select(decayDone, sustainStage,
+                     select(releaseDone, offStage, vStage)));
+            vEnvTime = select(attackDone, 0.0f, vEnvTime);
+
+            float* mix = &m_batchMix[i * SIMD_LANES];
+            (SimdFloat::load(mix) + select(alive, sample * (vLevel * vVelocity), 0.0f)).store(mix);
+            alive = alive.andNot(releaseDone | isOff);
+        }
+
+        // Scatter
+        vPhase.store(phase);
+        vStage.store(stage);
+        vLevel.store(level);
+        vEnvTime.store(envTime);
+        vElapsed.store(elapsed);
+        for (int lane = 0; lane < batch.count; ++lane) {
+            Voice& v = *batch.voices[lane];
+            v.phase = phase[lane];
+            v.phaseIncrement = increment[lane];
+            v.envStage = static_cast<Voice::EnvStage>(static_cast<int>(stage[lane]));
+            v.envLevel = level[lane];
+            v.envTime = envTime[lane];
+            v.realTimeElapsed = elapsed[lane];
+            if (!alive.lane(lane)) v.active = false;
         }
-        return false;
     }
 
-private:
     // ========================================================================
     // Oscillator Generation
     // ========================================================================
@@ -587,7 +1256,7 @@ private:
                 break;
 
             case OscillatorType::Sine:
-                sample = std::sin(t * TWO_PI);
+                sample = fastSinTurns(t);
                 break;
 
             case OscillatorType::Noise:
@@ -599,7 +1268,7 @@ private:
                 break;
 
             case OscillatorType::Custom:
-                sample = generateTriangle(t, m_oscConfig.triangleSlope);
+                sample = generateWavetable(voice);
                 break;
 
             // Kicks
@@ -838,27 +1507,23 @@ private:
 
     // LFSR Noise (NES-style)
     float generateNoise(Voice& voice) {
-        // Clock LFSR based on frequency
-        static float noiseAccum = 0.0f;
-        noiseAccum += voice.phaseIncrement * 16.0f;
-
-        while (noiseAccum >= 1.0f) {
-            noiseAccum -= 1.0f;
-
-            uint16_t feedback;
-            if (m_oscConfig.noiseShortMode) {
-                // Short mode: bits 0 and 1 (more metallic)
-                feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            } else {
-                // Long mode: bits 0 and 6 (white noise)
-                feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 6)) & 1;
-            }
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
+        // Clock LFSR based on frequency. At most a clock or two per sample,
+        // where clocking one at a time beats a jump.
+        voice.noiseAccum += voice.phaseIncrement * 16.0f;
+        const LfsrTaps taps = noiseTaps();
+        while (voice.noiseAccum >= 1.0f) {
+            voice.noiseAccum -= 1.0f;
+            voice.lfsr = lfsrClock(voice.lfsr, taps);
         }
 
         return (voice.lfsr & 1) ? 1.0f : -1.0f;
     }
 
+    // Short mode: bits 0 and 1 (more metallic); long mode: bits 0 and 6 (white noise)
+    LfsrTaps noiseTaps() const {
+        return m_oscConfig.noiseShortMode ? LfsrTaps::Bit1 : LfsrTaps::Bit6;
+    }
+
     // PolyBLEP antialiasing
     float polyBlep(float t, float dt) {
         if (t < dt) {
@@ -894,7 +1559,15 @@ private:
         }
 
         // Normalize and add slight warmth
-        return std::tanh(mix * 0.14f * 1.3f);
+        return fastTanh(mix * 0.14f * 1.3f);
+    }
+
+    // Custom - band-limited wavetable, morphed by the channel config
+    float generateWavetable(Voice& voice) {
+        const Wavetable& table = (m_oscConfig.wavetable == WAVETABLE_CHANNEL && m_channelWavetable)
+            ? *m_channelWavetable
+            : m_wavetables->get(m_oscConfig.wavetable);
+        return table.sample(voice.phase, voice.phaseIncrement, m_oscConfig.wavetableMorph);
     }
 
     // ========================================================================
@@ -906,22 +1579,22 @@ private:
         float noteTime = voice.envTime;
 
         // Single clean exponential decay - no double envelope!
-        float envelope = std::exp(-noteTime * 8.0f);
+        float envelope = fastExp(-noteTime * 8.0f);
 
         // Dramatic pitch sweep from ~150Hz down to ~45Hz
         float startFreq = 150.0f;
         float endFreq = 45.0f;
-        float pitchEnv = std::exp(-noteTime * 40.0f);  // Fast pitch drop
+        float pitchEnv = fastExp(-noteTime * 40.0f);  // Fast pitch drop
         float freq = endFreq + (startFreq - endFreq) * pitchEnv;
 
         // Generate sine wave with pitch sweep
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
 
         // Update phase increment for pitch sweep
         voice.phaseIncrement = freq / m_sampleRate;
 
         // Add slight distortion/saturation for punch
-        sample = std::tanh(sample * 1.8f);
+        sample = fastTanh(sample * 1.8f);
 
         return sample * envelope;
     }
@@ -934,7 +1607,7 @@ private:
         voice.phaseIncrement = 200.0f / m_sampleRate;
 
         // Very fast decay for sharp "tsk" sound
-        float envelope = std::exp(-noteTime * 35.0f);
+        float envelope = fastExp(-noteTime * 35.0f);
 
         // Sharp click/transient at the very start
         float click = 0.0f;
@@ -944,15 +1617,12 @@ private:
 
         // High-frequency noise - clock LFSR multiple times for brighter sound
         float noise = 0.0f;
-        for (int i = 0; i < 6; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;  // Short mode for brighter sound
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 6, LfsrTaps::Bit1);  // Short mode for brighter sound
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f);
 
         // Small tonal "pop" for the body (~200Hz)
-        float toneEnv = std::exp(-noteTime * 50.0f);
-        float tone = std::sin(voice.phase * TWO_PI) * toneEnv * 0.25f;
+        float toneEnv = fastExp(-noteTime * 50.0f);
+        float tone = fastSinTurns(voice.phase) * toneEnv * 0.25f;
 
         return (click + noise * 0.6f + tone) * envelope;
     }
@@ -966,7 +1636,7 @@ private:
 
         // Fast decay with high-frequency emphasis at start for immediate "tss" attack
         // The decay is tuned so even short notes have the characteristic hi-hat sound
-        float envelope = std::exp(-noteTime * 40.0f);
+        float envelope = fastExp(-noteTime * 40.0f);
 
         // Immediate high-frequency burst at the very start (the "t" of "tss")
         float attack = noteTime < 0.005f ? (1.0f - noteTime / 0.005f) * 0.5f : 0.0f;
@@ -985,10 +1655,7 @@ private:
         // Short-mode LFSR noise for that classic metallic hi-hat sound
         // Generate more noise samples per audio sample for denser, brighter noise
         float noise = 0.0f;
-        for (int i = 0; i < 12; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;  // Short mode = metallic
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 12, LfsrTaps::Bit1);  // Short mode = metallic
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f);
 
         // Mix with more noise for that sizzly character, plus the attack burst
@@ -1000,18 +1667,18 @@ private:
         float noteTime = voice.envTime;
 
         // Pitch sweep: starts at ~180Hz, drops to ~100Hz
-        float pitchEnv = std::exp(-noteTime * 20.0f);
+        float pitchEnv = fastExp(-noteTime * 20.0f);
         float freq = 100.0f + 80.0f * pitchEnv;  // 180Hz -> 100Hz
         voice.phaseIncrement = freq / m_sampleRate;
 
         // Medium decay with slight sustain
-        float envelope = std::exp(-noteTime * 8.0f);
+        float envelope = fastExp(-noteTime * 8.0f);
 
         // Main tone
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
 
         // Add second harmonic for body
-        float harmonic = std::sin(voice.phase * TWO_PI * 2.0f) * 0.3f;
+        float harmonic = fastSinTurns(voice.phase * 2.0f) * 0.3f;
 
         // Soft attack click
         float click = 0.0f;
@@ -1020,7 +1687,7 @@ private:
         }
 
         // Slight saturation for warmth
-        sample = std::tanh((sample + harmonic) * 1.2f);
+        sample = fastTanh((sample + harmonic) * 1.2f);
 
         return (sample * 0.8f + click) * envelope;
     }
@@ -1034,19 +1701,19 @@ private:
         float noteTime = voice.envTime;
 
         // Longer decay for that deep 808 rumble
-        float envelope = std::exp(-noteTime * 5.0f);
+        float envelope = fastExp(-noteTime * 5.0f);
 
         // Lower frequencies for sub-bass
         float startFreq = 120.0f;
         float endFreq = 35.0f;
-        float pitchEnv = std::exp(-noteTime * 25.0f);
+        float pitchEnv = fastExp(-noteTime * 25.0f);
         float freq = endFreq + (startFreq - endFreq) * pitchEnv;
 
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
         voice.phaseIncrement = freq / m_sampleRate;
 
         // Soft saturation for warmth
-        sample = std::tanh(sample * 1.3f);
+        sample = fastTanh(sample * 1.3f);
 
         return sample * envelope;
     }
@@ -1056,15 +1723,15 @@ private:
         float noteTime = voice.envTime;
 
         // Fast decay for punch
-        float envelope = std::exp(-noteTime * 15.0f);
+        float envelope = fastExp(-noteTime * 15.0f);
 
         // Higher start frequency for more attack
         float startFreq = 200.0f;
         float endFreq = 55.0f;
-        float pitchEnv = std::exp(-noteTime * 60.0f);
+        float pitchEnv = fastExp(-noteTime * 60.0f);
         float freq = endFreq + (startFreq - endFreq) * pitchEnv;
 
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
         voice.phaseIncrement = freq / m_sampleRate;
 
         // Hard click transient
@@ -1074,7 +1741,7 @@ private:
         }
 
         // More distortion for punch
-        sample = std::tanh(sample * 2.5f);
+        sample = fastTanh(sample * 2.5f);
 
         return (sample + click) * envelope;
     }
@@ -1084,19 +1751,19 @@ private:
         float noteTime = voice.envTime;
 
         // Medium decay
-        float envelope = std::exp(-noteTime * 7.0f);
+        float envelope = fastExp(-noteTime * 7.0f);
 
         // Lower, gentler sweep
         float startFreq = 100.0f;
         float endFreq = 40.0f;
-        float pitchEnv = std::exp(-noteTime * 20.0f);
+        float pitchEnv = fastExp(-noteTime * 20.0f);
         float freq = endFreq + (startFreq - endFreq) * pitchEnv;
 
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
         voice.phaseIncrement = freq / m_sampleRate;
 
         // Minimal distortion for softness
-        sample = std::tanh(sample * 1.1f);
+        sample = fastTanh(sample * 1.1f);
 
         return sample * envelope;
     }
@@ -1108,19 +1775,16 @@ private:
         // Set phaseIncrement for 808 snare (~180Hz body)
         voice.phaseIncrement = 180.0f / m_sampleRate;
 
-        float envelope = std::exp(-noteTime * 20.0f);
+        float envelope = fastExp(-noteTime * 20.0f);
 
         // Tonal body - two detuned oscillators using envTime for frequency
-        float tone1 = std::sin(noteTime * 180.0f * TWO_PI);
-        float tone2 = std::sin(noteTime * 330.0f * TWO_PI);
-        float tonal = (tone1 + tone2 * 0.7f) * std::exp(-noteTime * 25.0f);
+        float tone1 = fastSinTurns(noteTime * 180.0f);
+        float tone2 = fastSinTurns(noteTime * 330.0f);
+        float tonal = (tone1 + tone2 * 0.7f) * fastExp(-noteTime * 25.0f);
 
         // Noise component
         float noise = 0.0f;
-        for (int i = 0; i < 4; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 4, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.5f;
 
         return (tonal * 0.6f + noise * 0.4f) * envelope;
@@ -1134,7 +1798,7 @@ private:
         voice.phaseIncrement = 1000.0f / m_sampleRate;
 
         // Very fast decay
-        float envelope = std::exp(-noteTime * 60.0f);
+        float envelope = fastExp(-noteTime * 60.0f);
 
         // Sharp click
         float click = 0.0f;
@@ -1143,7 +1807,7 @@ private:
         }
 
         // High frequency ping using envTime for consistent pitch
-        float ping = std::sin(noteTime * 1000.0f * TWO_PI) * std::exp(-noteTime * 80.0f);
+        float ping = fastSinTurns(noteTime * 1000.0f) * fastExp(-noteTime * 80.0f);
 
         return (click * 0.7f + ping * 0.3f) * envelope;
     }
@@ -1159,19 +1823,16 @@ private:
             float burstStart = i * burstTime;
             float localTime = noteTime - burstStart;
             if (localTime >= 0.0f && localTime < burstTime) {
-                burstEnv += std::exp(-localTime * 100.0f) * (1.0f - i * 0.15f);
+                burstEnv += fastExp(-localTime * 100.0f) * (1.0f - i * 0.15f);
             }
         }
 
         // Final tail
-        float tail = std::exp(-noteTime * 15.0f) * 0.5f;
+        float tail = fastExp(-noteTime * 15.0f) * 0.5f;
 
         // Noise
         float noise = 0.0f;
-        for (int i = 0; i < 6; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 6, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f);
 
         return noise * (burstEnv + tail) * 0.6f;
@@ -1185,7 +1846,7 @@ private:
         voice.phaseIncrement = 800.0f / m_sampleRate;
 
         // Longer decay than closed
-        float envelope = std::exp(-noteTime * 10.0f);
+        float envelope = fastExp(-noteTime * 10.0f);
 
         // Use envTime-based phase for consistent metallic sound
         float metallicPhase = noteTime * 800.0f;
@@ -1199,10 +1860,7 @@ private:
 
         // Noise
         float noise = 0.0f;
-        for (int i = 0; i < 8; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 8, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f);
 
         return (noise * 0.5f + metallic * 0.5f) * envelope;
@@ -1216,7 +1874,7 @@ private:
         voice.phaseIncrement = 900.0f / m_sampleRate;
 
         // Fast decay but not so fast that it sounds like a click
-        float envelope = std::exp(-noteTime * 60.0f);
+        float envelope = fastExp(-noteTime * 60.0f);
 
         // Quick attack burst for immediate "tick" character
         float attack = noteTime < 0.003f ? (1.0f - noteTime / 0.003f) * 0.4f : 0.0f;
@@ -1231,10 +1889,7 @@ private:
 
         // Denser noise for that "chick" sound
         float noise = 0.0f;
-        for (int i = 0; i < 8; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 8, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.6f;
 
         return (noise * 0.6f + metallic * 0.4f) * envelope + attack * noise;
@@ -1244,18 +1899,18 @@ private:
     float generateTomLow(Voice& voice) {
         float noteTime = voice.envTime;
 
-        float envelope = std::exp(-noteTime * 6.0f);
+        float envelope = fastExp(-noteTime * 6.0f);
 
         // Lower base frequency
-        float pitchEnv = std::exp(-noteTime * 15.0f);
+        float pitchEnv = fastExp(-noteTime * 15.0f);
         float basePitch = 80.0f;  // Lower than mid tom
         float freq = basePitch * (1.0f + 0.8f * pitchEnv);
 
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
         voice.phaseIncrement = freq / m_sampleRate;
 
-        float harmonic = std::sin(voice.phase * TWO_PI * 2.0f) * 0.2f;
-        sample = std::tanh((sample + harmonic) * 1.3f);
+        float harmonic = fastSinTurns(voice.phase * 2.0f) * 0.2f;
+        sample = fastTanh((sample + harmonic) * 1.3f);
 
         return sample * envelope;
     }
@@ -1264,18 +1919,18 @@ private:
     float generateTomHigh(Voice& voice) {
         float noteTime = voice.envTime;
 
-        float envelope = std::exp(-noteTime * 12.0f);
+        float envelope = fastExp(-noteTime * 12.0f);
 
         // Higher base frequency
-        float pitchEnv = std::exp(-noteTime * 25.0f);
+        float pitchEnv = fastExp(-noteTime * 25.0f);
         float basePitch = 200.0f;  // Higher than mid tom
         float freq = basePitch * (1.0f + 0.6f * pitchEnv);
 
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
         voice.phaseIncrement = freq / m_sampleRate;
 
-        float harmonic = std::sin(voice.phase * TWO_PI * 2.0f) * 0.25f;
-        sample = std::tanh((sample + harmonic) * 1.2f);
+        float harmonic = fastSinTurns(voice.phase * 2.0f) * 0.25f;
+        sample = fastTanh((sample + harmonic) * 1.2f);
 
         return sample * envelope;
     }
@@ -1288,7 +1943,7 @@ private:
         voice.phaseIncrement = 1000.0f / m_sampleRate;
 
         // Long decay
-        float envelope = std::exp(-noteTime * 3.0f);
+        float envelope = fastExp(-noteTime * 3.0f);
 
         // Initial burst
         float attack = (noteTime < 0.01f) ? (1.0f + 2.0f * (1.0f - noteTime / 0.01f)) : 1.0f;
@@ -1306,10 +1961,7 @@ private:
 
         // Noise
         float noise = 0.0f;
-        for (int i = 0; i < 10; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 10, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f);
 
         return (noise * 0.4f + metallic * 0.6f) * envelope * attack;
@@ -1323,13 +1975,13 @@ private:
         voice.phaseIncrement = 900.0f / m_sampleRate;
 
         // Medium-long decay with sustain
-        float envelope = std::exp(-noteTime * 5.0f);
+        float envelope = fastExp(-noteTime * 5.0f);
 
         // Use envTime-based phase for consistent sound
         float metallicPhase = noteTime * 900.0f;
 
         // Ping attack
-        float ping = std::sin(metallicPhase * TWO_PI * 3.0f) * std::exp(-noteTime * 30.0f) * 0.4f;
+        float ping = fastSin(metallicPhase * TWO_PI * 3.0f) * fastExp(-noteTime * 30.0f) * 0.4f;
 
         // Metallic sustain
         float metallic = 0.0f;
@@ -1339,10 +1991,7 @@ private:
 
         // Light noise
         float noise = 0.0f;
-        for (int i = 0; i < 6; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 6, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.2f;
 
         return (ping + metallic + noise) * envelope;
@@ -1352,7 +2001,7 @@ private:
     float generateCowbell(Voice& voice) {
         float noteTime = voice.envTime;
 
-        float envelope = std::exp(-noteTime * 15.0f);
+        float envelope = fastExp(-noteTime * 15.0f);
 
         // Two detuned square waves at fixed frequencies (classic 808 cowbell)
         float freq1 = 587.0f;  // D5
@@ -1375,13 +2024,13 @@ private:
         voice.phaseIncrement = 2500.0f / m_sampleRate;
 
         // Very short
-        float envelope = std::exp(-noteTime * 100.0f);
+        float envelope = fastExp(-noteTime * 100.0f);
 
         // High frequency sine burst using envTime
-        float sample = std::sin(noteTime * 2500.0f * TWO_PI);
+        float sample = fastSinTurns(noteTime * 2500.0f);
 
         // Sharp attack
-        float attack = (noteTime < 0.001f) ? 1.0f : std::exp(-(noteTime - 0.001f) * 200.0f);
+        float attack = (noteTime < 0.001f) ? 1.0f : fastExp(-(noteTime - 0.001f) * 200.0f);
 
         return sample * envelope * attack * 0.7f;
     }
@@ -1390,21 +2039,21 @@ private:
     float generateConga(Voice& voice) {
         float noteTime = voice.envTime;
 
-        float envelope = std::exp(-noteTime * 12.0f);
+        float envelope = fastExp(-noteTime * 12.0f);
 
         // Pitch envelope
-        float pitchEnv = std::exp(-noteTime * 30.0f);
+        float pitchEnv = fastExp(-noteTime * 30.0f);
         float basePitch = 250.0f;
         float freq = basePitch * (1.0f + 0.5f * pitchEnv);
 
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
         voice.phaseIncrement = freq / m_sampleRate;
 
         // Add some harmonics for body
-        float harm2 = std::sin(voice.phase * TWO_PI * 2.0f) * 0.3f;
-        float harm3 = std::sin(voice.phase * TWO_PI * 3.0f) * 0.15f;
+        float harm2 = fastSinTurns(voice.phase * 2.0f) * 0.3f;
+        float harm3 = fastSin(voice.phase * TWO_PI * 3.0f) * 0.15f;
 
-        sample = std::tanh((sample + harm2 + harm3) * 1.4f);
+        sample = fastTanh((sample + harm2 + harm3) * 1.4f);
 
         // Slap attack
         float slap = 0.0f;
@@ -1420,14 +2069,11 @@ private:
         float noteTime = voice.envTime;
 
         // Fast decay
-        float envelope = std::exp(-noteTime * 50.0f);
+        float envelope = fastExp(-noteTime * 50.0f);
 
         // High-frequency noise
         float noise = 0.0f;
-        for (int i = 0; i < 12; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 6)) & 1;  // Long mode for variety
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 12, LfsrTaps::Bit6);  // Long mode for variety
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f);
 
         // High-pass effect (reduce low frequencies)
@@ -1443,7 +2089,7 @@ private:
         // Set fixed phase increment (must be FIRST)
         voice.phaseIncrement = 1200.0f / m_sampleRate;
 
-        float envelope = std::exp(-noteTime * 25.0f);
+        float envelope = fastExp(-noteTime * 25.0f);
 
         // Use envTime-based phase for consistent jingle sound
         float jinglePhase = noteTime * 1200.0f;
@@ -1457,10 +2103,7 @@ private:
 
         // Noise component
         float noise = 0.0f;
-        for (int i = 0; i < 8; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 8, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.3f;
 
         return (jingle + noise) * envelope;
@@ -1485,25 +2128,15 @@ private:
         saw2 -= polyBlep(std::fmod(t + detune, 1.0f), dt);
 
         // Mix with slight sub oscillator
-        float sub = std::sin(t * TWO_PI * 0.5f) * 0.3f;
+        float sub = fastSinTurns(t * 0.5f) * 0.3f;
 
         return (saw1 + saw2) * 0.4f + sub;
     }
 
     // Pad - Soft, atmospheric sound with slow attack feel
     float generateSynthPad(Voice& voice) {
-        float t = voice.phase;
-
-        // Multiple detuned sine/triangle waves for soft pad
-        float wave1 = std::sin(t * TWO_PI);
-        float wave2 = std::sin(t * TWO_PI * 1.002f);  // Slight detune
-        float wave3 = std::sin(t * TWO_PI * 0.998f);  // Slight detune other way
-        float wave4 = std::sin(t * TWO_PI * 2.0f) * 0.3f;  // Octave up, quieter
-
-        // Gentle triangle for warmth
-        float tri = (t < 0.5f) ? (4.0f * t - 1.0f) : (3.0f - 4.0f * t);
-
-        return (wave1 + wave2 + wave3 + wave4 + tri * 0.2f) * 0.25f;
+        // Multiple detuned sine/triangle waves for soft pad (baked into a table)
+        return m_wavetables->get(BuiltinWavetable::Pad).sample(voice.phase, voice.phaseIncrement);
     }
 
     // Bass - Deep punchy bass with sub and harmonics
@@ -1512,7 +2145,7 @@ private:
         float dt = voice.phaseIncrement;
 
         // Sub sine (fundamental)
-        float sub = std::sin(t * TWO_PI) * 0.6f;
+        float sub = fastSinTurns(t) * 0.6f;
 
         // Saw for harmonics
         float saw = 2.0f * t - 1.0f;
@@ -1534,8 +2167,8 @@ private:
         float tri = (t < 0.5f) ? (4.0f * t - 1.0f) : (3.0f - 4.0f * t);
 
         // Add some upper harmonics for brightness
-        float harm2 = std::sin(t * TWO_PI * 2.0f) * 0.3f;
-        float harm3 = std::sin(t * TWO_PI * 3.0f) * 0.15f;
+        float harm2 = fastSinTurns(t * 2.0f) * 0.3f;
+        float harm3 = fastSin(t * TWO_PI * 3.0f) * 0.15f;
 
         return tri * 0.7f + harm2 + harm3;
     }
@@ -1556,16 +2189,8 @@ private:
 
     // Organ - Classic organ with additive harmonics
     float generateSynthOrgan(Voice& voice) {
-        float t = voice.phase;
-
-        // Drawbar-style additive synthesis
-        float fundamental = std::sin(t * TWO_PI) * 0.8f;         // 8'
-        float octaveUp = std::sin(t * TWO_PI * 2.0f) * 0.6f;     // 4'
-        float twelfth = std::sin(t * TWO_PI * 3.0f) * 0.4f;      // 2 2/3'
-        float twoOctUp = std::sin(t * TWO_PI * 4.0f) * 0.3f;     // 2'
-        float subOctave = std::sin(t * TWO_PI * 0.5f) * 0.4f;    // 16'
-
-        return (fundamental + octaveUp + twelfth + twoOctUp + subOctave) * 0.35f;
+        // Drawbar-style additive synthesis (baked into a table)
+        return m_wavetables->get(BuiltinWavetable::Organ).sample(voice.phase, voice.phaseIncrement);
     }
 
     // Strings - Detuned ensemble with lush character
@@ -1602,7 +2227,7 @@ private:
         sq -= polyBlep(std::fmod(t + 0.5f, 1.0f), dt);
 
         // Add harmonics for brass character
-        float harm3 = std::sin(t * TWO_PI * 3.0f) * 0.2f;
+        float harm3 = fastSin(t * TWO_PI * 3.0f) * 0.2f;
 
         return (saw * 0.5f + sq * 0.3f + harm3) * 0.8f;
     }
@@ -1623,20 +2248,9 @@ private:
 
     // Bell - FM-like bell/chime sound
     float generateSynthBell(Voice& voice) {
-        float t = voice.phase;
-
-        // Simple FM-like synthesis for bell tones
-        // Carrier with inharmonic modulator
-        float modRatio = 3.5f;  // Inharmonic for bell-like quality
-        float modIndex = 2.0f;
-
-        float modulator = std::sin(t * TWO_PI * modRatio);
-        float carrier = std::sin(t * TWO_PI + modulator * modIndex);
-
-        // Add higher partial for shimmer
-        float shimmer = std::sin(t * TWO_PI * 5.0f) * 0.15f;
-
-        return (carrier * 0.7f + shimmer) * 0.8f;
+        // FM-like bell: carrier with an inharmonic 3.5x modulator plus a
+        // shimmer partial (baked into a table)
+        return m_wavetables->get(BuiltinWavetable::Bell).sample(voice.phase, voice.phaseIncrement);
     }
 
     // ========================================================================
@@ -1649,7 +2263,7 @@ private:
         float dt = voice.phaseIncrement;
 
         // Animated PWM (pulse width modulation)
-        float pwmLfo = 0.3f + 0.2f * std::sin(voice.envTime * 4.0f);  // PWM between 0.1 and 0.5
+        float pwmLfo = 0.3f + 0.2f * fastSin(voice.envTime * 4.0f);  // PWM between 0.1 and 0.5
 
         // Main pulse with animated width
         float pulse = (t < pwmLfo) ? 1.0f : -1.0f;
@@ -1661,7 +2275,7 @@ private:
         saw -= polyBlep(t, dt);
 
         // Slight octave-up for brightness
-        float octUp = std::sin(t * TWO_PI * 2.0f) * 0.15f;
+        float octUp = fastSinTurns(t * 2.0f) * 0.15f;
 
         return (pulse * 0.5f + saw * 0.3f + octUp) * 0.75f;
     }
@@ -1672,7 +2286,7 @@ private:
         float dt = voice.phaseIncrement;
 
         // Strong sub sine (foundation)
-        float sub = std::sin(t * TWO_PI) * 0.7f;
+        float sub = fastSinTurns(t) * 0.7f;
 
         // Saw for harmonics and grit
         float saw = 2.0f * t - 1.0f;
@@ -1685,7 +2299,7 @@ private:
 
         // Soft saturation for warmth
         float mix = sub + (saw + saw2) * 0.25f;
-        return std::tanh(mix * 1.2f) * 0.8f;
+        return fastTanh(mix * 1.2f) * 0.8f;
     }
 
     // SynthwavePad - Warm lush evolving pad (classic synthwave atmosphere)
@@ -1705,10 +2319,10 @@ private:
         }
 
         // Slow LFO for movement
-        float lfo = 0.3f * std::sin(voice.envTime * 1.5f);
+        float lfo = 0.3f * fastSin(voice.envTime * 1.5f);
 
         // Add soft sine layer
-        float sine = std::sin(t * TWO_PI) * 0.3f;
+        float sine = fastSinTurns(t) * 0.3f;
 
         return (mix * 0.12f + sine * (1.0f + lfo * 0.3f)) * 0.7f;
     }
@@ -1729,7 +2343,7 @@ private:
         saw -= polyBlep(t, dt);
 
         // Octave up sine for shimmer
-        float shimmer = std::sin(t * TWO_PI * 2.0f) * 0.1f;
+        float shimmer = fastSinTurns(t * 2.0f) * 0.1f;
 
         return (pulse * 0.6f + saw * 0.2f + shimmer) * 0.8f;
     }
@@ -1740,7 +2354,7 @@ private:
         float dt = voice.phaseIncrement;
 
         // PWM with slow modulation
-        float pwm = 0.45f + 0.1f * std::sin(voice.envTime * 2.0f);
+        float pwm = 0.45f + 0.1f * fastSin(voice.envTime * 2.0f);
 
         // Two slightly detuned pulses
         float pulse1 = (t < pwm) ? 1.0f : -1.0f;
@@ -1753,38 +2367,21 @@ private:
         pulse2 -= polyBlep(std::fmod(phase2 + (1.0f - pwm), 1.0f), dt);
 
         // Add sine for warmth
-        float sine = std::sin(t * TWO_PI) * 0.2f;
+        float sine = fastSinTurns(t) * 0.2f;
 
         // Subtle chorus-like detuning
-        float chorus = std::sin(t * TWO_PI * 1.003f) * 0.1f;
+        float chorus = fastSin(t * TWO_PI * 1.003f) * 0.1f;
 
         return ((pulse1 + pulse2) * 0.35f + sine + chorus) * 0.7f;
     }
 
     // SynthwaveFM - Classic DX7-style FM brass/keys
     float generateSynthwaveFM(Voice& voice) {
-        float t = voice.phase;
-
-        // Classic FM algorithm: 2 operators
-        // Modulator -> Carrier
-
-        // Operator 2 (modulator) - ratio 2:1 or 3:1 for brass
-        float modRatio = 2.0f;
-        float modIndex = 2.5f + 0.5f * std::sin(voice.envTime * 3.0f);  // Animated mod index
-
-        float modulator = std::sin(t * TWO_PI * modRatio);
-
-        // Operator 1 (carrier)
-        float carrier = std::sin(t * TWO_PI + modulator * modIndex);
-
-        // Add second carrier at slight detune for thickness
-        float carrier2 = std::sin(t * TWO_PI * 1.002f + modulator * modIndex * 0.8f);
-
-        // Optional: Add brightness with higher ratio modulator
-        float brightMod = std::sin(t * TWO_PI * 4.0f) * 0.3f;
-        float bright = std::sin(t * TWO_PI * 2.0f + brightMod) * 0.15f;
-
-        return (carrier * 0.5f + carrier2 * 0.3f + bright) * 0.75f;
+        // Classic 2-operator FM (2:1 modulator) with a detuned second
+        // carrier. The table holds one frame per modulation index; the
+        // animated index (2 to 3) morphs through them.
+        const float morph = 0.5f + 0.5f * fastSin(voice.envTime * 3.0f);
+        return m_wavetables->get(BuiltinWavetable::FM).sample(voice.phase, voice.phaseIncrement, morph);
     }
 
     // ========================================================================
@@ -1801,11 +2398,11 @@ private:
         saw -= polyBlep(t, dt);
 
         // Resonant filter simulation with envelope
-        float filterEnv = std::exp(-voice.envTime * 4.0f);  // Fast decay
+        float filterEnv = fastExp(-voice.envTime * 4.0f);  // Fast decay
         float cutoff = 0.2f + 0.6f * filterEnv;  // Filter opens then closes
 
         // Simple resonant lowpass approximation
-        static float filterState = 0.0f;
+        float& filterState = voice.filterState;
         float resonance = 0.85f;
         filterState += cutoff * (saw - filterState + resonance * (filterState - filterState));
         float filtered = filterState + (saw - filterState) * cutoff;
@@ -1813,7 +2410,7 @@ private:
         // Add some squelch/accent
         float accent = 1.0f + filterEnv * 0.5f;
 
-        return std::tanh(filtered * accent * 1.5f) * 0.8f;
+        return fastTanh(filtered * accent * 1.5f) * 0.8f;
     }
 
     // TechnoStab - Short chord stab
@@ -1821,15 +2418,15 @@ private:
         float t = voice.phase;
 
         // Minor chord stab (root, minor 3rd, 5th)
-        float root = std::sin(t * TWO_PI);
-        float minor3rd = std::sin(t * TWO_PI * 1.189f);  // ~3 semitones up
-        float fifth = std::sin(t * TWO_PI * 1.498f);     // ~7 semitones up
+        float root = fastSinTurns(t);
+        float minor3rd = fastSin(t * TWO_PI * 1.189f);  // ~3 semitones up
+        float fifth = fastSin(t * TWO_PI * 1.498f);     // ~7 semitones up
 
         // Add saw for edge
         float saw = (2.0f * t - 1.0f) * 0.3f;
 
         // Quick decay for stab effect
-        float stab = std::exp(-voice.envTime * 8.0f);
+        float stab = fastExp(-voice.envTime * 8.0f);
 
         return ((root + minor3rd * 0.8f + fifth * 0.6f) * 0.25f + saw) * stab * 0.9f;
     }
@@ -1850,13 +2447,13 @@ private:
         }
 
         // Add some PWM for movement
-        float pwm = std::sin(voice.envTime * 3.0f) * 0.2f + 0.5f;
+        float pwm = fastSin(voice.envTime * 3.0f) * 0.2f + 0.5f;
         float pulse = (t < pwm) ? 1.0f : -1.0f;
 
         // Pitch bend down effect (characteristic hoover portamento)
-        float bend = std::exp(-voice.envTime * 0.5f);
+        float bend = fastExp(-voice.envTime * 0.5f);
 
-        return std::tanh((mix * 0.12f + pulse * 0.15f) * (0.7f + bend * 0.3f)) * 0.85f;
+        return fastTanh((mix * 0.12f + pulse * 0.15f) * (0.7f + bend * 0.3f)) * 0.85f;
     }
 
     // RaveChord - Rave piano/organ chord
@@ -1864,16 +2461,16 @@ private:
         float t = voice.phase;
 
         // Major chord (root, major 3rd, 5th, octave)
-        float root = std::sin(t * TWO_PI);
-        float major3rd = std::sin(t * TWO_PI * 1.26f);   // ~4 semitones
-        float fifth = std::sin(t * TWO_PI * 1.498f);     // ~7 semitones
-        float octave = std::sin(t * TWO_PI * 2.0f);
+        float root = fastSinTurns(t);
+        float major3rd = fastSin(t * TWO_PI * 1.26f);   // ~4 semitones
+        float fifth = fastSin(t * TWO_PI * 1.498f);     // ~7 semitones
+        float octave = fastSinTurns(t * 2.0f);
 
         // Add some brightness with higher harmonics
-        float bright = std::sin(t * TWO_PI * 3.0f) * 0.2f + std::sin(t * TWO_PI * 4.0f) * 0.1f;
+        float bright = fastSin(t * TWO_PI * 3.0f) * 0.2f + fastSinTurns(t * 4.0f) * 0.1f;
 
         // Organ-like attack
-        float attack = 1.0f - std::exp(-voice.envTime * 20.0f);
+        float attack = 1.0f - fastExp(-voice.envTime * 20.0f);
 
         return (root * 0.4f + major3rd * 0.3f + fifth * 0.25f + octave * 0.15f + bright) * attack * 0.6f;
     }
@@ -1894,11 +2491,11 @@ private:
         saw2 -= polyBlep(phase2, dt * 1.008f);
 
         // Modulate the detune amount over time (the "reese" wobble)
-        float wobble = std::sin(voice.envTime * 4.0f) * 0.003f;
+        float wobble = fastSin(voice.envTime * 4.0f) * 0.003f;
         float phase3 = std::fmod(t * (1.0f + wobble) + 0.6f, 1.0f);
         float saw3 = 2.0f * phase3 - 1.0f;
 
-        return std::tanh((saw1 + saw2 + saw3) * 0.4f) * 0.85f;
+        return fastTanh((saw1 + saw2 + saw3) * 0.4f) * 0.85f;
     }
 
     // ========================================================================
@@ -1910,17 +2507,17 @@ private:
         float t = voice.phase;
 
         // Pure sub sine with slight harmonics
-        float sub = std::sin(t * TWO_PI);
+        float sub = fastSinTurns(t);
 
         // Add subtle second harmonic for warmth
-        float second = std::sin(t * TWO_PI * 2.0f) * 0.15f;
+        float second = fastSinTurns(t * 2.0f) * 0.15f;
 
         // Pitch drop at start (808 characteristic)
-        float pitchEnv = 1.0f + std::exp(-voice.envTime * 15.0f) * 0.3f;
-        float dropped = std::sin(t * TWO_PI * pitchEnv);
+        float pitchEnv = 1.0f + fastExp(-voice.envTime * 15.0f) * 0.3f;
+        float dropped = fastSin(t * TWO_PI * pitchEnv);
 
         // Soft saturation
-        return std::tanh((dropped * 0.8f + sub * 0.2f + second) * 1.2f) * 0.9f;
+        return fastTanh((dropped * 0.8f + sub * 0.2f + second) * 1.2f) * 0.9f;
     }
 
     // LoFiKeys - Dusty lo-fi piano/rhodes
@@ -1928,17 +2525,17 @@ private:
         float t = voice.phase;
 
         // Electric piano-like FM
-        float modulator = std::sin(t * TWO_PI * 7.0f);
-        float carrier = std::sin(t * TWO_PI + modulator * 0.8f);
+        float modulator = fastSin(t * TWO_PI * 7.0f);
+        float carrier = fastSin(t * TWO_PI + modulator * 0.8f);
 
         // Add second voice for richness
-        float carrier2 = std::sin(t * TWO_PI * 2.0f + modulator * 0.4f);
+        float carrier2 = fastSin(t * TWO_PI * 2.0f + modulator * 0.4f);
 
         // Bell-like decay
-        float decay = std::exp(-voice.envTime * 3.0f);
+        float decay = fastExp(-voice.envTime * 3.0f);
 
         // Add noise/dust
-        float noise = (static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f) * 0.02f;
+        float noise = randomBipolar() * 0.02f;
 
         // Bit crush effect for lo-fi
         float sample = (carrier * 0.6f + carrier2 * 0.3f) * decay + noise;
@@ -1950,21 +2547,20 @@ private:
     // VinylNoise - Vinyl crackle texture
     float generateVinylNoise(Voice& voice) {
         // Continuous vinyl texture
-        float noise = (static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f);
+        float noise = randomBipolar();
 
         // Crackle (occasional pops)
         float crackle = 0.0f;
-        if (rand() % 1000 < 3) {  // Occasional pop
-            crackle = (static_cast<float>(rand()) / RAND_MAX * 2.0f - 1.0f) * 0.5f;
+        if (nextRandom() % 1000 < 3) {  // Occasional pop
+            crackle = randomBipolar() * 0.5f;
         }
 
         // Rumble (low frequency content)
-        float rumble = std::sin(voice.phase * TWO_PI * 0.1f) * 0.1f;
+        float rumble = fastSin(voice.phase * TWO_PI * 0.1f) * 0.1f;
 
         // High-pass the noise for hiss
-        static float hissFilter = 0.0f;
-        hissFilter = hissFilter * 0.95f + noise * 0.05f;
-        float hiss = noise - hissFilter;
+        voice.hissFilter = voice.hissFilter * 0.95f + noise * 0.05f;
+        float hiss = noise - voice.hissFilter;
 
         return (hiss * 0.3f + crackle + rumble) * 0.4f;
     }
@@ -1980,13 +2576,13 @@ private:
         square -= polyBlep(std::fmod(t + 0.5f, 1.0f), dt);
 
         // Add portamento/pitch slide feel
-        float pitchEnv = 1.0f + std::exp(-voice.envTime * 20.0f) * 0.15f;
+        float pitchEnv = 1.0f + fastExp(-voice.envTime * 20.0f) * 0.15f;
 
         // Plucky envelope
-        float pluck = std::exp(-voice.envTime * 6.0f);
+        float pluck = fastExp(-voice.envTime * 6.0f);
 
         // Add some harmonics
-        float octave = std::sin(t * TWO_PI * 2.0f * pitchEnv) * 0.3f;
+        float octave = fastSin(t * TWO_PI * 2.0f * pitchEnv) * 0.3f;
 
         return (square * 0.6f + octave) * pluck * 0.8f;
     }
@@ -2000,23 +2596,22 @@ private:
         float t = voice.phase;
 
         // Lush pad base (multiple detuned sines)
-        float pad1 = std::sin(t * TWO_PI);
-        float pad2 = std::sin(t * TWO_PI * 1.002f);
-        float pad3 = std::sin(t * TWO_PI * 0.998f);
-        float pad4 = std::sin(t * TWO_PI * 2.0f) * 0.3f;  // Octave
+        float pad1 = fastSinTurns(t);
+        float pad2 = fastSin(t * TWO_PI * 1.002f);
+        float pad3 = fastSin(t * TWO_PI * 0.998f);
+        float pad4 = fastSinTurns(t * 2.0f) * 0.3f;  // Octave
 
         float pad = (pad1 + pad2 + pad3) * 0.3f + pad4;
 
         // Gate effect (rhythmic amplitude modulation)
         // Simulate 1/8 note gate at ~120 BPM (4 gates per second)
         float gateFreq = 4.0f;
-        float gate = (std::sin(voice.envTime * TWO_PI * gateFreq) > 0.0f) ? 1.0f : 0.2f;
+        float gate = (fastSin(voice.envTime * TWO_PI * gateFreq) > 0.0f) ? 1.0f : 0.2f;
 
         // Smooth the gate slightly
-        static float gateSmooth = 1.0f;
-        gateSmooth += (gate - gateSmooth) * 0.1f;
+        voice.gateSmooth += (gate - voice.gateSmooth) * 0.1f;
 
-        return pad * gateSmooth * 0.7f;
+        return pad * voice.gateSmooth * 0.7f;
     }
 
     // PolySynth - Rich polyphonic synth
@@ -2028,18 +2623,18 @@ private:
         float saw = 2.0f * t - 1.0f;
         saw -= polyBlep(t, dt);
 
-        float pwm = std::sin(voice.envTime * 2.0f) * 0.15f + 0.5f;
+        float pwm = fastSin(voice.envTime * 2.0f) * 0.15f + 0.5f;
         float pulse = (t < pwm) ? 1.0f : -1.0f;
 
         // Sub oscillator
-        float sub = std::sin(t * TWO_PI * 0.5f) * 0.4f;
+        float sub = fastSinTurns(t * 0.5f) * 0.4f;
 
         // Detuned layer
         float detunedPhase = std::fmod(t * 1.003f + 0.25f, 1.0f);
         float detuned = 2.0f * detunedPhase - 1.0f;
 
         // Filter-like envelope
-        float brightness = 0.3f + 0.7f * std::exp(-voice.envTime * 2.0f);
+        float brightness = 0.3f + 0.7f * fastExp(-voice.envTime * 2.0f);
 
         return ((saw * 0.3f + pulse * 0.25f + detuned * 0.2f) * brightness + sub) * 0.7f;
     }
@@ -2051,7 +2646,7 @@ private:
         // Hard sync: slave oscillator resets when master completes cycle
         // Simulate by using master as reset trigger
         float masterFreq = 1.0f;
-        float slaveRatio = 2.5f + std::sin(voice.envTime * 3.0f) * 0.5f;  // Animated ratio
+        float slaveRatio = 2.5f + fastSin(voice.envTime * 3.0f) * 0.5f;  // Animated ratio
 
         float masterPhase = t;
         float slavePhase = std::fmod(t * slaveRatio, 1.0f);
@@ -2060,12 +2655,12 @@ private:
         float slave = 2.0f * slavePhase - 1.0f;
 
         // Add brightness based on sync ratio
-        float harmonic = std::sin(slavePhase * TWO_PI * 2.0f) * 0.3f;
+        float harmonic = fastSinTurns(slavePhase * 2.0f) * 0.3f;
 
         // Characteristic sync "bark" at attack
-        float bark = std::exp(-voice.envTime * 10.0f) * 0.3f;
+        float bark = fastExp(-voice.envTime * 10.0f) * 0.3f;
 
-        return (slave * 0.6f + harmonic + bark * std::sin(t * TWO_PI * 5.0f)) * 0.75f;
+        return (slave * 0.6f + harmonic + bark * fastSin(t * TWO_PI * 5.0f)) * 0.75f;
     }
 
     // ========================================================================
@@ -2080,14 +2675,14 @@ private:
         float noteTime = voice.envTime;
 
         // Dramatic pitch drop (808-style) - more pronounced for reggaeton
-        float pitchEnv = std::exp(-noteTime * 18.0f);
+        float pitchEnv = fastExp(-noteTime * 18.0f);
         float pitchMult = 1.0f + pitchEnv * 0.6f;  // Starts higher, drops fast
 
         // Strong sub sine (foundation) - lower octave
-        float sub = std::sin(t * TWO_PI * 0.5f) * 0.6f;
+        float sub = fastSinTurns(t * 0.5f) * 0.6f;
 
         // Main tone with pitch sweep
-        float main = std::sin(t * TWO_PI * pitchMult);
+        float main = fastSin(t * TWO_PI * pitchMult);
 
         // Add subtle saw for presence (lo-fi filtered)
         float saw = 2.0f * t - 1.0f;
@@ -2102,7 +2697,7 @@ private:
         mix = std::floor(mix * bitDepth) / bitDepth;
 
         // Heavy saturation for that thick reggaeton punch
-        return std::tanh(mix * 2.5f) * 0.9f;
+        return fastTanh(mix * 2.5f) * 0.9f;
     }
 
     // LatinBrass - Punchy brass stab for reggaeton hooks and perreo breaks
@@ -2113,7 +2708,7 @@ private:
         float noteTime = voice.envTime;
 
         // Fast attack, quick decay for stab feel
-        float stabEnv = std::exp(-noteTime * 8.0f);
+        float stabEnv = fastExp(-noteTime * 8.0f);
 
         // Main sawtooth for brass character
         float saw = 2.0f * t - 1.0f;
@@ -2125,12 +2720,12 @@ private:
         sq -= polyBlep(std::fmod(t + 0.5f, 1.0f), dt);
 
         // Brass harmonics (odd harmonics for brass character)
-        float harm3 = std::sin(t * TWO_PI * 3.0f) * 0.35f;
-        float harm5 = std::sin(t * TWO_PI * 5.0f) * 0.2f;
-        float harm7 = std::sin(t * TWO_PI * 7.0f) * 0.1f;
+        float harm3 = fastSin(t * TWO_PI * 3.0f) * 0.35f;
+        float harm5 = fastSin(t * TWO_PI * 5.0f) * 0.2f;
+        float harm7 = fastSin(t * TWO_PI * 7.0f) * 0.1f;
 
         // Brightness envelope - opens up quickly then closes for stab
-        float brightness = 0.3f + 0.7f * std::exp(-noteTime * 6.0f);
+        float brightness = 0.3f + 0.7f * fastExp(-noteTime * 6.0f);
 
         // Detuned layer for thickness (typical of latin brass sections)
         float phase2 = std::fmod(t + 0.007f, 1.0f);
@@ -2142,7 +2737,7 @@ private:
                     harm3 + harm5 + harm7) * brightness;
 
         // Punchy saturation
-        return std::tanh(mix * 1.8f) * stabEnv * 0.85f;
+        return fastTanh(mix * 1.8f) * stabEnv * 0.85f;
     }
 
     // Guira - Scraped metal percussion (essential dembow "tsss-tsss")
@@ -2154,8 +2749,8 @@ private:
         voice.phaseIncrement = 2500.0f / m_sampleRate;
 
         // Two-stage envelope: initial attack + scraping tail
-        float attackEnv = std::exp(-noteTime * 60.0f);  // Sharp initial hit
-        float scrapeEnv = std::exp(-noteTime * 25.0f);  // Longer scrape
+        float attackEnv = fastExp(-noteTime * 60.0f);  // Sharp initial hit
+        float scrapeEnv = fastExp(-noteTime * 25.0f);  // Longer scrape
         float envelope = attackEnv * 0.4f + scrapeEnv * 0.6f;
 
         // High-frequency metallic components (guira has bright, cutting sound)
@@ -2171,17 +2766,14 @@ private:
 
         // High-frequency noise for scraping texture
         float noise = 0.0f;
-        for (int i = 0; i < 8; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 8, LfsrTaps::Bit1);
         noise = ((voice.lfsr & 1) ? 1.0f : -1.0f);
 
         // Emphasize high frequencies by mixing more metallic than noise
         float sample = metallic * 0.55f + noise * 0.45f;
 
         // Add slight resonance/ring
-        float ring = std::sin(noteTime * TWO_PI * 4500.0f) * 0.15f * scrapeEnv;
+        float ring = fastSin(noteTime * TWO_PI * 4500.0f) * 0.15f * scrapeEnv;
 
         return (sample + ring) * envelope * 0.75f;
     }
@@ -2192,38 +2784,37 @@ private:
         float noteTime = voice.envTime;
 
         // Two-stage envelope for realistic membrane
-        float attackEnv = std::exp(-noteTime * 35.0f);  // Sharp attack
-        float bodyEnv = std::exp(-noteTime * 12.0f);    // Body resonance
+        float attackEnv = fastExp(-noteTime * 35.0f);  // Sharp attack
+        float bodyEnv = fastExp(-noteTime * 12.0f);    // Body resonance
         float envelope = attackEnv * 0.3f + bodyEnv * 0.7f;
 
         // Pitch envelope for that characteristic bongo "pon/tok"
-        float pitchEnv = std::exp(-noteTime * 40.0f);
+        float pitchEnv = fastExp(-noteTime * 40.0f);
         float basePitch = 380.0f;  // Macho (higher) bongo pitch
         float freq = basePitch * (1.0f + 0.5f * pitchEnv);
 
         // Main membrane tone
         voice.phaseIncrement = freq / m_sampleRate;
-        float tone = std::sin(voice.phase * TWO_PI);
+        float tone = fastSinTurns(voice.phase);
 
         // Membrane harmonics (slightly inharmonic like real drum heads)
-        float harm2 = std::sin(voice.phase * TWO_PI * 1.59f) * 0.4f;  // Inharmonic
-        float harm3 = std::sin(voice.phase * TWO_PI * 2.14f) * 0.25f; // Inharmonic
-        float harm4 = std::sin(voice.phase * TWO_PI * 2.65f) * 0.15f; // Inharmonic
+        float harm2 = fastSin(voice.phase * TWO_PI * 1.59f) * 0.4f;  // Inharmonic
+        float harm3 = fastSin(voice.phase * TWO_PI * 2.14f) * 0.25f; // Inharmonic
+        float harm4 = fastSin(voice.phase * TWO_PI * 2.65f) * 0.15f; // Inharmonic
 
         // Sharp slap transient (hand strike)
         float slap = 0.0f;
         if (noteTime < 0.004f) {
             // Noise burst for slap
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
+            voice.lfsr = lfsrClock(voice.lfsr, LfsrTaps::Bit1);
             slap = ((voice.lfsr & 1) ? 1.0f : -1.0f) * (1.0f - noteTime / 0.004f) * 0.5f;
         }
 
         // Body resonance (shell)
-        float body = std::sin(voice.phase * TWO_PI * 0.5f) * 0.2f;
+        float body = fastSinTurns(voice.phase * 0.5f) * 0.2f;
 
         float sample = tone + harm2 + harm3 + harm4 + body;
-        sample = std::tanh(sample * 1.2f);
+        sample = fastTanh(sample * 1.2f);
 
         return (sample + slap) * envelope * 0.8f;
     }
@@ -2234,11 +2825,11 @@ private:
         float noteTime = voice.envTime;
 
         // Very fast decay - tight and cutting
-        float envelope = std::exp(-noteTime * 45.0f);
+        float envelope = fastExp(-noteTime * 45.0f);
 
         // High pitch with slight drop
         float basePitch = 800.0f;  // Bright, cutting
-        float pitchEnv = std::exp(-noteTime * 50.0f);
+        float pitchEnv = fastExp(-noteTime * 50.0f);
         float freq = basePitch * (1.0f + 0.25f * pitchEnv);
 
         voice.phaseIncrement = freq / m_sampleRate;
@@ -2247,9 +2838,9 @@ private:
         float sq = (voice.phase < 0.5f) ? 1.0f : -1.0f;
 
         // Metallic ring components (timbales have distinct ring)
-        float ring1 = std::sin(voice.phase * TWO_PI * 2.71f) * 0.25f;  // Inharmonic
-        float ring2 = std::sin(voice.phase * TWO_PI * 4.13f) * 0.15f;  // Inharmonic
-        float ring3 = std::sin(voice.phase * TWO_PI * 5.89f) * 0.1f;   // High shimmer
+        float ring1 = fastSin(voice.phase * TWO_PI * 2.71f) * 0.25f;  // Inharmonic
+        float ring2 = fastSin(voice.phase * TWO_PI * 4.13f) * 0.15f;  // Inharmonic
+        float ring3 = fastSin(voice.phase * TWO_PI * 5.89f) * 0.1f;   // High shimmer
 
         // Very sharp attack click (stick hit)
         float click = 0.0f;
@@ -2268,22 +2859,22 @@ private:
         float noteTime = voice.envTime;
 
         // Tighter envelope - cuts off before tonal bass emerges
-        float envelope = std::exp(-noteTime * 10.0f);
+        float envelope = fastExp(-noteTime * 10.0f);
         // Gate it shorter
-        if (noteTime > 0.15f) envelope *= std::exp(-(noteTime - 0.15f) * 20.0f);
+        if (noteTime > 0.15f) envelope *= fastExp(-(noteTime - 0.15f) * 20.0f);
 
         // Quick pitch sweep - becomes unpitched quickly
         float startFreq = 90.0f;   // Lower start (less pitched)
         float endFreq = 35.0f;     // Deep sub
-        float pitchEnv = std::exp(-noteTime * 50.0f);  // Faster sweep
+        float pitchEnv = fastExp(-noteTime * 50.0f);  // Faster sweep
         float freq = endFreq + (startFreq - endFreq) * pitchEnv;
 
         // Generate sine wave with pitch sweep
         voice.phaseIncrement = freq / m_sampleRate;
-        float sample = std::sin(voice.phase * TWO_PI);
+        float sample = fastSinTurns(voice.phase);
 
         // Add second harmonic for body (not brightness)
-        float harm2 = std::sin(voice.phase * TWO_PI * 2.0f) * 0.15f;
+        float harm2 = fastSinTurns(voice.phase * 2.0f) * 0.15f;
 
         // Lo-fi processing (12-bit style quantization)
         float mix = sample + harm2;
@@ -2293,11 +2884,11 @@ private:
         // Subtle "thump" attack (not clicky - dull and round)
         float thump = 0.0f;
         if (noteTime < 0.008f) {
-            thump = std::sin(noteTime * 800.0f) * (1.0f - noteTime / 0.008f) * 0.25f;
+            thump = fastSin(noteTime * 800.0f) * (1.0f - noteTime / 0.008f) * 0.25f;
         }
 
         // Warm, dull saturation (not harsh)
-        mix = std::tanh(mix * 1.3f);
+        mix = fastTanh(mix * 1.3f);
 
         return (mix + thump) * envelope * 0.9f;
     }
@@ -2308,57 +2899,45 @@ private:
         float noteTime = voice.envTime;
 
         // Very tight envelope - no tail
-        float envelope = std::exp(-noteTime * 35.0f);
+        float envelope = fastExp(-noteTime * 35.0f);
         // Hard gate after short time
-        if (noteTime > 0.08f) envelope *= std::exp(-(noteTime - 0.08f) * 50.0f);
+        if (noteTime > 0.08f) envelope *= fastExp(-(noteTime - 0.08f) * 50.0f);
 
         // Multiple noise bursts (clap-like - multiple hands hitting)
         float clap = 0.0f;
 
         // First burst
         if (noteTime < 0.015f) {
-            for (int i = 0; i < 6; ++i) {
-                uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-                voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-            }
+            voice.lfsr = lfsrAdvance(voice.lfsr, 6, LfsrTaps::Bit1);
             clap += ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.5f;
         }
         // Second burst (slightly delayed for clap character)
         if (noteTime > 0.008f && noteTime < 0.025f) {
-            for (int i = 0; i < 4; ++i) {
-                uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-                voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-            }
+            voice.lfsr = lfsrAdvance(voice.lfsr, 4, LfsrTaps::Bit1);
             clap += ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.4f;
         }
         // Third burst
         if (noteTime > 0.015f && noteTime < 0.035f) {
-            for (int i = 0; i < 3; ++i) {
-                uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-                voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-            }
+            voice.lfsr = lfsrAdvance(voice.lfsr, 3, LfsrTaps::Bit1);
             clap += ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.3f;
         }
 
         // Tonal body in the 1-3kHz range
         float bodyFreq = 1800.0f;  // Center of 1-3kHz
         voice.phaseIncrement = bodyFreq / m_sampleRate;
-        float body = std::sin(voice.phase * TWO_PI) * 0.3f;
+        float body = fastSinTurns(voice.phase) * 0.3f;
         // Add slightly off harmonics for snare character
-        float body2 = std::sin(voice.phase * TWO_PI * 1.4f) * 0.15f;
-        float body3 = std::sin(voice.phase * TWO_PI * 2.3f) * 0.1f;
+        float body2 = fastSin(voice.phase * TWO_PI * 1.4f) * 0.15f;
+        float body3 = fastSin(voice.phase * TWO_PI * 2.3f) * 0.1f;
 
         // Continuous filtered noise layer
-        for (int i = 0; i < 5; ++i) {
-            uint16_t feedback = ((voice.lfsr >> 0) ^ (voice.lfsr >> 1)) & 1;
-            voice.lfsr = (voice.lfsr >> 1) | (feedback << 14);
-        }
+        voice.lfsr = lfsrAdvance(voice.lfsr, 5, LfsrTaps::Bit1);
         float noise = ((voice.lfsr & 1) ? 1.0f : -1.0f) * 0.35f;
 
         float sample = clap + body + body2 + body3 + noise;
 
         // Compression simulation (make it punchy)
-        sample = std::tanh(sample * 2.0f);
+        sample = fastTanh(sample * 2.0f);
 
         return sample * envelope * 0.75f;
     }
@@ -2366,14 +2945,26 @@ private:
     // ========================================================================
     // Envelope Processing
     // ========================================================================
-    float processEnvelope(Voice& voice) {
-        float deltaTime = 1.0f / m_sampleRate;
+    // Reciprocals of the stage lengths (0 for instant stages), taken when
+    // the envelope is set so stepping it multiplies instead of divides
+    struct EnvelopeRates {
+        float attack;
+        float decay;
+        float release;
+
+        explicit EnvelopeRates(const Envelope& env)
+            : attack(rate(env.attack)), decay(rate(env.decay)), release(rate(env.release)) {}
+
+        static float rate(float seconds) { return seconds > 0.0f ? 1.0f / seconds : 0.0f; }
+    };
+
+    float processEnvelope(Voice& voice, float deltaTime) {
         voice.envTime += deltaTime;
 
         switch (voice.envStage) {
             case Voice::EnvStage::Attack:
                 if (m_envelope.attack > 0.0f) {
-                    voice.envLevel = voice.envTime / m_envelope.attack;
+                    voice.envLevel = voice.envTime * m_envelopeRates.attack;
                     if (voice.envLevel >= 1.0f) {
                         voice.envLevel = 1.0f;
                         voice.envStage = Voice::EnvStage::Decay;
@@ -2388,7 +2979,7 @@ private:
 
             case Voice::EnvStage::Decay:
                 if (m_envelope.decay > 0.0f) {
-                    float t = voice.envTime / m_envelope.decay;
+                    float t = voice.envTime * m_envelopeRates.decay;
                     voice.envLevel = 1.0f - t * (1.0f - m_envelope.sustain);
                     if (t >= 1.0f) {
                         voice.envLevel = m_envelope.sustain;
@@ -2406,7 +2997,7 @@ private:
 
             case Voice::EnvStage::Release:
                 if (m_envelope.release > 0.0f) {
-                    float t = voice.envTime / m_envelope.release;
+                    float t = voice.envTime * m_envelopeRates.release;
                     voice.envLevel = m_envelope.sustain * (1.0f - t);
                     if (t >= 1.0f) {
                         voice.envLevel = 0.0f;
@@ -2431,17 +3022,81 @@ private:
 
 private:
     float m_sampleRate = 44100.0f;
-    std::array<Voice, MAX_VOICES> m_voices;
+
+    // Voices come from the pool; m_channel selects this synth's list in it
+    std::unique_ptr<VoicePool> m_ownPool;
+    VoicePool* m_pool = nullptr;
+    int m_channel = 0;
+
+    // Per-lane mix of the batched voices, SIMD_LANES floats per frame
+    std::vector<float> m_batchMix;
+    std::vector<float> m_noiseBlock;    // Noise batch lanes, same layout
 
     OscillatorConfig m_oscConfig;
     Envelope m_envelope;
+    EnvelopeRates m_envelopeRates{m_envelope};
+    NoteTable m_notes;                  // Tuned note frequencies
+    const DrumCache* m_drumCache = nullptr;
+
+    // Band-limited tables for Custom and the baked presets. The channel's
+    // own table is owned by the current project snapshot.
+    const WavetableBank* m_wavetables = &builtinWavetables();
+    const Wavetable* m_channelWavetable = nullptr;
 
     EffectsChain m_effects;
+    SilenceDetector m_silence;
+    uint32_t m_sleepFrames = 0;
+    bool m_asleep = true;               // Nothing has played yet
     Vibrato m_vibrato;
     Arpeggiator m_arpeggiator;
 
     bool m_vibratoEnabled = false;
     bool m_arpeggiatorEnabled = false;
+
+    // Noise source for generators (per synth, so rendering is thread-safe)
+    uint32_t m_randomState = 0x2545F491u;
+
+    uint32_t nextRandom() {
+        // xorshift32
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 17;
+        m_randomState ^= m_randomState << 5;
+        return m_randomState;
+    }
+
+    // Uniform in [-1, 1]
+    float randomBipolar() {
+        return static_cast<float>(nextRandom() >> 8) * (2.0f / 16777215.0f) - 1.0f;
+    }
 };
 
+// ============================================================================
+// Drum One-Shot Cache (needs the Synthesizer's generators)
+// ============================================================================
+inline const DrumCache& DrumCache::forSampleRate(float sampleRate) {
+    static std::mutex mutex;
+    static std::vector<std::unique_ptr<DrumCache>> caches;
+
+    std::lock_guard lock(mutex);
+    for (const auto& cache : caches) {
+        if (cache->sampleRate() == sampleRate) return *cache;
+    }
+    caches.push_back(std::make_unique<DrumCache>(sampleRate));
+    return *caches.back();
+}
+
+inline void DrumCache::fill(std::stop_token stop) {
+    Synthesizer renderer;
+    renderer.setSampleRate(m_sampleRate);
+    for (int type = 0; type < OSCILLATOR_TYPE_COUNT && !stop.stop_requested(); ++type) {
+        const OscillatorType osc = static_cast<OscillatorType>(type);
+        if (!isDrumType(osc)) continue;
+
+        m_shots[type].samples = renderer.renderDrumOneShot(osc);
+        m_shots[type].ready.store(true, std::memory_order_release);
+    }
+    m_done.store(true, std::memory_order_release);
+    m_done.notify_all();
+}
+
 } // namespace ChiptuneTracker
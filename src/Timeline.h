@@ -0,0 +1,175 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Timeline Module
+ *
+ * Compiles the arrangement and the previewed pattern into a flat,
+ * time-sorted list of note events that playback walks with a cursor.
+ * Event times are integer sample frames on the transport clock.
+ */
+
+#include "Types.h"
+#include <vector>
+#include <algorithm>
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// Swing - shifts off-beat positions forward in time (e.g., 8th note upbeats)
+// ============================================================================
+inline float applySwing(float beat, float swing, float grid) {
+    if (swing <= 0.0f) return beat;
+
+    // Find position within the grid pair
+    float gridPos = std::fmod(beat, grid * 2.0f);
+
+    // Check if this is an off-beat (second half of the pair)
+    if (gridPos >= grid - 0.001f && gridPos < grid * 2.0f - 0.001f) {
+        // This is an off-beat - shift it forward
+        // Maximum swing (1.0) creates triplet feel (shift by grid/3)
+        float swingOffset = grid * swing * 0.333f;
+        float basePos = std::floor(beat / grid) * grid;
+        float offBeatStart = basePos + grid;
+        return offBeatStart + swingOffset;
+    }
+
+    return beat;
+}
+
+// ============================================================================
+// Timeline Event
+// ============================================================================
+struct TimelineEvent {
+    int64_t  frame     = 0;     // Absolute transport frame (swing applied)
+    uint32_t noteIndex = 0;     // Index into Timeline::note()
+    uint8_t  channel   = 0;     // Target synth channel
+    bool     noteOn    = true;  // Note on or note off
+    bool     preview   = false; // From the preview pattern (gets humanized)
+};
+
+// ============================================================================
+// Timeline - Sorted event list compiled from the project
+// ============================================================================
+class Timeline {
+public:
+    static constexpr int MAX_CHANNELS = 8;
+
+    // True when the project's patterns, arrangement or swing settings (or
+    // the preview selection or tempo) differ from what the timeline was built from
+    bool needsRebuild(const Project& project, int previewPattern, int previewChannel,
+                      const Tempo& tempo) const {
+        if (!m_built) return true;
+        if (tempo != m_tempo) return true;
+        if (previewPattern != m_previewPattern || previewChannel != m_previewChannel) return true;
+        if (project.swing != m_swing || project.swingGrid != m_swingGrid) return true;
+        if (project.arrangement != m_arrangement) return true;
+        if (project.patterns.size() != m_patternVersions.size()) return true;
+        for (size_t i = 0; i < project.patterns.size(); ++i) {
+            if (project.patterns[i].version != m_patternVersions[i]) return true;
+        }
+        return false;
+    }
+
+    void build(const Project& project, int previewPattern, int previewChannel, const Tempo& tempo) {
+        m_events.clear();
+        m_notes.clear();
+
+        const int patternCount = static_cast<int>(project.patterns.size());
+
+        // Arrangement clips: notes that start inside the clip
+        for (const auto& clip : project.arrangement) {
+            if (clip.patternIndex < 0 || clip.patternIndex >= patternCount) continue;
+            if (clip.channelIndex < 0 || clip.channelIndex >= MAX_CHANNELS) continue;
+
+            float clipEnd = clip.startBeat + clip.lengthBeats;
+            for (const auto& note : project.patterns[clip.patternIndex].notes) {
+                float noteAbsStart = clip.startBeat + note.startTime;
+                if (noteAbsStart > clipEnd) continue;
+
+                addNote(note, tempo.beatToFrame(noteAbsStart),
+                        tempo.beatToFrame(noteAbsStart + note.duration), clip.channelIndex, false);
+            }
+        }
+
+        // Pattern preview (current selected pattern, not on timeline)
+        m_hasPreview = previewPattern >= 0 && previewPattern < patternCount;
+        m_previewEnd = m_hasPreview ? tempo.beatToFrame(project.patterns[previewPattern].metadata().endTime) : 0;
+        if (m_hasPreview && previewChannel >= 0 && previewChannel < MAX_CHANNELS) {
+            for (const auto& note : project.patterns[previewPattern].notes) {
+                float swungStart = applySwing(note.startTime, project.swing, project.swingGrid);
+                addNote(note, tempo.beatToFrame(swungStart),
+                        tempo.beatToFrame(swungStart + note.duration), previewChannel, true);
+            }
+        }
+
+        // Time order; events at the same time keep the order they were
+        // added in (clip order, then note order, note-on before note-off)
+        std::stable_sort(m_events.begin(), m_events.end(),
+            [](const TimelineEvent& a, const TimelineEvent& b) {
+                return a.frame < b.frame;
+            });
+
+        m_tempo = tempo;
+        m_previewPattern = previewPattern;
+        m_previewChannel = previewChannel;
+        m_swing = project.swing;
+        m_swingGrid = project.swingGrid;
+        m_arrangement = project.arrangement;
+        m_patternVersions.resize(project.patterns.size());
+        for (size_t i = 0; i < project.patterns.size(); ++i) {
+            m_patternVersions[i] = project.patterns[i].version;
+        }
+        m_built = true;
+    }
+
+    // Index of the first event at or after the given frame
+    size_t seek(int64_t frame) const {
+        auto it = std::lower_bound(m_events.begin(), m_events.end(), frame,
+            [](const TimelineEvent& e, int64_t f) { return e.frame < f; });
+        return static_cast<size_t>(it - m_events.begin());
+    }
+
+    // Frame where the last note in the preview pattern ends (unswung, 0 if empty)
+    bool hasPreview() const { return m_hasPreview; }
+    int64_t previewEnd() const { return m_previewEnd; }
+
+    size_t size() const { return m_events.size(); }
+    const TimelineEvent& operator[](size_t index) const { return m_events[index]; }
+    const Note& note(const TimelineEvent& event) const { return m_notes[event.noteIndex]; }
+
+private:
+    void addNote(const Note& note, int64_t onFrame, int64_t offFrame, int channel, bool preview) {
+        uint32_t index = static_cast<uint32_t>(m_notes.size());
+        m_notes.push_back(note);
+
+        TimelineEvent on;
+        on.frame = onFrame;
+        on.noteIndex = index;
+        on.channel = static_cast<uint8_t>(channel);
+        on.noteOn = true;
+        on.preview = preview;
+        m_events.push_back(on);
+
+        TimelineEvent off = on;
+        off.frame = offFrame;
+        off.noteOn = false;
+        m_events.push_back(off);
+    }
+
+    std::vector<TimelineEvent> m_events;
+    std::vector<Note> m_notes;
+    bool m_hasPreview = false;
+    int64_t m_previewEnd = 0;
+
+    // What the events were compiled from
+    bool m_built = false;
+    Tempo m_tempo;
+    int m_previewPattern = -1;
+    int m_previewChannel = 0;
+    float m_swing = 0.0f;
+    float m_swingGrid = 0.5f;
+    std::vector<Clip> m_arrangement;
+    std::vector<uint64_t> m_patternVersions;
+};
+
+} // namespace ChiptuneTracker
@@ -0,0 +1,110 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Pitch Tables
+ *
+ * Note frequencies and pitch ratios read from tables built at compile
+ * time, so notes and pitch modulation cost a table fetch and a multiply
+ * instead of a pow() call:
+ *
+ *   NOTE_FREQUENCIES  every MIDI note at A4 = 440 Hz
+ *   pitchRatio()      2^(semitones / 12) for any offset within +-128
+ *                     semitones: a whole-semitone table times a fine
+ *                     table of 1/128 semitone steps, interpolated
+ *                     linearly (relative error < 2.5e-7)
+ *   NoteTable         one channel's notes with its A4 reference and
+ *                     detune folded in when it is configured
+ */
+
+#include "FastMath.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace ChiptuneTracker {
+
+constexpr int MIDI_NOTES = 128;
+constexpr int PITCH_RANGE = 128;            // Semitones either side of 0
+constexpr int PITCH_FINE_STEPS = 128;       // Fine table steps per semitone
+constexpr float TUNING_A4_DEFAULT = 440.0f;
+
+// ============================================================================
+// Compile-Time Tables
+// ============================================================================
+inline constexpr std::array<float, 2 * PITCH_RANGE + 1> SEMITONE_RATIOS = [] {
+    std::array<float, 2 * PITCH_RANGE + 1> table{};
+    for (int i = 0; i <= 2 * PITCH_RANGE; ++i) {
+        table[i] = static_cast<float>(constexprExp2((i - PITCH_RANGE) / 12.0));
+    }
+    return table;
+}();
+
+// One semitone in fine steps plus a guard entry (= 2^(1/12))
+inline constexpr std::array<float, PITCH_FINE_STEPS + 1> FINE_PITCH_RATIOS = [] {
+    std::array<float, PITCH_FINE_STEPS + 1> table{};
+    for (int i = 0; i <= PITCH_FINE_STEPS; ++i) {
+        table[i] = static_cast<float>(constexprExp2(i / (12.0 * PITCH_FINE_STEPS)));
+    }
+    return table;
+}();
+
+inline constexpr std::array<float, MIDI_NOTES> NOTE_FREQUENCIES = [] {
+    std::array<float, MIDI_NOTES> table{};
+    for (int note = 0; note < MIDI_NOTES; ++note) {
+        table[note] = static_cast<float>(TUNING_A4_DEFAULT * constexprExp2((note - 69) / 12.0));
+    }
+    return table;
+}();
+
+// ============================================================================
+// Pitch Ratios
+// ============================================================================
+// 2^(semitones / 12); offsets beyond +-PITCH_RANGE are clamped
+inline float pitchRatio(float semitones) {
+    const float x = std::clamp(semitones, static_cast<float>(-PITCH_RANGE), static_cast<float>(PITCH_RANGE));
+    const float whole = std::floor(x);
+    const float fine = (x - whole) * PITCH_FINE_STEPS;      // Exact
+    const int step = std::min(static_cast<int>(fine), PITCH_FINE_STEPS - 1);
+    const float frac = fine - static_cast<float>(step);
+
+    const float fineRatio = FINE_PITCH_RATIOS[step] +
+                            (FINE_PITCH_RATIOS[step + 1] - FINE_PITCH_RATIOS[step]) * frac;
+    return SEMITONE_RATIOS[static_cast<int>(whole) + PITCH_RANGE] * fineRatio;
+}
+
+// 2^(cents / 1200)
+inline float centsRatio(float cents) {
+    return pitchRatio(cents * 0.01f);
+}
+
+// ============================================================================
+// Note Table - one channel's tuning
+// ============================================================================
+// configure() scales the note table by the A4 reference and detune once;
+// frequency() is then a plain fetch for every note on.
+class NoteTable {
+public:
+    void configure(float a4, float detuneCents) {
+        if (a4 == m_a4 && detuneCents == m_detuneCents) return;
+        m_a4 = a4;
+        m_detuneCents = detuneCents;
+        m_scale = (a4 / TUNING_A4_DEFAULT) * centsRatio(detuneCents);
+        for (int note = 0; note < MIDI_NOTES; ++note) {
+            m_frequencies[note] = NOTE_FREQUENCIES[note] * m_scale;
+        }
+    }
+
+    float frequency(int note) const {
+        if (note >= 0 && note < MIDI_NOTES) return m_frequencies[note];
+        return TUNING_A4_DEFAULT * m_scale * pitchRatio(static_cast<float>(note - 69));
+    }
+
+private:
+    std::array<float, MIDI_NOTES> m_frequencies = NOTE_FREQUENCIES;
+    float m_a4 = TUNING_A4_DEFAULT;
+    float m_detuneCents = 0.0f;
+    float m_scale = 1.0f;
+};
+
+} // namespace ChiptuneTracker
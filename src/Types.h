@@ -8,10 +8,17 @@
 
 #include <cstdint>
 #include <cmath>
+#include <atomic>
 #include <array>
+#include <span>
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <memory>
+#include "Tuning.h"
+#include "Wavetable.h"
+#include "Oversampler.h"
+#include "Effects.h"
 
 namespace ChiptuneTracker {
 
@@ -23,9 +30,10 @@ constexpr int MAX_OCTAVES = 8;
 constexpr int TOTAL_NOTES = NOTES_PER_OCTAVE * MAX_OCTAVES;
 constexpr float BASE_A4_FREQ = 440.0f;
 
-// MIDI note to frequency conversion
+// MIDI note to frequency conversion (A4 = 440 Hz)
 inline float noteToFrequency(int midiNote) {
-    return BASE_A4_FREQ * std::pow(2.0f, (midiNote - 69) / 12.0f);
+    if (midiNote >= 0 && midiNote < MIDI_NOTES) return NOTE_FREQUENCIES[midiNote];
+    return BASE_A4_FREQ * pitchRatio(static_cast<float>(midiNote - 69));
 }
 
 // ============================================================================
@@ -109,6 +117,8 @@ enum class OscillatorType : uint8_t {
     DembowSnare     // Tight clap-like snare for dembow (1-3kHz emphasis)
 };
 
+constexpr int OSCILLATOR_TYPE_COUNT = static_cast<int>(OscillatorType::DembowSnare) + 1;
+
 // ============================================================================
 // Oscillator Configuration
 // ============================================================================
@@ -124,8 +134,13 @@ struct OscillatorConfig {
     // Noise settings
     bool noiseShortMode = false;    // NES short mode (more metallic)
 
+    // Wavetable settings (Custom)
+    uint8_t wavetable = 0;          // Built-in table, or WAVETABLE_CHANNEL for the channel's own
+    float wavetableMorph = 0.0f;    // 0.0 to 1.0 across the table's frames
+
     // General
     float detune = 0.0f;            // Cents (-100 to +100)
+    float tuning = TUNING_A4_DEFAULT;   // A4 reference (Hz)
     float phase = 0.0f;             // Starting phase (0.0 to 1.0)
 };
 
@@ -218,6 +233,72 @@ struct Note {
     float    tremoloSpeed = 4.0f;   // Tremolo speed (Hz)
 
     bool isValid() const { return pitch >= 0 && pitch < 128; }
+    bool operator==(const Note&) const = default;
+};
+
+// ============================================================================
+// Pattern Metadata (derived from a pattern's notes, see Pattern::metadata())
+// ============================================================================
+struct PatternMetadata {
+    uint64_t version = 0;           // Pattern version this was built from
+    float endTime = 0.0f;           // Latest note end in beats (0 = no notes)
+    int lowestPitch = 0;            // Pitch range (highest < lowest = no notes)
+    int highestPitch = -1;
+    std::array<int, OSCILLATOR_TYPE_COUNT> oscillatorCounts = {};
+
+    // Note indices bucketed by the whole beat (step) they start on,
+    // in note order within each step
+    std::vector<int> stepOffsets;   // stepCount() + 1 entries into stepNotes
+    std::vector<int> stepNotes;
+
+    int stepCount() const { return static_cast<int>(stepOffsets.size()) - 1; }
+
+    std::span<const int> notesAtStep(int step) const {
+        if (step < 0 || step >= stepCount()) return {};
+        return std::span<const int>(stepNotes).subspan(
+            stepOffsets[step], stepOffsets[step + 1] - stepOffsets[step]);
+    }
+
+    void build(const std::vector<Note>& notes, int length, uint64_t patternVersion) {
+        version = patternVersion;
+        endTime = 0.0f;
+        lowestPitch = 0;
+        highestPitch = -1;
+        oscillatorCounts.fill(0);
+
+        int steps = std::max(length, 0);
+        for (const Note& note : notes) {
+            endTime = std::max(endTime, note.startTime + note.duration);
+            if (highestPitch < lowestPitch) {
+                lowestPitch = highestPitch = note.pitch;
+            } else {
+                lowestPitch = std::min(lowestPitch, note.pitch);
+                highestPitch = std::max(highestPitch, note.pitch);
+            }
+            int type = static_cast<int>(note.oscillatorType);
+            if (type >= 0 && type < OSCILLATOR_TYPE_COUNT) oscillatorCounts[type]++;
+            steps = std::max(steps, noteStep(note) + 1);
+        }
+
+        // Counting sort into step buckets
+        stepOffsets.assign(steps + 1, 0);
+        for (const Note& note : notes) {
+            stepOffsets[noteStep(note) + 1]++;
+        }
+        for (int s = 0; s < steps; ++s) {
+            stepOffsets[s + 1] += stepOffsets[s];
+        }
+        stepNotes.resize(notes.size());
+        std::vector<int> fill(stepOffsets.begin(), stepOffsets.end() - 1);
+        for (size_t i = 0; i < notes.size(); ++i) {
+            stepNotes[fill[noteStep(notes[i])]++] = static_cast<int>(i);
+        }
+    }
+
+private:
+    static int noteStep(const Note& note) {
+        return std::max(0, static_cast<int>(note.startTime));
+    }
 };
 
 // ============================================================================
@@ -230,8 +311,32 @@ struct Pattern {
     std::string name = "Pattern";
     int length = DEFAULT_LENGTH;               // Pattern length in beats
     std::vector<Note> notes;
+    uint64_t version = nextVersion();          // Changes on every edit (see touch())
 
     Pattern() { notes.reserve(MAX_NOTES); }
+
+    // Mark the pattern as edited. Anything compiled from it (playback
+    // timeline, cached metadata) compares versions to know when to rebuild.
+    // Versions are unique across all patterns, so a reordered or replaced
+    // pattern list is detected as well.
+    void touch() { version = nextVersion(); }
+
+    static uint64_t nextVersion() {
+        static std::atomic<uint64_t> counter{0};
+        return ++counter;
+    }
+
+    // End time, pitch range, per-oscillator counts and step buckets,
+    // rebuilt on first access after an edit
+    const PatternMetadata& metadata() const {
+        if (m_metadata.version != version) {
+            m_metadata.build(notes, length, version);
+        }
+        return m_metadata;
+    }
+
+private:
+    mutable PatternMetadata m_metadata;
 };
 
 // ============================================================================
@@ -250,26 +355,15 @@ struct ChannelConfig {
     // Effect enables
     bool arpeggiatorEnabled = false;
     bool vibratoEnabled = false;
-    bool bitcrusherEnabled = false;
-    bool distortionEnabled = false;
-    bool delayEnabled = false;
-    bool filterEnabled = false;
-
-    // Reverb settings (genre effects)
-    bool reverbEnabled = false;
-    float reverbMix = 0.35f;
-    float reverbRoomSize = 0.7f;
-    float reverbDamping = 0.4f;
 
-    // Chorus settings (genre effects)
-    bool chorusEnabled = false;
-    float chorusMix = 0.3f;
-    float chorusRate = 0.5f;
+    // The channel's effects chain (sent to the audio thread with the rest
+    // of the config; see Sequencer::updateChannelConfigs)
+    ChannelEffects effects{};
 
-    // Extended delay settings (genre effects)
-    float delayMix = 0.2f;
-    float delayTime = 0.25f;
-    float delayFeedback = 0.3f;
+    // Aux sends into the project's shared reverb and delay (post-fader,
+    // 0.0 = none)
+    float reverbSend = 0.0f;
+    float delaySend = 0.0f;
 
     // Channel-level Echo (applies to all notes on this channel)
     bool echoEnabled = false;
@@ -279,6 +373,28 @@ struct ChannelConfig {
 
     // Channel Detune (for stereo widening/richness)
     float detuneCents = 0.0f;       // Fine detune (-100 to +100 cents)
+
+    // Waveform loaded for the Custom oscillator (OscillatorConfig::wavetable
+    // = WAVETABLE_CHANNEL plays it)
+    std::shared_ptr<const Wavetable> wavetable = nullptr;
+    std::string wavetableFile = "";
+};
+
+// ============================================================================
+// Aux Buses - shared reverb and delay fed by the channels' sends
+// ============================================================================
+struct AuxBusConfig {
+    // Reverb
+    float reverbRoomSize = 0.7f;
+    float reverbDamping = 0.4f;
+    float reverbReturn = 1.0f;      // Return level into the master
+
+    // Delay
+    float delayTime = 0.25f;        // Seconds
+    float delayFeedback = 0.3f;
+    float delayReturn = 1.0f;
+
+    bool operator==(const AuxBusConfig&) const = default;
 };
 
 // ============================================================================
@@ -292,6 +408,8 @@ struct Clip {
 
     // Visual
     uint32_t color = 0xFF4488FF;
+
+    bool operator==(const Clip&) const = default;
 };
 
 // ============================================================================
@@ -305,6 +423,7 @@ struct Project {
     float bpm = 120.0f;
     int beatsPerMeasure = 4;
     float masterVolume = 0.7f;      // Master volume (0.0 to 1.0)
+    Oversampling masterOversampling = Oversampling::Off;   // For the master soft clip
 
     // Swing/groove settings
     float swing = 0.0f;             // Swing amount: 0.0 = no swing, 1.0 = max swing (triplet feel)
@@ -314,6 +433,7 @@ struct Project {
     float humanizeVelocity = 0.1f;  // Humanize velocity variation (0.0 to 1.0)
 
     std::array<ChannelConfig, MAX_CHANNELS> channels;
+    AuxBusConfig aux;
     std::vector<Pattern> patterns;
     std::vector<Clip> arrangement;
 
@@ -356,10 +476,44 @@ struct PlaybackState {
     bool loop = true;
     float loopStart = 0.0f;
     float loopEnd = 16.0f;
+
+    // Transport clock (sample frames). position wraps with the loop;
+    // elapsed keeps counting while playing and drives synth/effect time.
+    int64_t position = 0;
+    int64_t elapsed = 0;
+
+    // Derived from the clock after each audio block (for display)
     float currentBeat = 0.0f;
     float currentTime = 0.0f;   // In seconds
 };
 
+// ============================================================================
+// Tempo - beat <-> sample frame conversion for the transport clock
+// ============================================================================
+// Frames per beat is the ratio 60 * sampleRate / bpm, kept as an integer
+// numerator and denominator (bpm in thousandths). Every conversion starts
+// from the integer clock and rounds once, so positions never accumulate
+// error however long playback runs.
+struct Tempo {
+    int64_t framesNum = 60LL * 44100 * 1000;  // 60 * sampleRate * 1000
+    int64_t framesDen = 120 * 1000;           // bpm * 1000
+
+    Tempo() = default;
+    Tempo(float bpm, float sampleRate)
+        : framesNum(std::llround(60000.0 * sampleRate)),
+          framesDen(std::max<int64_t>(1, std::llround(bpm * 1000.0))) {}
+
+    int64_t beatToFrame(double beat) const {
+        return std::llround(beat * static_cast<double>(framesNum) / static_cast<double>(framesDen));
+    }
+
+    double frameToBeat(int64_t frame) const {
+        return static_cast<double>(frame) * static_cast<double>(framesDen) / static_cast<double>(framesNum);
+    }
+
+    bool operator==(const Tempo&) const = default;
+};
+
 // ============================================================================
 // UI State
 // ============================================================================
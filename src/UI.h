@@ -15,6 +15,8 @@
 #include "Types.h"
 #include "Sequencer.h"
 #include "FileIO.h"
+#include "FileDialogs.h"
+#include "SampleTracks.h"
 #include <algorithm>
 #include <cstdio>
 #include <limits>
@@ -56,6 +58,9 @@ static int g_DraggedOscillatorType = -1;
 static int g_SelectedPaletteItem = -1;  // -1 = none selected
 static float g_SelectedDurationMult = 1.0f;  // Duration multiplier for drums (0.5 = short, 1.0 = normal, 2.0 = long)
 
+// Audio thread timings, drained every frame by the Mixer
+static AudioProfileStats g_AudioProfile;
+
 // Palette category expansion state
 static bool g_PaletteExpanded_Oscillators = false;
 static bool g_PaletteExpanded_Synths = false;
@@ -333,1453 +338,6 @@ static bool g_PaletteExpanded_Chords_Reggaeton = false;
 static bool g_PaletteExpanded_Chords_Synthwave = false;
 static bool g_PaletteExpanded_Chords_Chiptune = false;
 
-// ============================================================================
-// Sample Tracks - Complete songs with melody, bass, and drums
-// ============================================================================
-struct TrackNote {
-    float beat;         // Start beat (0-based)
-    int pitch;          // MIDI note
-    OscillatorType osc; // Instrument type
-    float duration;     // Note duration in beats
-    float velocity = 0.8f;    // Note velocity (0.0-1.0) for dynamics
-    float vibrato = 0.0f;     // Vibrato depth in semitones (0 = none)
-    float vibratoSpeed = 5.5f; // Vibrato speed in Hz
-};
-
-// Genre-specific effect presets for professional sound
-struct GenreEffects {
-    bool reverbEnabled = false;
-    float reverbMix = 0.3f;
-    float reverbRoomSize = 0.7f;
-    float reverbDamping = 0.4f;
-    bool chorusEnabled = false;
-    float chorusMix = 0.3f;
-    float chorusRate = 0.5f;
-    bool delayEnabled = false;
-    float delayMix = 0.2f;
-    float delayTime = 0.25f;
-    float delayFeedback = 0.3f;
-    bool sidechainEnabled = false;
-};
-
-// Get effect preset for a genre
-inline GenreEffects getGenreEffects(const char* genre) {
-    GenreEffects fx;
-
-    if (strcmp(genre, "Synthwave") == 0) {
-        // Heavy reverb, chorus for lush 80s sound, sidechain pumping
-        fx.reverbEnabled = true;
-        fx.reverbMix = 0.4f;
-        fx.reverbRoomSize = 0.8f;
-        fx.reverbDamping = 0.3f;
-        fx.chorusEnabled = true;
-        fx.chorusMix = 0.35f;
-        fx.chorusRate = 0.4f;
-        fx.delayEnabled = true;
-        fx.delayMix = 0.25f;
-        fx.delayTime = 0.375f;  // Dotted 8th for 80s feel
-        fx.delayFeedback = 0.35f;
-        fx.sidechainEnabled = true;
-    }
-    else if (strcmp(genre, "Chiptune") == 0) {
-        // Minimal effects - authentic 8-bit sound
-        fx.reverbEnabled = false;
-        fx.chorusEnabled = false;
-        fx.delayEnabled = true;
-        fx.delayMix = 0.15f;
-        fx.delayTime = 0.125f;
-        fx.delayFeedback = 0.2f;
-    }
-    else if (strcmp(genre, "Techno") == 0) {
-        // Room reverb, heavy sidechain
-        fx.reverbEnabled = true;
-        fx.reverbMix = 0.25f;
-        fx.reverbRoomSize = 0.5f;
-        fx.reverbDamping = 0.6f;
-        fx.chorusEnabled = false;
-        fx.delayEnabled = true;
-        fx.delayMix = 0.2f;
-        fx.delayTime = 0.25f;
-        fx.delayFeedback = 0.4f;
-        fx.sidechainEnabled = true;
-    }
-    else if (strcmp(genre, "Hip Hop") == 0 || strcmp(genre, "Trap") == 0) {
-        // Lo-fi vibes, subtle reverb
-        fx.reverbEnabled = true;
-        fx.reverbMix = 0.2f;
-        fx.reverbRoomSize = 0.4f;
-        fx.reverbDamping = 0.7f;
-        fx.chorusEnabled = false;
-        fx.delayEnabled = true;
-        fx.delayMix = 0.15f;
-        fx.delayTime = 0.375f;
-        fx.delayFeedback = 0.25f;
-    }
-    else if (strcmp(genre, "House") == 0) {
-        // Big room reverb, sidechain
-        fx.reverbEnabled = true;
-        fx.reverbMix = 0.35f;
-        fx.reverbRoomSize = 0.7f;
-        fx.reverbDamping = 0.4f;
-        fx.chorusEnabled = true;
-        fx.chorusMix = 0.2f;
-        fx.delayEnabled = true;
-        fx.delayMix = 0.2f;
-        fx.delayTime = 0.25f;
-        fx.delayFeedback = 0.3f;
-        fx.sidechainEnabled = true;
-    }
-    else if (strcmp(genre, "Reggaeton") == 0) {
-        // Tight room, punchy
-        fx.reverbEnabled = true;
-        fx.reverbMix = 0.2f;
-        fx.reverbRoomSize = 0.3f;
-        fx.reverbDamping = 0.5f;
-        fx.chorusEnabled = false;
-        fx.delayEnabled = true;
-        fx.delayMix = 0.15f;
-        fx.delayTime = 0.1875f;
-        fx.delayFeedback = 0.2f;
-    }
-
-    return fx;
-}
-
-struct SampleTrack {
-    const char* name;
-    const char* genre;
-    const char* description;
-    const TrackNote* notes;
-    int noteCount;
-    int lengthBeats;    // Total track length
-    int bpm;            // Suggested BPM
-    bool fixedPosition; // If true, notes are placed at their exact beat positions (starting from beat 0)
-};
-
-// ===========================================
-// SYNTHWAVE TRACKS
-// ===========================================
-
-// Synthwave Track 1: "Midnight Drive" - Am-F-C-G progression (16 bars)
-// Full {beat, pitch, osc, duration, velocity, vibrato, vibratoSpeed}
-static const TrackNote g_SynthwaveMidnightDrive[] = {
-    // === DRUMS (punchy, high velocity) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {1.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    {2.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {3.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    {4.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {5.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    {6.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {7.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    {8.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {9.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    {10.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {11.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    {12.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {13.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    {14.0f, 36, OscillatorType::Kick808, 0.25f, 0.95f, 0.0f, 5.5f},
-    {15.0f, 38, OscillatorType::Snare808, 0.25f, 0.9f, 0.0f, 5.5f},
-    // Hihats (softer velocity for groove)
-    {0.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {1.5f, 42, OscillatorType::HiHat, 0.125f, 0.55f, 0.0f, 5.5f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {3.5f, 42, OscillatorType::HiHatOpen, 0.25f, 0.7f, 0.0f, 5.5f},
-    {4.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {5.5f, 42, OscillatorType::HiHat, 0.125f, 0.55f, 0.0f, 5.5f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {7.5f, 42, OscillatorType::HiHatOpen, 0.25f, 0.7f, 0.0f, 5.5f},
-    {8.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {9.5f, 42, OscillatorType::HiHat, 0.125f, 0.55f, 0.0f, 5.5f},
-    {10.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {11.5f, 42, OscillatorType::HiHatOpen, 0.25f, 0.7f, 0.0f, 5.5f},
-    {12.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {13.5f, 42, OscillatorType::HiHat, 0.125f, 0.55f, 0.0f, 5.5f},
-    {14.5f, 42, OscillatorType::HiHat, 0.125f, 0.6f, 0.0f, 5.5f},
-    {15.5f, 42, OscillatorType::HiHatOpen, 0.25f, 0.7f, 0.0f, 5.5f},
-    // === BASS (warm and full) ===
-    {0.0f, 33, OscillatorType::SynthwaveBass, 3.5f, 0.85f, 0.0f, 5.5f},   // A1
-    {4.0f, 29, OscillatorType::SynthwaveBass, 3.5f, 0.85f, 0.0f, 5.5f},   // F1
-    {8.0f, 36, OscillatorType::SynthwaveBass, 3.5f, 0.85f, 0.0f, 5.5f},   // C2
-    {12.0f, 31, OscillatorType::SynthwaveBass, 3.5f, 0.85f, 0.0f, 5.5f},  // G1
-    // === MELODY (expressive with vibrato on sustained notes) ===
-    {0.0f, 69, OscillatorType::SynthwaveLead, 1.0f, 0.8f, 0.15f, 5.0f},   // A4 - subtle vibrato
-    {1.0f, 72, OscillatorType::SynthwaveLead, 0.5f, 0.75f, 0.0f, 5.5f},   // C5
-    {1.5f, 74, OscillatorType::SynthwaveLead, 0.5f, 0.7f, 0.0f, 5.5f},    // D5
-    {2.0f, 76, OscillatorType::SynthwaveLead, 2.0f, 0.9f, 0.25f, 4.5f},   // E5 - stronger vibrato
-    {4.0f, 77, OscillatorType::SynthwaveLead, 1.0f, 0.85f, 0.15f, 5.0f},  // F5
-    {5.0f, 76, OscillatorType::SynthwaveLead, 0.5f, 0.75f, 0.0f, 5.5f},   // E5
-    {5.5f, 74, OscillatorType::SynthwaveLead, 0.5f, 0.7f, 0.0f, 5.5f},    // D5
-    {6.0f, 72, OscillatorType::SynthwaveLead, 2.0f, 0.9f, 0.25f, 4.5f},   // C5 - strong vibrato
-    {8.0f, 72, OscillatorType::SynthwaveLead, 1.0f, 0.8f, 0.15f, 5.0f},   // C5
-    {9.0f, 74, OscillatorType::SynthwaveLead, 0.5f, 0.75f, 0.0f, 5.5f},   // D5
-    {9.5f, 76, OscillatorType::SynthwaveLead, 0.5f, 0.7f, 0.0f, 5.5f},    // E5
-    {10.0f, 79, OscillatorType::SynthwaveLead, 2.0f, 0.95f, 0.3f, 4.5f},  // G5 - emotional peak
-    {12.0f, 79, OscillatorType::SynthwaveLead, 1.0f, 0.85f, 0.2f, 5.0f},  // G5
-    {13.0f, 77, OscillatorType::SynthwaveLead, 0.5f, 0.75f, 0.0f, 5.5f},  // F5
-    {13.5f, 76, OscillatorType::SynthwaveLead, 0.5f, 0.7f, 0.0f, 5.5f},   // E5
-    {14.0f, 69, OscillatorType::SynthwaveLead, 2.0f, 0.9f, 0.25f, 4.5f},  // A4 - resolve with vibrato
-    // === PADS (soft and lush with slow vibrato) ===
-    {0.0f, 57, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // A3 (Am chord root)
-    {0.0f, 60, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // C4
-    {0.0f, 64, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // E4
-    {4.0f, 53, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // F3
-    {4.0f, 57, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // A3
-    {4.0f, 60, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // C4
-    {8.0f, 48, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // C3
-    {8.0f, 52, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // E3
-    {8.0f, 55, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},     // G3
-    {12.0f, 55, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},    // G3
-    {12.0f, 59, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},    // B3
-    {12.0f, 62, OscillatorType::SynthwavePad, 4.0f, 0.5f, 0.1f, 3.0f},    // D4
-};
-
-// Synthwave Track 2: "Neon Dreams" - Fm-Db-Ab-Eb (slower, dreamy)
-static const TrackNote g_SynthwaveNeonDreams[] = {
-    // === DRUMS (slower, more sparse) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.5f}, {2.0f, 38, OscillatorType::Snare808, 0.25f},
-    {4.0f, 36, OscillatorType::Kick808, 0.5f}, {6.0f, 38, OscillatorType::Snare808, 0.25f},
-    {8.0f, 36, OscillatorType::Kick808, 0.5f}, {10.0f, 38, OscillatorType::Snare808, 0.25f},
-    {12.0f, 36, OscillatorType::Kick808, 0.5f}, {14.0f, 38, OscillatorType::Snare808, 0.25f},
-    // Hihats (quarter notes)
-    {1.0f, 42, OscillatorType::HiHat, 0.125f}, {3.0f, 42, OscillatorType::HiHatOpen, 0.25f},
-    {5.0f, 42, OscillatorType::HiHat, 0.125f}, {7.0f, 42, OscillatorType::HiHatOpen, 0.25f},
-    {9.0f, 42, OscillatorType::HiHat, 0.125f}, {11.0f, 42, OscillatorType::HiHatOpen, 0.25f},
-    {13.0f, 42, OscillatorType::HiHat, 0.125f}, {15.0f, 42, OscillatorType::HiHatOpen, 0.25f},
-    // === BASS ===
-    {0.0f, 29, OscillatorType::SynthwaveBass, 3.5f},   // F1
-    {4.0f, 25, OscillatorType::SynthwaveBass, 3.5f},   // Db1
-    {8.0f, 32, OscillatorType::SynthwaveBass, 3.5f},   // Ab1
-    {12.0f, 27, OscillatorType::SynthwaveBass, 3.5f},  // Eb1
-    // === ARPEGGIO (dreamy sequence) ===
-    {0.0f, 65, OscillatorType::SynthwaveArp, 0.25f},   // F4
-    {0.5f, 68, OscillatorType::SynthwaveArp, 0.25f},   // Ab4
-    {1.0f, 72, OscillatorType::SynthwaveArp, 0.25f},   // C5
-    {1.5f, 68, OscillatorType::SynthwaveArp, 0.25f},   // Ab4
-    {2.0f, 65, OscillatorType::SynthwaveArp, 0.25f},   // F4
-    {2.5f, 68, OscillatorType::SynthwaveArp, 0.25f},   // Ab4
-    {3.0f, 72, OscillatorType::SynthwaveArp, 0.25f},   // C5
-    {3.5f, 77, OscillatorType::SynthwaveArp, 0.25f},   // F5
-    {4.0f, 61, OscillatorType::SynthwaveArp, 0.25f},   // Db4
-    {4.5f, 65, OscillatorType::SynthwaveArp, 0.25f},   // F4
-    {5.0f, 68, OscillatorType::SynthwaveArp, 0.25f},   // Ab4
-    {5.5f, 65, OscillatorType::SynthwaveArp, 0.25f},   // F4
-    {6.0f, 61, OscillatorType::SynthwaveArp, 0.25f},   // Db4
-    {6.5f, 65, OscillatorType::SynthwaveArp, 0.25f},   // F4
-    {7.0f, 68, OscillatorType::SynthwaveArp, 0.25f},   // Ab4
-    {7.5f, 73, OscillatorType::SynthwaveArp, 0.25f},   // Db5
-    {8.0f, 68, OscillatorType::SynthwaveArp, 0.25f},   // Ab4
-    {8.5f, 72, OscillatorType::SynthwaveArp, 0.25f},   // C5
-    {9.0f, 75, OscillatorType::SynthwaveArp, 0.25f},   // Eb5
-    {9.5f, 72, OscillatorType::SynthwaveArp, 0.25f},   // C5
-    {10.0f, 68, OscillatorType::SynthwaveArp, 0.25f},  // Ab4
-    {10.5f, 72, OscillatorType::SynthwaveArp, 0.25f},  // C5
-    {11.0f, 75, OscillatorType::SynthwaveArp, 0.25f},  // Eb5
-    {11.5f, 80, OscillatorType::SynthwaveArp, 0.25f},  // Ab5
-    {12.0f, 63, OscillatorType::SynthwaveArp, 0.25f},  // Eb4
-    {12.5f, 67, OscillatorType::SynthwaveArp, 0.25f},  // G4
-    {13.0f, 70, OscillatorType::SynthwaveArp, 0.25f},  // Bb4
-    {13.5f, 67, OscillatorType::SynthwaveArp, 0.25f},  // G4
-    {14.0f, 63, OscillatorType::SynthwaveArp, 0.25f},  // Eb4
-    {14.5f, 67, OscillatorType::SynthwaveArp, 0.25f},  // G4
-    {15.0f, 70, OscillatorType::SynthwaveArp, 0.25f},  // Bb4
-    {15.5f, 75, OscillatorType::SynthwaveArp, 0.25f},  // Eb5
-    // === PADS ===
-    {0.0f, 53, OscillatorType::SynthwavePad, 4.0f},    // Fm
-    {0.0f, 56, OscillatorType::SynthwavePad, 4.0f},
-    {0.0f, 60, OscillatorType::SynthwavePad, 4.0f},
-    {4.0f, 49, OscillatorType::SynthwavePad, 4.0f},    // Db
-    {4.0f, 53, OscillatorType::SynthwavePad, 4.0f},
-    {4.0f, 56, OscillatorType::SynthwavePad, 4.0f},
-    {8.0f, 56, OscillatorType::SynthwavePad, 4.0f},    // Ab
-    {8.0f, 60, OscillatorType::SynthwavePad, 4.0f},
-    {8.0f, 63, OscillatorType::SynthwavePad, 4.0f},
-    {12.0f, 51, OscillatorType::SynthwavePad, 4.0f},   // Eb
-    {12.0f, 55, OscillatorType::SynthwavePad, 4.0f},
-    {12.0f, 58, OscillatorType::SynthwavePad, 4.0f},
-};
-
-// Synthwave Track 3: "Retro Racer" - Em-C-G-D (energetic)
-static const TrackNote g_SynthwaveRetroRacer[] = {
-    // === DRUMS (driving beat) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.25f}, {1.0f, 38, OscillatorType::Snare808, 0.25f},
-    {2.0f, 36, OscillatorType::Kick808, 0.25f}, {2.5f, 36, OscillatorType::Kick808, 0.125f},
-    {3.0f, 38, OscillatorType::Snare808, 0.25f},
-    {4.0f, 36, OscillatorType::Kick808, 0.25f}, {5.0f, 38, OscillatorType::Snare808, 0.25f},
-    {6.0f, 36, OscillatorType::Kick808, 0.25f}, {6.5f, 36, OscillatorType::Kick808, 0.125f},
-    {7.0f, 38, OscillatorType::Snare808, 0.25f},
-    {8.0f, 36, OscillatorType::Kick808, 0.25f}, {9.0f, 38, OscillatorType::Snare808, 0.25f},
-    {10.0f, 36, OscillatorType::Kick808, 0.25f}, {10.5f, 36, OscillatorType::Kick808, 0.125f},
-    {11.0f, 38, OscillatorType::Snare808, 0.25f},
-    {12.0f, 36, OscillatorType::Kick808, 0.25f}, {13.0f, 38, OscillatorType::Snare808, 0.25f},
-    {14.0f, 36, OscillatorType::Kick808, 0.25f}, {14.5f, 36, OscillatorType::Kick808, 0.125f},
-    {15.0f, 38, OscillatorType::Snare808, 0.25f},
-    // Hihats (16ths on last beat of each bar for energy)
-    {0.5f, 42, OscillatorType::HiHat, 0.125f}, {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f}, {3.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.5f, 42, OscillatorType::HiHat, 0.0625f}, {3.75f, 42, OscillatorType::HiHatOpen, 0.125f},
-    {4.5f, 42, OscillatorType::HiHat, 0.125f}, {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f}, {7.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {7.5f, 42, OscillatorType::HiHat, 0.0625f}, {7.75f, 42, OscillatorType::HiHatOpen, 0.125f},
-    {8.5f, 42, OscillatorType::HiHat, 0.125f}, {9.5f, 42, OscillatorType::HiHat, 0.125f},
-    {10.5f, 42, OscillatorType::HiHat, 0.125f}, {11.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {11.5f, 42, OscillatorType::HiHat, 0.0625f}, {11.75f, 42, OscillatorType::HiHatOpen, 0.125f},
-    {12.5f, 42, OscillatorType::HiHat, 0.125f}, {13.5f, 42, OscillatorType::HiHat, 0.125f},
-    {14.5f, 42, OscillatorType::HiHat, 0.125f}, {15.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {15.5f, 42, OscillatorType::HiHat, 0.0625f}, {15.75f, 42, OscillatorType::HiHatOpen, 0.125f},
-    // === BASS (driving 8th note pattern) ===
-    {0.0f, 40, OscillatorType::SynthwaveBass, 0.5f}, {0.5f, 40, OscillatorType::SynthwaveBass, 0.5f},
-    {1.0f, 40, OscillatorType::SynthwaveBass, 0.5f}, {1.5f, 40, OscillatorType::SynthwaveBass, 0.5f},
-    {2.0f, 40, OscillatorType::SynthwaveBass, 0.5f}, {2.5f, 40, OscillatorType::SynthwaveBass, 0.5f},
-    {3.0f, 40, OscillatorType::SynthwaveBass, 0.5f}, {3.5f, 40, OscillatorType::SynthwaveBass, 0.5f},
-    {4.0f, 36, OscillatorType::SynthwaveBass, 0.5f}, {4.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {5.0f, 36, OscillatorType::SynthwaveBass, 0.5f}, {5.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {6.0f, 36, OscillatorType::SynthwaveBass, 0.5f}, {6.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {7.0f, 36, OscillatorType::SynthwaveBass, 0.5f}, {7.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {8.0f, 43, OscillatorType::SynthwaveBass, 0.5f}, {8.5f, 43, OscillatorType::SynthwaveBass, 0.5f},
-    {9.0f, 43, OscillatorType::SynthwaveBass, 0.5f}, {9.5f, 43, OscillatorType::SynthwaveBass, 0.5f},
-    {10.0f, 43, OscillatorType::SynthwaveBass, 0.5f}, {10.5f, 43, OscillatorType::SynthwaveBass, 0.5f},
-    {11.0f, 43, OscillatorType::SynthwaveBass, 0.5f}, {11.5f, 43, OscillatorType::SynthwaveBass, 0.5f},
-    {12.0f, 38, OscillatorType::SynthwaveBass, 0.5f}, {12.5f, 38, OscillatorType::SynthwaveBass, 0.5f},
-    {13.0f, 38, OscillatorType::SynthwaveBass, 0.5f}, {13.5f, 38, OscillatorType::SynthwaveBass, 0.5f},
-    {14.0f, 38, OscillatorType::SynthwaveBass, 0.5f}, {14.5f, 38, OscillatorType::SynthwaveBass, 0.5f},
-    {15.0f, 38, OscillatorType::SynthwaveBass, 0.5f}, {15.5f, 38, OscillatorType::SynthwaveBass, 0.5f},
-    // === LEAD MELODY ===
-    {0.0f, 76, OscillatorType::SynthwaveLead, 0.5f},  // E5
-    {0.5f, 79, OscillatorType::SynthwaveLead, 0.5f},  // G5
-    {1.0f, 83, OscillatorType::SynthwaveLead, 1.0f},  // B5
-    {2.0f, 79, OscillatorType::SynthwaveLead, 0.5f},  // G5
-    {2.5f, 76, OscillatorType::SynthwaveLead, 0.5f},  // E5
-    {3.0f, 74, OscillatorType::SynthwaveLead, 1.0f},  // D5
-    {4.0f, 72, OscillatorType::SynthwaveLead, 0.5f},  // C5
-    {4.5f, 76, OscillatorType::SynthwaveLead, 0.5f},  // E5
-    {5.0f, 79, OscillatorType::SynthwaveLead, 1.0f},  // G5
-    {6.0f, 76, OscillatorType::SynthwaveLead, 0.5f},  // E5
-    {6.5f, 72, OscillatorType::SynthwaveLead, 0.5f},  // C5
-    {7.0f, 71, OscillatorType::SynthwaveLead, 1.0f},  // B4
-    {8.0f, 79, OscillatorType::SynthwaveLead, 0.5f},  // G5
-    {8.5f, 83, OscillatorType::SynthwaveLead, 0.5f},  // B5
-    {9.0f, 86, OscillatorType::SynthwaveLead, 1.0f},  // D6
-    {10.0f, 83, OscillatorType::SynthwaveLead, 0.5f}, // B5
-    {10.5f, 79, OscillatorType::SynthwaveLead, 0.5f}, // G5
-    {11.0f, 76, OscillatorType::SynthwaveLead, 1.0f}, // E5
-    {12.0f, 74, OscillatorType::SynthwaveLead, 0.5f}, // D5
-    {12.5f, 78, OscillatorType::SynthwaveLead, 0.5f}, // F#5
-    {13.0f, 81, OscillatorType::SynthwaveLead, 1.0f}, // A5
-    {14.0f, 78, OscillatorType::SynthwaveLead, 0.5f}, // F#5
-    {14.5f, 74, OscillatorType::SynthwaveLead, 0.5f}, // D5
-    {15.0f, 76, OscillatorType::SynthwaveLead, 1.0f}, // E5
-};
-
-// Synthwave Track 4: "Nightcall" - Kavinsky style, slow pulsing (Fm-Cm-Ab-Eb)
-static const TrackNote g_SynthwaveNightcall[] = {
-    // === DRUMS (sparse, punchy 808s) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.5f}, {2.0f, 38, OscillatorType::Snare808, 0.25f},
-    {4.0f, 36, OscillatorType::Kick808, 0.5f}, {6.0f, 38, OscillatorType::Snare808, 0.25f},
-    {8.0f, 36, OscillatorType::Kick808, 0.5f}, {10.0f, 38, OscillatorType::Snare808, 0.25f},
-    {12.0f, 36, OscillatorType::Kick808, 0.5f}, {14.0f, 38, OscillatorType::Snare808, 0.25f},
-    // Open hihats on offbeats
-    {1.0f, 46, OscillatorType::HiHatOpen, 0.25f}, {3.0f, 46, OscillatorType::HiHatOpen, 0.25f},
-    {5.0f, 46, OscillatorType::HiHatOpen, 0.25f}, {7.0f, 46, OscillatorType::HiHatOpen, 0.25f},
-    {9.0f, 46, OscillatorType::HiHatOpen, 0.25f}, {11.0f, 46, OscillatorType::HiHatOpen, 0.25f},
-    {13.0f, 46, OscillatorType::HiHatOpen, 0.25f}, {15.0f, 46, OscillatorType::HiHatOpen, 0.25f},
-    // === BASS (driving octave pulse - iconic Kavinsky) ===
-    {0.0f, 29, OscillatorType::SynthwaveBass, 0.5f}, {0.5f, 41, OscillatorType::SynthwaveBass, 0.5f},
-    {1.0f, 29, OscillatorType::SynthwaveBass, 0.5f}, {1.5f, 41, OscillatorType::SynthwaveBass, 0.5f},
-    {2.0f, 29, OscillatorType::SynthwaveBass, 0.5f}, {2.5f, 41, OscillatorType::SynthwaveBass, 0.5f},
-    {3.0f, 29, OscillatorType::SynthwaveBass, 0.5f}, {3.5f, 41, OscillatorType::SynthwaveBass, 0.5f},
-    {4.0f, 24, OscillatorType::SynthwaveBass, 0.5f}, {4.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {5.0f, 24, OscillatorType::SynthwaveBass, 0.5f}, {5.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {6.0f, 24, OscillatorType::SynthwaveBass, 0.5f}, {6.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {7.0f, 24, OscillatorType::SynthwaveBass, 0.5f}, {7.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {8.0f, 32, OscillatorType::SynthwaveBass, 0.5f}, {8.5f, 44, OscillatorType::SynthwaveBass, 0.5f},
-    {9.0f, 32, OscillatorType::SynthwaveBass, 0.5f}, {9.5f, 44, OscillatorType::SynthwaveBass, 0.5f},
-    {10.0f, 32, OscillatorType::SynthwaveBass, 0.5f}, {10.5f, 44, OscillatorType::SynthwaveBass, 0.5f},
-    {11.0f, 32, OscillatorType::SynthwaveBass, 0.5f}, {11.5f, 44, OscillatorType::SynthwaveBass, 0.5f},
-    {12.0f, 27, OscillatorType::SynthwaveBass, 0.5f}, {12.5f, 39, OscillatorType::SynthwaveBass, 0.5f},
-    {13.0f, 27, OscillatorType::SynthwaveBass, 0.5f}, {13.5f, 39, OscillatorType::SynthwaveBass, 0.5f},
-    {14.0f, 27, OscillatorType::SynthwaveBass, 0.5f}, {14.5f, 39, OscillatorType::SynthwaveBass, 0.5f},
-    {15.0f, 27, OscillatorType::SynthwaveBass, 0.5f}, {15.5f, 39, OscillatorType::SynthwaveBass, 0.5f},
-    // === LEAD (simple, haunting melody) ===
-    {0.0f, 65, OscillatorType::SynthwaveLead, 2.0f},   // F4
-    {2.0f, 63, OscillatorType::SynthwaveLead, 2.0f},   // Eb4
-    {4.0f, 60, OscillatorType::SynthwaveLead, 2.0f},   // C4
-    {6.0f, 58, OscillatorType::SynthwaveLead, 2.0f},   // Bb3
-    {8.0f, 56, OscillatorType::SynthwaveLead, 2.0f},   // Ab3
-    {10.0f, 58, OscillatorType::SynthwaveLead, 2.0f},  // Bb3
-    {12.0f, 63, OscillatorType::SynthwaveLead, 2.0f},  // Eb4
-    {14.0f, 65, OscillatorType::SynthwaveLead, 2.0f},  // F4
-    // === PADS (Fm-Cm-Ab-Eb) ===
-    {0.0f, 53, OscillatorType::SynthwavePad, 4.0f},    // F3
-    {0.0f, 56, OscillatorType::SynthwavePad, 4.0f},    // Ab3
-    {0.0f, 60, OscillatorType::SynthwavePad, 4.0f},    // C4
-    {4.0f, 48, OscillatorType::SynthwavePad, 4.0f},    // C3
-    {4.0f, 51, OscillatorType::SynthwavePad, 4.0f},    // Eb3
-    {4.0f, 55, OscillatorType::SynthwavePad, 4.0f},    // G3
-    {8.0f, 56, OscillatorType::SynthwavePad, 4.0f},    // Ab3
-    {8.0f, 60, OscillatorType::SynthwavePad, 4.0f},    // C4
-    {8.0f, 63, OscillatorType::SynthwavePad, 4.0f},    // Eb4
-    {12.0f, 51, OscillatorType::SynthwavePad, 4.0f},   // Eb3
-    {12.0f, 55, OscillatorType::SynthwavePad, 4.0f},   // G3
-    {12.0f, 58, OscillatorType::SynthwavePad, 4.0f},   // Bb3
-};
-
-// Synthwave Track 5: "Turbo Killer" - Carpenter Brut style, aggressive (Em-C-G-D)
-static const TrackNote g_SynthwaveTurboKiller[] = {
-    // === DRUMS (hard hitting, driving) ===
-    {0.0f, 36, OscillatorType::KickHard, 0.25f}, {1.0f, 38, OscillatorType::Snare808, 0.25f},
-    {2.0f, 36, OscillatorType::KickHard, 0.25f}, {3.0f, 38, OscillatorType::Snare808, 0.25f},
-    {4.0f, 36, OscillatorType::KickHard, 0.25f}, {5.0f, 38, OscillatorType::Snare808, 0.25f},
-    {6.0f, 36, OscillatorType::KickHard, 0.25f}, {7.0f, 38, OscillatorType::Snare808, 0.25f},
-    {8.0f, 36, OscillatorType::KickHard, 0.25f}, {9.0f, 38, OscillatorType::Snare808, 0.25f},
-    {10.0f, 36, OscillatorType::KickHard, 0.25f}, {11.0f, 38, OscillatorType::Snare808, 0.25f},
-    {12.0f, 36, OscillatorType::KickHard, 0.25f}, {13.0f, 38, OscillatorType::Snare808, 0.25f},
-    {14.0f, 36, OscillatorType::KickHard, 0.25f}, {15.0f, 38, OscillatorType::Snare808, 0.25f},
-    // Fast 16th note hihats
-    {0.0f, 42, OscillatorType::HiHat, 0.125f}, {0.25f, 42, OscillatorType::HiHat, 0.125f},
-    {0.5f, 42, OscillatorType::HiHat, 0.125f}, {0.75f, 42, OscillatorType::HiHat, 0.125f},
-    {1.0f, 42, OscillatorType::HiHat, 0.125f}, {1.25f, 42, OscillatorType::HiHat, 0.125f},
-    {1.5f, 42, OscillatorType::HiHat, 0.125f}, {1.75f, 42, OscillatorType::HiHat, 0.125f},
-    {2.0f, 42, OscillatorType::HiHat, 0.125f}, {2.25f, 42, OscillatorType::HiHat, 0.125f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f}, {2.75f, 42, OscillatorType::HiHat, 0.125f},
-    {3.0f, 42, OscillatorType::HiHat, 0.125f}, {3.25f, 42, OscillatorType::HiHat, 0.125f},
-    {3.5f, 46, OscillatorType::HiHatOpen, 0.25f}, {3.75f, 42, OscillatorType::HiHat, 0.125f},
-    // === BASS (aggressive saw bass) ===
-    {0.0f, 28, OscillatorType::SynthwaveBass, 1.0f},   // E1
-    {1.0f, 28, OscillatorType::SynthwaveBass, 0.5f},
-    {1.5f, 40, OscillatorType::SynthwaveBass, 0.5f},   // octave
-    {2.0f, 28, OscillatorType::SynthwaveBass, 1.0f},
-    {3.0f, 28, OscillatorType::SynthwaveBass, 0.5f},
-    {3.5f, 40, OscillatorType::SynthwaveBass, 0.5f},
-    {4.0f, 36, OscillatorType::SynthwaveBass, 1.0f},   // C2
-    {5.0f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {5.5f, 48, OscillatorType::SynthwaveBass, 0.5f},
-    {6.0f, 36, OscillatorType::SynthwaveBass, 1.0f},
-    {7.0f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    {7.5f, 48, OscillatorType::SynthwaveBass, 0.5f},
-    {8.0f, 31, OscillatorType::SynthwaveBass, 1.0f},   // G1
-    {9.0f, 31, OscillatorType::SynthwaveBass, 0.5f},
-    {9.5f, 43, OscillatorType::SynthwaveBass, 0.5f},
-    {10.0f, 31, OscillatorType::SynthwaveBass, 1.0f},
-    {11.0f, 31, OscillatorType::SynthwaveBass, 0.5f},
-    {11.5f, 43, OscillatorType::SynthwaveBass, 0.5f},
-    {12.0f, 26, OscillatorType::SynthwaveBass, 1.0f},  // D1
-    {13.0f, 26, OscillatorType::SynthwaveBass, 0.5f},
-    {13.5f, 38, OscillatorType::SynthwaveBass, 0.5f},
-    {14.0f, 26, OscillatorType::SynthwaveBass, 1.0f},
-    {15.0f, 26, OscillatorType::SynthwaveBass, 0.5f},
-    {15.5f, 38, OscillatorType::SynthwaveBass, 0.5f},
-    // === LEAD (aggressive, fast arpeggios) ===
-    {0.0f, 64, OscillatorType::SynthwaveLead, 0.25f},  // E4
-    {0.25f, 67, OscillatorType::SynthwaveLead, 0.25f}, // G4
-    {0.5f, 71, OscillatorType::SynthwaveLead, 0.25f},  // B4
-    {0.75f, 76, OscillatorType::SynthwaveLead, 0.25f}, // E5
-    {1.0f, 71, OscillatorType::SynthwaveLead, 0.25f},
-    {1.25f, 67, OscillatorType::SynthwaveLead, 0.25f},
-    {1.5f, 64, OscillatorType::SynthwaveLead, 0.25f},
-    {1.75f, 67, OscillatorType::SynthwaveLead, 0.25f},
-    {2.0f, 64, OscillatorType::SynthwaveLead, 0.25f},
-    {2.25f, 67, OscillatorType::SynthwaveLead, 0.25f},
-    {2.5f, 71, OscillatorType::SynthwaveLead, 0.25f},
-    {2.75f, 76, OscillatorType::SynthwaveLead, 0.25f},
-    {3.0f, 71, OscillatorType::SynthwaveLead, 0.25f},
-    {3.25f, 67, OscillatorType::SynthwaveLead, 0.25f},
-    {3.5f, 64, OscillatorType::SynthwaveLead, 0.25f},
-    {3.75f, 67, OscillatorType::SynthwaveLead, 0.25f},
-    // C chord arp
-    {4.0f, 60, OscillatorType::SynthwaveLead, 0.25f},  // C4
-    {4.25f, 64, OscillatorType::SynthwaveLead, 0.25f}, // E4
-    {4.5f, 67, OscillatorType::SynthwaveLead, 0.25f},  // G4
-    {4.75f, 72, OscillatorType::SynthwaveLead, 0.25f}, // C5
-    {5.0f, 67, OscillatorType::SynthwaveLead, 0.25f},
-    {5.25f, 64, OscillatorType::SynthwaveLead, 0.25f},
-    {5.5f, 60, OscillatorType::SynthwaveLead, 0.25f},
-    {5.75f, 64, OscillatorType::SynthwaveLead, 0.25f},
-};
-
-// Synthwave Track 6: "Endless Summer" - The Midnight style, emotional (Am7-Fmaj7-Cmaj7-G)
-static const TrackNote g_SynthwaveEndlessSummer[] = {
-    // === DRUMS (smooth, groovy) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.25f}, {2.0f, 38, OscillatorType::Snare808, 0.25f},
-    {4.0f, 36, OscillatorType::Kick808, 0.25f}, {6.0f, 38, OscillatorType::Snare808, 0.25f},
-    {8.0f, 36, OscillatorType::Kick808, 0.25f}, {10.0f, 38, OscillatorType::Snare808, 0.25f},
-    {12.0f, 36, OscillatorType::Kick808, 0.25f}, {14.0f, 38, OscillatorType::Snare808, 0.25f},
-    // Shaker rhythm
-    {0.5f, 42, OscillatorType::HiHat, 0.125f}, {1.0f, 42, OscillatorType::HiHat, 0.125f},
-    {1.5f, 42, OscillatorType::HiHat, 0.125f}, {2.5f, 42, OscillatorType::HiHat, 0.125f},
-    {3.0f, 42, OscillatorType::HiHat, 0.125f}, {3.5f, 42, OscillatorType::HiHat, 0.125f},
-    {4.5f, 42, OscillatorType::HiHat, 0.125f}, {5.0f, 42, OscillatorType::HiHat, 0.125f},
-    {5.5f, 42, OscillatorType::HiHat, 0.125f}, {6.5f, 42, OscillatorType::HiHat, 0.125f},
-    {7.0f, 42, OscillatorType::HiHat, 0.125f}, {7.5f, 42, OscillatorType::HiHat, 0.125f},
-    // === BASS (smooth, melodic bass) ===
-    {0.0f, 33, OscillatorType::SynthwaveBass, 3.5f},   // A1
-    {4.0f, 29, OscillatorType::SynthwaveBass, 3.5f},   // F1
-    {8.0f, 36, OscillatorType::SynthwaveBass, 3.5f},   // C2
-    {12.0f, 31, OscillatorType::SynthwaveBass, 3.5f},  // G1
-    // === MELODY (soaring, emotional) ===
-    {0.0f, 72, OscillatorType::SynthwaveLead, 1.5f},   // C5
-    {2.0f, 71, OscillatorType::SynthwaveLead, 0.5f},   // B4
-    {2.5f, 69, OscillatorType::SynthwaveLead, 1.5f},   // A4
-    {4.0f, 72, OscillatorType::SynthwaveLead, 1.0f},   // C5
-    {5.0f, 74, OscillatorType::SynthwaveLead, 0.5f},   // D5
-    {5.5f, 76, OscillatorType::SynthwaveLead, 1.5f},   // E5
-    {7.0f, 77, OscillatorType::SynthwaveLead, 1.0f},   // F5
-    {8.0f, 79, OscillatorType::SynthwaveLead, 1.5f},   // G5
-    {10.0f, 77, OscillatorType::SynthwaveLead, 0.5f},  // F5
-    {10.5f, 76, OscillatorType::SynthwaveLead, 1.5f},  // E5
-    {12.0f, 74, OscillatorType::SynthwaveLead, 1.0f},  // D5
-    {13.0f, 72, OscillatorType::SynthwaveLead, 0.5f},  // C5
-    {13.5f, 71, OscillatorType::SynthwaveLead, 0.5f},  // B4
-    {14.0f, 69, OscillatorType::SynthwaveLead, 2.0f},  // A4
-    // === PADS (Am7-Fmaj7-Cmaj7-G) ===
-    {0.0f, 57, OscillatorType::SynthwavePad, 4.0f},    // A3
-    {0.0f, 60, OscillatorType::SynthwavePad, 4.0f},    // C4
-    {0.0f, 64, OscillatorType::SynthwavePad, 4.0f},    // E4
-    {0.0f, 67, OscillatorType::SynthwavePad, 4.0f},    // G4
-    {4.0f, 53, OscillatorType::SynthwavePad, 4.0f},    // F3
-    {4.0f, 57, OscillatorType::SynthwavePad, 4.0f},    // A3
-    {4.0f, 60, OscillatorType::SynthwavePad, 4.0f},    // C4
-    {4.0f, 64, OscillatorType::SynthwavePad, 4.0f},    // E4
-    {8.0f, 48, OscillatorType::SynthwavePad, 4.0f},    // C3
-    {8.0f, 52, OscillatorType::SynthwavePad, 4.0f},    // E3
-    {8.0f, 55, OscillatorType::SynthwavePad, 4.0f},    // G3
-    {8.0f, 59, OscillatorType::SynthwavePad, 4.0f},    // B3
-    {12.0f, 55, OscillatorType::SynthwavePad, 4.0f},   // G3
-    {12.0f, 59, OscillatorType::SynthwavePad, 4.0f},   // B3
-    {12.0f, 62, OscillatorType::SynthwavePad, 4.0f},   // D4
-};
-
-// Synthwave Track 7: "Tech Noir" - Gunship style, darker (Dm-Bb-F-C)
-static const TrackNote g_SynthwaveTechNoir[] = {
-    // === DRUMS (heavier, darker) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.5f}, {1.5f, 36, OscillatorType::Kick808, 0.25f},
-    {2.0f, 38, OscillatorType::Snare808, 0.25f}, {3.5f, 36, OscillatorType::Kick808, 0.25f},
-    {4.0f, 36, OscillatorType::Kick808, 0.5f}, {5.5f, 36, OscillatorType::Kick808, 0.25f},
-    {6.0f, 38, OscillatorType::Snare808, 0.25f}, {7.5f, 36, OscillatorType::Kick808, 0.25f},
-    {8.0f, 36, OscillatorType::Kick808, 0.5f}, {9.5f, 36, OscillatorType::Kick808, 0.25f},
-    {10.0f, 38, OscillatorType::Snare808, 0.25f}, {11.5f, 36, OscillatorType::Kick808, 0.25f},
-    {12.0f, 36, OscillatorType::Kick808, 0.5f}, {13.5f, 36, OscillatorType::Kick808, 0.25f},
-    {14.0f, 38, OscillatorType::Snare808, 0.25f}, {15.5f, 36, OscillatorType::Kick808, 0.25f},
-    // Hihats
-    {0.0f, 42, OscillatorType::HiHat, 0.125f}, {0.5f, 42, OscillatorType::HiHat, 0.125f},
-    {1.0f, 46, OscillatorType::HiHatOpen, 0.25f}, {2.0f, 42, OscillatorType::HiHat, 0.125f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f}, {3.0f, 46, OscillatorType::HiHatOpen, 0.25f},
-    {4.0f, 42, OscillatorType::HiHat, 0.125f}, {4.5f, 42, OscillatorType::HiHat, 0.125f},
-    {5.0f, 46, OscillatorType::HiHatOpen, 0.25f}, {6.0f, 42, OscillatorType::HiHat, 0.125f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f}, {7.0f, 46, OscillatorType::HiHatOpen, 0.25f},
-    // === BASS (dark, syncopated) ===
-    {0.0f, 26, OscillatorType::SynthwaveBass, 0.5f},   // D1
-    {0.5f, 26, OscillatorType::SynthwaveBass, 0.25f},
-    {1.0f, 38, OscillatorType::SynthwaveBass, 0.5f},   // D2
-    {2.0f, 26, OscillatorType::SynthwaveBass, 0.5f},
-    {3.0f, 26, OscillatorType::SynthwaveBass, 0.25f},
-    {3.5f, 38, OscillatorType::SynthwaveBass, 0.5f},
-    {4.0f, 22, OscillatorType::SynthwaveBass, 0.5f},   // Bb0
-    {4.5f, 22, OscillatorType::SynthwaveBass, 0.25f},
-    {5.0f, 34, OscillatorType::SynthwaveBass, 0.5f},   // Bb1
-    {6.0f, 22, OscillatorType::SynthwaveBass, 0.5f},
-    {7.0f, 22, OscillatorType::SynthwaveBass, 0.25f},
-    {7.5f, 34, OscillatorType::SynthwaveBass, 0.5f},
-    {8.0f, 29, OscillatorType::SynthwaveBass, 0.5f},   // F1
-    {8.5f, 29, OscillatorType::SynthwaveBass, 0.25f},
-    {9.0f, 41, OscillatorType::SynthwaveBass, 0.5f},   // F2
-    {10.0f, 29, OscillatorType::SynthwaveBass, 0.5f},
-    {11.0f, 29, OscillatorType::SynthwaveBass, 0.25f},
-    {11.5f, 41, OscillatorType::SynthwaveBass, 0.5f},
-    {12.0f, 24, OscillatorType::SynthwaveBass, 0.5f},  // C1
-    {12.5f, 24, OscillatorType::SynthwaveBass, 0.25f},
-    {13.0f, 36, OscillatorType::SynthwaveBass, 0.5f},  // C2
-    {14.0f, 24, OscillatorType::SynthwaveBass, 0.5f},
-    {15.0f, 24, OscillatorType::SynthwaveBass, 0.25f},
-    {15.5f, 36, OscillatorType::SynthwaveBass, 0.5f},
-    // === MELODY (darker, mysterious) ===
-    {0.0f, 62, OscillatorType::SynthwaveLead, 1.0f},   // D4
-    {1.0f, 65, OscillatorType::SynthwaveLead, 0.5f},   // F4
-    {1.5f, 69, OscillatorType::SynthwaveLead, 0.5f},   // A4
-    {2.0f, 70, OscillatorType::SynthwaveLead, 2.0f},   // Bb4
-    {4.0f, 69, OscillatorType::SynthwaveLead, 0.5f},   // A4
-    {4.5f, 65, OscillatorType::SynthwaveLead, 0.5f},   // F4
-    {5.0f, 62, OscillatorType::SynthwaveLead, 1.0f},   // D4
-    {6.0f, 60, OscillatorType::SynthwaveLead, 2.0f},   // C4
-    {8.0f, 65, OscillatorType::SynthwaveLead, 1.0f},   // F4
-    {9.0f, 69, OscillatorType::SynthwaveLead, 0.5f},   // A4
-    {9.5f, 72, OscillatorType::SynthwaveLead, 0.5f},   // C5
-    {10.0f, 74, OscillatorType::SynthwaveLead, 2.0f},  // D5
-    {12.0f, 72, OscillatorType::SynthwaveLead, 0.5f},  // C5
-    {12.5f, 69, OscillatorType::SynthwaveLead, 0.5f},  // A4
-    {13.0f, 67, OscillatorType::SynthwaveLead, 1.0f},  // G4
-    {14.0f, 65, OscillatorType::SynthwaveLead, 2.0f},  // F4
-    // === PADS (Dm-Bb-F-C) ===
-    {0.0f, 50, OscillatorType::SynthwavePad, 4.0f},    // D3
-    {0.0f, 53, OscillatorType::SynthwavePad, 4.0f},    // F3
-    {0.0f, 57, OscillatorType::SynthwavePad, 4.0f},    // A3
-    {4.0f, 46, OscillatorType::SynthwavePad, 4.0f},    // Bb2
-    {4.0f, 50, OscillatorType::SynthwavePad, 4.0f},    // D3
-    {4.0f, 53, OscillatorType::SynthwavePad, 4.0f},    // F3
-    {8.0f, 53, OscillatorType::SynthwavePad, 4.0f},    // F3
-    {8.0f, 57, OscillatorType::SynthwavePad, 4.0f},    // A3
-    {8.0f, 60, OscillatorType::SynthwavePad, 4.0f},    // C4
-    {12.0f, 48, OscillatorType::SynthwavePad, 4.0f},   // C3
-    {12.0f, 52, OscillatorType::SynthwavePad, 4.0f},   // E3
-    {12.0f, 55, OscillatorType::SynthwavePad, 4.0f},   // G3
-};
-
-// Synthwave Track 8: "A Real Hero" - Drive soundtrack style, slow emotional (Dm-F-C-Am)
-static const TrackNote g_SynthwaveRealHero[] = {
-    // === DRUMS (minimal, slow) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.5f}, {4.0f, 38, OscillatorType::Snare808, 0.25f},
-    {8.0f, 36, OscillatorType::Kick808, 0.5f}, {12.0f, 38, OscillatorType::Snare808, 0.25f},
-    // Soft hihats
-    {2.0f, 42, OscillatorType::HiHat, 0.125f}, {6.0f, 42, OscillatorType::HiHat, 0.125f},
-    {10.0f, 42, OscillatorType::HiHat, 0.125f}, {14.0f, 42, OscillatorType::HiHat, 0.125f},
-    // === BASS (slow, sustaining) ===
-    {0.0f, 26, OscillatorType::SynthwaveBass, 7.5f},   // D1
-    {8.0f, 29, OscillatorType::SynthwaveBass, 7.5f},   // F1
-    // === MELODY (very slow, emotional) ===
-    {0.0f, 69, OscillatorType::SynthwaveLead, 4.0f},   // A4
-    {4.0f, 72, OscillatorType::SynthwaveLead, 2.0f},   // C5
-    {6.0f, 74, OscillatorType::SynthwaveLead, 2.0f},   // D5
-    {8.0f, 77, OscillatorType::SynthwaveLead, 4.0f},   // F5
-    {12.0f, 76, OscillatorType::SynthwaveLead, 2.0f},  // E5
-    {14.0f, 74, OscillatorType::SynthwaveLead, 2.0f},  // D5
-    // === PADS (Dm-F) ===
-    {0.0f, 50, OscillatorType::SynthwavePad, 8.0f},    // D3
-    {0.0f, 53, OscillatorType::SynthwavePad, 8.0f},    // F3
-    {0.0f, 57, OscillatorType::SynthwavePad, 8.0f},    // A3
-    {8.0f, 53, OscillatorType::SynthwavePad, 8.0f},    // F3
-    {8.0f, 57, OscillatorType::SynthwavePad, 8.0f},    // A3
-    {8.0f, 60, OscillatorType::SynthwavePad, 8.0f},    // C4
-};
-
-// ===========================================
-// TECHNO TRACKS
-// ===========================================
-
-// Techno Track 1: "Machine" - Minimal driving techno
-static const TrackNote g_TechnoMachine[] = {
-    // === DRUMS (4 on the floor) ===
-    {0.0f, 36, OscillatorType::Kick, 0.25f}, {1.0f, 36, OscillatorType::Kick, 0.25f},
-    {2.0f, 36, OscillatorType::Kick, 0.25f}, {3.0f, 36, OscillatorType::Kick, 0.25f},
-    {4.0f, 36, OscillatorType::Kick, 0.25f}, {5.0f, 36, OscillatorType::Kick, 0.25f},
-    {6.0f, 36, OscillatorType::Kick, 0.25f}, {7.0f, 36, OscillatorType::Kick, 0.25f},
-    {8.0f, 36, OscillatorType::Kick, 0.25f}, {9.0f, 36, OscillatorType::Kick, 0.25f},
-    {10.0f, 36, OscillatorType::Kick, 0.25f}, {11.0f, 36, OscillatorType::Kick, 0.25f},
-    {12.0f, 36, OscillatorType::Kick, 0.25f}, {13.0f, 36, OscillatorType::Kick, 0.25f},
-    {14.0f, 36, OscillatorType::Kick, 0.25f}, {15.0f, 36, OscillatorType::Kick, 0.25f},
-    // Claps on 2 and 4
-    {1.0f, 39, OscillatorType::Clap, 0.25f}, {3.0f, 39, OscillatorType::Clap, 0.25f},
-    {5.0f, 39, OscillatorType::Clap, 0.25f}, {7.0f, 39, OscillatorType::Clap, 0.25f},
-    {9.0f, 39, OscillatorType::Clap, 0.25f}, {11.0f, 39, OscillatorType::Clap, 0.25f},
-    {13.0f, 39, OscillatorType::Clap, 0.25f}, {15.0f, 39, OscillatorType::Clap, 0.25f},
-    // Offbeat hihats
-    {0.5f, 42, OscillatorType::HiHat, 0.125f}, {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f}, {3.5f, 42, OscillatorType::HiHat, 0.125f},
-    {4.5f, 42, OscillatorType::HiHat, 0.125f}, {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f}, {7.5f, 42, OscillatorType::HiHat, 0.125f},
-    {8.5f, 42, OscillatorType::HiHat, 0.125f}, {9.5f, 42, OscillatorType::HiHat, 0.125f},
-    {10.5f, 42, OscillatorType::HiHat, 0.125f}, {11.5f, 42, OscillatorType::HiHat, 0.125f},
-    {12.5f, 42, OscillatorType::HiHat, 0.125f}, {13.5f, 42, OscillatorType::HiHat, 0.125f},
-    {14.5f, 42, OscillatorType::HiHat, 0.125f}, {15.5f, 42, OscillatorType::HiHat, 0.125f},
-    // === ACID BASS (TB-303 style) ===
-    {0.0f, 36, OscillatorType::AcidBass, 0.25f}, {0.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {0.75f, 39, OscillatorType::AcidBass, 0.125f}, {1.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {1.5f, 48, OscillatorType::AcidBass, 0.125f}, {1.75f, 36, OscillatorType::AcidBass, 0.125f},
-    {2.0f, 36, OscillatorType::AcidBass, 0.25f}, {2.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {2.75f, 41, OscillatorType::AcidBass, 0.125f}, {3.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {3.5f, 48, OscillatorType::AcidBass, 0.125f}, {3.75f, 36, OscillatorType::AcidBass, 0.125f},
-    {4.0f, 36, OscillatorType::AcidBass, 0.25f}, {4.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {4.75f, 39, OscillatorType::AcidBass, 0.125f}, {5.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {5.5f, 48, OscillatorType::AcidBass, 0.125f}, {5.75f, 36, OscillatorType::AcidBass, 0.125f},
-    {6.0f, 36, OscillatorType::AcidBass, 0.25f}, {6.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {6.75f, 43, OscillatorType::AcidBass, 0.125f}, {7.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {7.5f, 48, OscillatorType::AcidBass, 0.125f}, {7.75f, 36, OscillatorType::AcidBass, 0.125f},
-    // Repeat pattern bars 9-16
-    {8.0f, 36, OscillatorType::AcidBass, 0.25f}, {8.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {8.75f, 39, OscillatorType::AcidBass, 0.125f}, {9.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {9.5f, 48, OscillatorType::AcidBass, 0.125f}, {9.75f, 36, OscillatorType::AcidBass, 0.125f},
-    {10.0f, 36, OscillatorType::AcidBass, 0.25f}, {10.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {10.75f, 41, OscillatorType::AcidBass, 0.125f}, {11.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {11.5f, 48, OscillatorType::AcidBass, 0.125f}, {11.75f, 36, OscillatorType::AcidBass, 0.125f},
-    {12.0f, 36, OscillatorType::AcidBass, 0.25f}, {12.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {12.75f, 39, OscillatorType::AcidBass, 0.125f}, {13.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {13.5f, 48, OscillatorType::AcidBass, 0.125f}, {13.75f, 36, OscillatorType::AcidBass, 0.125f},
-    {14.0f, 36, OscillatorType::AcidBass, 0.25f}, {14.5f, 36, OscillatorType::AcidBass, 0.125f},
-    {14.75f, 43, OscillatorType::AcidBass, 0.125f}, {15.0f, 36, OscillatorType::AcidBass, 0.25f},
-    {15.5f, 48, OscillatorType::AcidBass, 0.125f}, {15.75f, 36, OscillatorType::AcidBass, 0.125f},
-};
-
-// Techno Track 2: "Dark Factory" - Darker, harder
-static const TrackNote g_TechnoDarkFactory[] = {
-    // === DRUMS (harder kick) ===
-    {0.0f, 36, OscillatorType::KickHard, 0.25f}, {1.0f, 36, OscillatorType::KickHard, 0.25f},
-    {2.0f, 36, OscillatorType::KickHard, 0.25f}, {3.0f, 36, OscillatorType::KickHard, 0.25f},
-    {4.0f, 36, OscillatorType::KickHard, 0.25f}, {5.0f, 36, OscillatorType::KickHard, 0.25f},
-    {6.0f, 36, OscillatorType::KickHard, 0.25f}, {7.0f, 36, OscillatorType::KickHard, 0.25f},
-    {8.0f, 36, OscillatorType::KickHard, 0.25f}, {9.0f, 36, OscillatorType::KickHard, 0.25f},
-    {10.0f, 36, OscillatorType::KickHard, 0.25f}, {11.0f, 36, OscillatorType::KickHard, 0.25f},
-    {12.0f, 36, OscillatorType::KickHard, 0.25f}, {13.0f, 36, OscillatorType::KickHard, 0.25f},
-    {14.0f, 36, OscillatorType::KickHard, 0.25f}, {15.0f, 36, OscillatorType::KickHard, 0.25f},
-    // Snare on 2 and 4
-    {1.0f, 38, OscillatorType::Snare, 0.25f}, {3.0f, 38, OscillatorType::Snare, 0.25f},
-    {5.0f, 38, OscillatorType::Snare, 0.25f}, {7.0f, 38, OscillatorType::Snare, 0.25f},
-    {9.0f, 38, OscillatorType::Snare, 0.25f}, {11.0f, 38, OscillatorType::Snare, 0.25f},
-    {13.0f, 38, OscillatorType::Snare, 0.25f}, {15.0f, 38, OscillatorType::Snare, 0.25f},
-    // Fast hihats
-    {0.25f, 42, OscillatorType::HiHat, 0.0625f}, {0.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {0.75f, 42, OscillatorType::HiHat, 0.0625f}, {1.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {1.5f, 42, OscillatorType::HiHat, 0.0625f}, {1.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {2.25f, 42, OscillatorType::HiHat, 0.0625f}, {2.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {2.75f, 42, OscillatorType::HiHat, 0.0625f}, {3.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.5f, 42, OscillatorType::HiHat, 0.0625f}, {3.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.25f, 42, OscillatorType::HiHat, 0.0625f}, {4.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.75f, 42, OscillatorType::HiHat, 0.0625f}, {5.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {5.5f, 42, OscillatorType::HiHat, 0.0625f}, {5.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {6.25f, 42, OscillatorType::HiHat, 0.0625f}, {6.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {6.75f, 42, OscillatorType::HiHat, 0.0625f}, {7.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {7.5f, 42, OscillatorType::HiHat, 0.0625f}, {7.75f, 42, OscillatorType::HiHat, 0.0625f},
-    // === REESE BASS (detuned) ===
-    {0.0f, 29, OscillatorType::Reese, 4.0f},   // F1
-    {4.0f, 27, OscillatorType::Reese, 4.0f},   // Eb1
-    {8.0f, 29, OscillatorType::Reese, 4.0f},   // F1
-    {12.0f, 32, OscillatorType::Reese, 4.0f},  // Ab1
-    // === STAB ===
-    {0.0f, 53, OscillatorType::TechnoStab, 0.125f},
-    {0.75f, 53, OscillatorType::TechnoStab, 0.125f},
-    {4.0f, 51, OscillatorType::TechnoStab, 0.125f},
-    {4.75f, 51, OscillatorType::TechnoStab, 0.125f},
-    {8.0f, 53, OscillatorType::TechnoStab, 0.125f},
-    {8.75f, 53, OscillatorType::TechnoStab, 0.125f},
-    {12.0f, 56, OscillatorType::TechnoStab, 0.125f},
-    {12.75f, 56, OscillatorType::TechnoStab, 0.125f},
-};
-
-// Techno Track 3: "Underground" - Rolling bass, hypnotic
-static const TrackNote g_TechnoUnderground[] = {
-    // === DRUMS ===
-    {0.0f, 36, OscillatorType::Kick, 0.25f}, {1.0f, 36, OscillatorType::Kick, 0.25f},
-    {2.0f, 36, OscillatorType::Kick, 0.25f}, {3.0f, 36, OscillatorType::Kick, 0.25f},
-    {4.0f, 36, OscillatorType::Kick, 0.25f}, {5.0f, 36, OscillatorType::Kick, 0.25f},
-    {6.0f, 36, OscillatorType::Kick, 0.25f}, {7.0f, 36, OscillatorType::Kick, 0.25f},
-    // Rim on 2, clap on 4
-    {1.0f, 37, OscillatorType::SnareRim, 0.125f}, {3.0f, 39, OscillatorType::Clap, 0.25f},
-    {5.0f, 37, OscillatorType::SnareRim, 0.125f}, {7.0f, 39, OscillatorType::Clap, 0.25f},
-    // Shaker
-    {0.5f, 70, OscillatorType::Maracas, 0.125f}, {1.5f, 70, OscillatorType::Maracas, 0.125f},
-    {2.5f, 70, OscillatorType::Maracas, 0.125f}, {3.5f, 70, OscillatorType::Maracas, 0.125f},
-    {4.5f, 70, OscillatorType::Maracas, 0.125f}, {5.5f, 70, OscillatorType::Maracas, 0.125f},
-    {6.5f, 70, OscillatorType::Maracas, 0.125f}, {7.5f, 70, OscillatorType::Maracas, 0.125f},
-    // === ROLLING BASS (16th notes) ===
-    {0.0f, 33, OscillatorType::SynthBass, 0.25f}, {0.25f, 33, OscillatorType::SynthBass, 0.125f},
-    {0.5f, 33, OscillatorType::SynthBass, 0.25f}, {0.75f, 33, OscillatorType::SynthBass, 0.125f},
-    {1.0f, 33, OscillatorType::SynthBass, 0.25f}, {1.25f, 33, OscillatorType::SynthBass, 0.125f},
-    {1.5f, 33, OscillatorType::SynthBass, 0.25f}, {1.75f, 33, OscillatorType::SynthBass, 0.125f},
-    {2.0f, 31, OscillatorType::SynthBass, 0.25f}, {2.25f, 31, OscillatorType::SynthBass, 0.125f},
-    {2.5f, 31, OscillatorType::SynthBass, 0.25f}, {2.75f, 31, OscillatorType::SynthBass, 0.125f},
-    {3.0f, 31, OscillatorType::SynthBass, 0.25f}, {3.25f, 31, OscillatorType::SynthBass, 0.125f},
-    {3.5f, 31, OscillatorType::SynthBass, 0.25f}, {3.75f, 31, OscillatorType::SynthBass, 0.125f},
-    {4.0f, 36, OscillatorType::SynthBass, 0.25f}, {4.25f, 36, OscillatorType::SynthBass, 0.125f},
-    {4.5f, 36, OscillatorType::SynthBass, 0.25f}, {4.75f, 36, OscillatorType::SynthBass, 0.125f},
-    {5.0f, 36, OscillatorType::SynthBass, 0.25f}, {5.25f, 36, OscillatorType::SynthBass, 0.125f},
-    {5.5f, 36, OscillatorType::SynthBass, 0.25f}, {5.75f, 36, OscillatorType::SynthBass, 0.125f},
-    {6.0f, 38, OscillatorType::SynthBass, 0.25f}, {6.25f, 38, OscillatorType::SynthBass, 0.125f},
-    {6.5f, 38, OscillatorType::SynthBass, 0.25f}, {6.75f, 38, OscillatorType::SynthBass, 0.125f},
-    {7.0f, 38, OscillatorType::SynthBass, 0.25f}, {7.25f, 38, OscillatorType::SynthBass, 0.125f},
-    {7.5f, 38, OscillatorType::SynthBass, 0.25f}, {7.75f, 38, OscillatorType::SynthBass, 0.125f},
-};
-
-// ===========================================
-// CHIPTUNE TRACKS
-// ===========================================
-
-// Chiptune Track 1: "Level 1" - Bouncy Mario-style
-static const TrackNote g_ChiptuneLevel1[] = {
-    // === DRUMS ===
-    {0.0f, 36, OscillatorType::Kick, 0.25f}, {1.0f, 38, OscillatorType::Snare, 0.25f},
-    {2.0f, 36, OscillatorType::Kick, 0.25f}, {2.5f, 36, OscillatorType::Kick, 0.125f},
-    {3.0f, 38, OscillatorType::Snare, 0.25f},
-    {4.0f, 36, OscillatorType::Kick, 0.25f}, {5.0f, 38, OscillatorType::Snare, 0.25f},
-    {6.0f, 36, OscillatorType::Kick, 0.25f}, {6.5f, 36, OscillatorType::Kick, 0.125f},
-    {7.0f, 38, OscillatorType::Snare, 0.25f},
-    // Hihats
-    {0.5f, 42, OscillatorType::HiHat, 0.125f}, {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f}, {3.5f, 42, OscillatorType::HiHat, 0.125f},
-    {4.5f, 42, OscillatorType::HiHat, 0.125f}, {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f}, {7.5f, 42, OscillatorType::HiHat, 0.125f},
-    // === BASS (Triangle - classic NES style) ===
-    {0.0f, 48, OscillatorType::Triangle, 0.5f}, {0.5f, 48, OscillatorType::Triangle, 0.5f},
-    {1.0f, 48, OscillatorType::Triangle, 0.5f}, {1.5f, 48, OscillatorType::Triangle, 0.5f},
-    {2.0f, 53, OscillatorType::Triangle, 0.5f}, {2.5f, 53, OscillatorType::Triangle, 0.5f},
-    {3.0f, 55, OscillatorType::Triangle, 0.5f}, {3.5f, 55, OscillatorType::Triangle, 0.5f},
-    {4.0f, 48, OscillatorType::Triangle, 0.5f}, {4.5f, 48, OscillatorType::Triangle, 0.5f},
-    {5.0f, 48, OscillatorType::Triangle, 0.5f}, {5.5f, 48, OscillatorType::Triangle, 0.5f},
-    {6.0f, 55, OscillatorType::Triangle, 0.5f}, {6.5f, 55, OscillatorType::Triangle, 0.5f},
-    {7.0f, 53, OscillatorType::Triangle, 0.5f}, {7.5f, 53, OscillatorType::Triangle, 0.5f},
-    // === MELODY (Pulse - 12.5% duty for that NES sound) ===
-    {0.0f, 72, OscillatorType::SynthChip, 0.25f},  // C5
-    {0.25f, 76, OscillatorType::SynthChip, 0.25f}, // E5
-    {0.5f, 79, OscillatorType::SynthChip, 0.5f},   // G5
-    {1.0f, 84, OscillatorType::SynthChip, 0.5f},   // C6
-    {1.5f, 79, OscillatorType::SynthChip, 0.25f},  // G5
-    {1.75f, 76, OscillatorType::SynthChip, 0.25f}, // E5
-    {2.0f, 77, OscillatorType::SynthChip, 0.5f},   // F5
-    {2.5f, 81, OscillatorType::SynthChip, 0.5f},   // A5
-    {3.0f, 79, OscillatorType::SynthChip, 0.5f},   // G5
-    {3.5f, 76, OscillatorType::SynthChip, 0.5f},   // E5
-    {4.0f, 72, OscillatorType::SynthChip, 0.25f},  // C5
-    {4.25f, 76, OscillatorType::SynthChip, 0.25f}, // E5
-    {4.5f, 79, OscillatorType::SynthChip, 0.5f},   // G5
-    {5.0f, 84, OscillatorType::SynthChip, 0.5f},   // C6
-    {5.5f, 86, OscillatorType::SynthChip, 0.25f},  // D6
-    {5.75f, 84, OscillatorType::SynthChip, 0.25f}, // C6
-    {6.0f, 79, OscillatorType::SynthChip, 1.0f},   // G5
-    {7.0f, 77, OscillatorType::SynthChip, 0.5f},   // F5
-    {7.5f, 76, OscillatorType::SynthChip, 0.5f},   // E5
-    // === HARMONY (Pulse 2 - lower) ===
-    {0.0f, 60, OscillatorType::Pulse, 0.5f},   // C4
-    {0.5f, 64, OscillatorType::Pulse, 0.5f},   // E4
-    {1.0f, 67, OscillatorType::Pulse, 0.5f},   // G4
-    {1.5f, 64, OscillatorType::Pulse, 0.5f},   // E4
-    {2.0f, 65, OscillatorType::Pulse, 0.5f},   // F4
-    {2.5f, 69, OscillatorType::Pulse, 0.5f},   // A4
-    {3.0f, 67, OscillatorType::Pulse, 0.5f},   // G4
-    {3.5f, 64, OscillatorType::Pulse, 0.5f},   // E4
-    {4.0f, 60, OscillatorType::Pulse, 0.5f},   // C4
-    {4.5f, 64, OscillatorType::Pulse, 0.5f},   // E4
-    {5.0f, 67, OscillatorType::Pulse, 0.5f},   // G4
-    {5.5f, 72, OscillatorType::Pulse, 0.5f},   // C5
-    {6.0f, 67, OscillatorType::Pulse, 1.0f},   // G4
-    {7.0f, 65, OscillatorType::Pulse, 0.5f},   // F4
-    {7.5f, 64, OscillatorType::Pulse, 0.5f},   // E4
-};
-
-// Chiptune Track 2: "Boss Fight" - Intense, faster
-static const TrackNote g_ChiptuneBossFight[] = {
-    // === DRUMS (fast and intense) ===
-    {0.0f, 36, OscillatorType::KickHard, 0.25f}, {0.5f, 38, OscillatorType::Snare, 0.125f},
-    {1.0f, 36, OscillatorType::KickHard, 0.25f}, {1.5f, 38, OscillatorType::Snare, 0.125f},
-    {2.0f, 36, OscillatorType::KickHard, 0.25f}, {2.5f, 38, OscillatorType::Snare, 0.125f},
-    {3.0f, 36, OscillatorType::KickHard, 0.25f}, {3.5f, 38, OscillatorType::Snare, 0.125f},
-    {4.0f, 36, OscillatorType::KickHard, 0.25f}, {4.5f, 38, OscillatorType::Snare, 0.125f},
-    {5.0f, 36, OscillatorType::KickHard, 0.25f}, {5.5f, 38, OscillatorType::Snare, 0.125f},
-    {6.0f, 36, OscillatorType::KickHard, 0.25f}, {6.5f, 38, OscillatorType::Snare, 0.125f},
-    {7.0f, 36, OscillatorType::KickHard, 0.25f}, {7.5f, 38, OscillatorType::Snare, 0.125f},
-    // Fast hihats
-    {0.25f, 42, OscillatorType::HiHat, 0.0625f}, {0.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {1.25f, 42, OscillatorType::HiHat, 0.0625f}, {1.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {2.25f, 42, OscillatorType::HiHat, 0.0625f}, {2.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.25f, 42, OscillatorType::HiHat, 0.0625f}, {3.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.25f, 42, OscillatorType::HiHat, 0.0625f}, {4.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {5.25f, 42, OscillatorType::HiHat, 0.0625f}, {5.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {6.25f, 42, OscillatorType::HiHat, 0.0625f}, {6.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {7.25f, 42, OscillatorType::HiHat, 0.0625f}, {7.75f, 42, OscillatorType::HiHat, 0.0625f},
-    // === BASS (aggressive) ===
-    {0.0f, 40, OscillatorType::Triangle, 0.25f}, {0.25f, 40, OscillatorType::Triangle, 0.25f},
-    {0.5f, 40, OscillatorType::Triangle, 0.25f}, {0.75f, 40, OscillatorType::Triangle, 0.25f},
-    {1.0f, 40, OscillatorType::Triangle, 0.25f}, {1.25f, 40, OscillatorType::Triangle, 0.25f},
-    {1.5f, 40, OscillatorType::Triangle, 0.25f}, {1.75f, 40, OscillatorType::Triangle, 0.25f},
-    {2.0f, 43, OscillatorType::Triangle, 0.25f}, {2.25f, 43, OscillatorType::Triangle, 0.25f},
-    {2.5f, 43, OscillatorType::Triangle, 0.25f}, {2.75f, 43, OscillatorType::Triangle, 0.25f},
-    {3.0f, 45, OscillatorType::Triangle, 0.25f}, {3.25f, 45, OscillatorType::Triangle, 0.25f},
-    {3.5f, 45, OscillatorType::Triangle, 0.25f}, {3.75f, 45, OscillatorType::Triangle, 0.25f},
-    {4.0f, 40, OscillatorType::Triangle, 0.25f}, {4.25f, 40, OscillatorType::Triangle, 0.25f},
-    {4.5f, 40, OscillatorType::Triangle, 0.25f}, {4.75f, 40, OscillatorType::Triangle, 0.25f},
-    {5.0f, 40, OscillatorType::Triangle, 0.25f}, {5.25f, 40, OscillatorType::Triangle, 0.25f},
-    {5.5f, 40, OscillatorType::Triangle, 0.25f}, {5.75f, 40, OscillatorType::Triangle, 0.25f},
-    {6.0f, 47, OscillatorType::Triangle, 0.25f}, {6.25f, 47, OscillatorType::Triangle, 0.25f},
-    {6.5f, 47, OscillatorType::Triangle, 0.25f}, {6.75f, 47, OscillatorType::Triangle, 0.25f},
-    {7.0f, 45, OscillatorType::Triangle, 0.25f}, {7.25f, 45, OscillatorType::Triangle, 0.25f},
-    {7.5f, 43, OscillatorType::Triangle, 0.25f}, {7.75f, 43, OscillatorType::Triangle, 0.25f},
-    // === MELODY (intense arpeggios) ===
-    {0.0f, 64, OscillatorType::SynthChip, 0.125f},  // E4
-    {0.125f, 67, OscillatorType::SynthChip, 0.125f}, // G4
-    {0.25f, 71, OscillatorType::SynthChip, 0.125f},  // B4
-    {0.375f, 76, OscillatorType::SynthChip, 0.125f}, // E5
-    {0.5f, 71, OscillatorType::SynthChip, 0.125f},   // B4
-    {0.625f, 67, OscillatorType::SynthChip, 0.125f}, // G4
-    {0.75f, 64, OscillatorType::SynthChip, 0.125f},  // E4
-    {0.875f, 67, OscillatorType::SynthChip, 0.125f}, // G4
-    {1.0f, 64, OscillatorType::SynthChip, 0.125f},
-    {1.125f, 67, OscillatorType::SynthChip, 0.125f},
-    {1.25f, 71, OscillatorType::SynthChip, 0.125f},
-    {1.375f, 76, OscillatorType::SynthChip, 0.125f},
-    {1.5f, 71, OscillatorType::SynthChip, 0.125f},
-    {1.625f, 67, OscillatorType::SynthChip, 0.125f},
-    {1.75f, 64, OscillatorType::SynthChip, 0.125f},
-    {1.875f, 67, OscillatorType::SynthChip, 0.125f},
-    {2.0f, 67, OscillatorType::SynthChip, 0.125f},   // G4
-    {2.125f, 70, OscillatorType::SynthChip, 0.125f}, // Bb4
-    {2.25f, 74, OscillatorType::SynthChip, 0.125f},  // D5
-    {2.375f, 79, OscillatorType::SynthChip, 0.125f}, // G5
-    {2.5f, 74, OscillatorType::SynthChip, 0.125f},
-    {2.625f, 70, OscillatorType::SynthChip, 0.125f},
-    {2.75f, 67, OscillatorType::SynthChip, 0.125f},
-    {2.875f, 70, OscillatorType::SynthChip, 0.125f},
-    {3.0f, 69, OscillatorType::SynthChip, 0.125f},   // A4
-    {3.125f, 72, OscillatorType::SynthChip, 0.125f}, // C5
-    {3.25f, 76, OscillatorType::SynthChip, 0.125f},  // E5
-    {3.375f, 81, OscillatorType::SynthChip, 0.125f}, // A5
-    {3.5f, 76, OscillatorType::SynthChip, 0.125f},
-    {3.625f, 72, OscillatorType::SynthChip, 0.125f},
-    {3.75f, 69, OscillatorType::SynthChip, 0.125f},
-    {3.875f, 72, OscillatorType::SynthChip, 0.125f},
-    // Repeat with variation
-    {4.0f, 64, OscillatorType::SynthChip, 0.125f},
-    {4.125f, 67, OscillatorType::SynthChip, 0.125f},
-    {4.25f, 71, OscillatorType::SynthChip, 0.125f},
-    {4.375f, 76, OscillatorType::SynthChip, 0.125f},
-    {4.5f, 79, OscillatorType::SynthChip, 0.125f},
-    {4.625f, 76, OscillatorType::SynthChip, 0.125f},
-    {4.75f, 71, OscillatorType::SynthChip, 0.125f},
-    {4.875f, 67, OscillatorType::SynthChip, 0.125f},
-    {5.0f, 64, OscillatorType::SynthChip, 0.125f},
-    {5.125f, 67, OscillatorType::SynthChip, 0.125f},
-    {5.25f, 71, OscillatorType::SynthChip, 0.125f},
-    {5.375f, 76, OscillatorType::SynthChip, 0.125f},
-    {5.5f, 79, OscillatorType::SynthChip, 0.125f},
-    {5.625f, 83, OscillatorType::SynthChip, 0.125f},
-    {5.75f, 79, OscillatorType::SynthChip, 0.125f},
-    {5.875f, 76, OscillatorType::SynthChip, 0.125f},
-    {6.0f, 71, OscillatorType::SynthChip, 0.5f},
-    {6.5f, 74, OscillatorType::SynthChip, 0.5f},
-    {7.0f, 76, OscillatorType::SynthChip, 0.5f},
-    {7.5f, 74, OscillatorType::SynthChip, 0.5f},
-};
-
-// Chiptune Track 3: "Victory Theme" - Triumphant fanfare
-static const TrackNote g_ChiptuneVictory[] = {
-    // === DRUMS ===
-    {0.0f, 36, OscillatorType::Kick, 0.25f},
-    {1.0f, 38, OscillatorType::Snare, 0.25f}, {1.5f, 38, OscillatorType::Snare, 0.125f},
-    {2.0f, 36, OscillatorType::Kick, 0.25f}, {2.5f, 36, OscillatorType::Kick, 0.125f},
-    {3.0f, 38, OscillatorType::Snare, 0.25f},
-    {4.0f, 36, OscillatorType::Kick, 0.25f},
-    {5.0f, 38, OscillatorType::Snare, 0.25f}, {5.5f, 38, OscillatorType::Snare, 0.125f},
-    {6.0f, 38, OscillatorType::Snare, 0.125f}, {6.25f, 38, OscillatorType::Snare, 0.125f},
-    {6.5f, 38, OscillatorType::Snare, 0.125f}, {6.75f, 38, OscillatorType::Snare, 0.125f},
-    {7.0f, 49, OscillatorType::Crash, 1.0f},
-    // === BASS (triumphant) ===
-    {0.0f, 48, OscillatorType::Triangle, 1.0f},  // C3
-    {1.0f, 48, OscillatorType::Triangle, 1.0f},
-    {2.0f, 53, OscillatorType::Triangle, 1.0f},  // F3
-    {3.0f, 55, OscillatorType::Triangle, 1.0f},  // G3
-    {4.0f, 48, OscillatorType::Triangle, 1.0f},  // C3
-    {5.0f, 55, OscillatorType::Triangle, 1.0f},  // G3
-    {6.0f, 53, OscillatorType::Triangle, 1.0f},  // F3
-    {7.0f, 48, OscillatorType::Triangle, 1.0f},  // C3
-    // === MELODY (fanfare) ===
-    {0.0f, 72, OscillatorType::SynthChip, 0.5f},   // C5
-    {0.5f, 72, OscillatorType::SynthChip, 0.25f},
-    {0.75f, 74, OscillatorType::SynthChip, 0.25f}, // D5
-    {1.0f, 76, OscillatorType::SynthChip, 1.0f},   // E5
-    {2.0f, 77, OscillatorType::SynthChip, 0.5f},   // F5
-    {2.5f, 79, OscillatorType::SynthChip, 0.5f},   // G5
-    {3.0f, 84, OscillatorType::SynthChip, 1.0f},   // C6
-    {4.0f, 84, OscillatorType::SynthChip, 0.25f},  // C6
-    {4.25f, 83, OscillatorType::SynthChip, 0.25f}, // B5
-    {4.5f, 84, OscillatorType::SynthChip, 0.25f},  // C6
-    {4.75f, 86, OscillatorType::SynthChip, 0.25f}, // D6
-    {5.0f, 88, OscillatorType::SynthChip, 1.0f},   // E6
-    {6.0f, 91, OscillatorType::SynthChip, 0.5f},   // G6
-    {6.5f, 88, OscillatorType::SynthChip, 0.5f},   // E6
-    {7.0f, 84, OscillatorType::SynthChip, 1.0f},   // C6
-    // === HARMONY ===
-    {0.0f, 60, OscillatorType::Pulse, 0.5f},   // C4
-    {0.5f, 60, OscillatorType::Pulse, 0.5f},
-    {1.0f, 64, OscillatorType::Pulse, 1.0f},   // E4
-    {2.0f, 65, OscillatorType::Pulse, 0.5f},   // F4
-    {2.5f, 67, OscillatorType::Pulse, 0.5f},   // G4
-    {3.0f, 72, OscillatorType::Pulse, 1.0f},   // C5
-    {4.0f, 72, OscillatorType::Pulse, 0.5f},
-    {4.5f, 72, OscillatorType::Pulse, 0.5f},
-    {5.0f, 76, OscillatorType::Pulse, 1.0f},   // E5
-    {6.0f, 79, OscillatorType::Pulse, 0.5f},   // G5
-    {6.5f, 76, OscillatorType::Pulse, 0.5f},   // E5
-    {7.0f, 72, OscillatorType::Pulse, 1.0f},   // C5
-};
-
-// ===========================================
-// HIP HOP TRACKS
-// ===========================================
-
-// Hip Hop Track 1: "Boom Bap" - Classic 90s style
-static const TrackNote g_HipHopBoomBap[] = {
-    // === DRUMS (boom bap pattern) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.5f},
-    {0.75f, 42, OscillatorType::HiHat, 0.125f},
-    {1.0f, 38, OscillatorType::Snare808, 0.25f},
-    {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.25f, 36, OscillatorType::Kick808, 0.25f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f},
-    {3.0f, 38, OscillatorType::Snare808, 0.25f},
-    {3.5f, 42, OscillatorType::HiHat, 0.125f},
-    {4.0f, 36, OscillatorType::Kick808, 0.5f},
-    {4.75f, 42, OscillatorType::HiHat, 0.125f},
-    {5.0f, 38, OscillatorType::Snare808, 0.25f},
-    {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.25f, 36, OscillatorType::Kick808, 0.25f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f},
-    {7.0f, 38, OscillatorType::Snare808, 0.25f},
-    {7.5f, 42, OscillatorType::HiHatOpen, 0.25f},
-    // === BASS (deep 808 sub) ===
-    {0.0f, 33, OscillatorType::SubBass808, 2.0f},   // A1
-    {2.25f, 36, OscillatorType::SubBass808, 0.5f},  // C2
-    {3.0f, 33, OscillatorType::SubBass808, 1.0f},   // A1
-    {4.0f, 33, OscillatorType::SubBass808, 2.0f},   // A1
-    {6.25f, 38, OscillatorType::SubBass808, 0.5f},  // D2
-    {7.0f, 36, OscillatorType::SubBass808, 1.0f},   // C2
-    // === KEYS (lo-fi piano) ===
-    {0.0f, 57, OscillatorType::LoFiKeys, 0.5f},    // A3
-    {0.0f, 60, OscillatorType::LoFiKeys, 0.5f},    // C4
-    {0.0f, 64, OscillatorType::LoFiKeys, 0.5f},    // E4
-    {1.0f, 55, OscillatorType::LoFiKeys, 0.5f},    // G3
-    {1.0f, 59, OscillatorType::LoFiKeys, 0.5f},    // B3
-    {1.0f, 62, OscillatorType::LoFiKeys, 0.5f},    // D4
-    {2.0f, 53, OscillatorType::LoFiKeys, 0.5f},    // F3
-    {2.0f, 57, OscillatorType::LoFiKeys, 0.5f},    // A3
-    {2.0f, 60, OscillatorType::LoFiKeys, 0.5f},    // C4
-    {3.0f, 52, OscillatorType::LoFiKeys, 0.5f},    // E3
-    {3.0f, 55, OscillatorType::LoFiKeys, 0.5f},    // G3
-    {3.0f, 59, OscillatorType::LoFiKeys, 0.5f},    // B3
-    {4.0f, 57, OscillatorType::LoFiKeys, 0.5f},
-    {4.0f, 60, OscillatorType::LoFiKeys, 0.5f},
-    {4.0f, 64, OscillatorType::LoFiKeys, 0.5f},
-    {5.0f, 55, OscillatorType::LoFiKeys, 0.5f},
-    {5.0f, 59, OscillatorType::LoFiKeys, 0.5f},
-    {5.0f, 62, OscillatorType::LoFiKeys, 0.5f},
-    {6.0f, 53, OscillatorType::LoFiKeys, 0.5f},
-    {6.0f, 57, OscillatorType::LoFiKeys, 0.5f},
-    {6.0f, 60, OscillatorType::LoFiKeys, 0.5f},
-    {7.0f, 52, OscillatorType::LoFiKeys, 0.5f},
-    {7.0f, 55, OscillatorType::LoFiKeys, 0.5f},
-    {7.0f, 59, OscillatorType::LoFiKeys, 0.5f},
-};
-
-// Hip Hop Track 2: "Lo-Fi Chill" - Relaxed beats
-static const TrackNote g_HipHopLoFi[] = {
-    // === DRUMS (laid back) ===
-    {0.0f, 36, OscillatorType::KickSoft, 0.5f},
-    {1.0f, 42, OscillatorType::HiHat, 0.125f},
-    {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.0f, 38, OscillatorType::Snare808, 0.25f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f},
-    {3.0f, 42, OscillatorType::HiHat, 0.125f},
-    {3.5f, 42, OscillatorType::HiHat, 0.125f},
-    {4.0f, 36, OscillatorType::KickSoft, 0.5f},
-    {4.5f, 36, OscillatorType::KickSoft, 0.25f},
-    {5.0f, 42, OscillatorType::HiHat, 0.125f},
-    {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.0f, 38, OscillatorType::Snare808, 0.25f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f},
-    {7.0f, 42, OscillatorType::HiHat, 0.125f},
-    {7.5f, 42, OscillatorType::HiHatOpen, 0.25f},
-    // === BASS (mellow) ===
-    {0.0f, 41, OscillatorType::SynthBass, 1.5f},   // F2
-    {2.0f, 43, OscillatorType::SynthBass, 1.5f},   // G2
-    {4.0f, 45, OscillatorType::SynthBass, 1.5f},   // A2
-    {6.0f, 43, OscillatorType::SynthBass, 1.5f},   // G2
-    // === MELODY (jazzy) ===
-    {0.0f, 65, OscillatorType::LoFiKeys, 0.75f},   // F4
-    {1.0f, 68, OscillatorType::LoFiKeys, 0.5f},    // Ab4
-    {1.5f, 65, OscillatorType::LoFiKeys, 0.5f},    // F4
-    {2.0f, 67, OscillatorType::LoFiKeys, 1.0f},    // G4
-    {3.0f, 65, OscillatorType::LoFiKeys, 0.5f},    // F4
-    {3.5f, 63, OscillatorType::LoFiKeys, 0.5f},    // Eb4
-    {4.0f, 65, OscillatorType::LoFiKeys, 0.75f},   // F4
-    {5.0f, 70, OscillatorType::LoFiKeys, 0.5f},    // Bb4
-    {5.5f, 68, OscillatorType::LoFiKeys, 0.5f},    // Ab4
-    {6.0f, 67, OscillatorType::LoFiKeys, 1.0f},    // G4
-    {7.0f, 65, OscillatorType::LoFiKeys, 0.5f},    // F4
-    {7.5f, 63, OscillatorType::LoFiKeys, 0.5f},    // Eb4
-};
-
-// ===========================================
-// TRAP TRACKS
-// ===========================================
-
-// Trap Track 1: "808 Bounce" - Hard hitting
-static const TrackNote g_Trap808Bounce[] = {
-    // === DRUMS (trap pattern with rolls) ===
-    {0.0f, 36, OscillatorType::Kick808, 0.5f},
-    {0.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {0.375f, 42, OscillatorType::HiHat, 0.0625f},
-    {0.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {0.625f, 42, OscillatorType::HiHat, 0.0625f},
-    {0.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {0.875f, 42, OscillatorType::HiHat, 0.0625f},
-    {1.0f, 38, OscillatorType::Snare808, 0.25f},
-    {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.0f, 36, OscillatorType::Kick808, 0.25f},
-    {2.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {2.625f, 42, OscillatorType::HiHat, 0.0625f},
-    {2.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {2.875f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.0f, 38, OscillatorType::Snare808, 0.25f},
-    {3.25f, 36, OscillatorType::Kick808, 0.25f},
-    {3.5f, 42, OscillatorType::HiHat, 0.125f},
-    {3.75f, 42, OscillatorType::HiHat, 0.125f},
-    {4.0f, 36, OscillatorType::Kick808, 0.5f},
-    {4.25f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.375f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.625f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.875f, 42, OscillatorType::HiHat, 0.0625f},
-    {5.0f, 38, OscillatorType::Snare808, 0.25f},
-    {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.0f, 36, OscillatorType::Kick808, 0.25f},
-    {6.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {6.625f, 42, OscillatorType::HiHat, 0.0625f},
-    {6.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {6.875f, 42, OscillatorType::HiHat, 0.0625f},
-    {7.0f, 38, OscillatorType::Snare808, 0.25f},
-    {7.25f, 36, OscillatorType::Kick808, 0.25f},
-    {7.5f, 42, OscillatorType::HiHat, 0.125f},
-    {7.75f, 42, OscillatorType::HiHatOpen, 0.125f},
-    // === 808 BASS (sliding) ===
-    {0.0f, 29, OscillatorType::SubBass808, 2.0f},   // F1
-    {3.25f, 34, OscillatorType::SubBass808, 0.5f},  // Bb1
-    {4.0f, 29, OscillatorType::SubBass808, 2.0f},   // F1
-    {6.0f, 24, OscillatorType::SubBass808, 1.0f},   // C1
-    {7.25f, 31, OscillatorType::SubBass808, 0.5f},  // G1
-    // === LEAD (trap melody) ===
-    {0.0f, 77, OscillatorType::TrapLead, 0.5f},    // F5
-    {0.5f, 75, OscillatorType::TrapLead, 0.25f},   // Eb5
-    {0.75f, 72, OscillatorType::TrapLead, 0.25f},  // C5
-    {1.0f, 70, OscillatorType::TrapLead, 0.5f},    // Bb4
-    {2.0f, 72, OscillatorType::TrapLead, 0.5f},    // C5
-    {2.5f, 70, OscillatorType::TrapLead, 0.5f},    // Bb4
-    {3.0f, 65, OscillatorType::TrapLead, 1.0f},    // F4
-    {4.0f, 77, OscillatorType::TrapLead, 0.5f},    // F5
-    {4.5f, 79, OscillatorType::TrapLead, 0.25f},   // G5
-    {4.75f, 77, OscillatorType::TrapLead, 0.25f},  // F5
-    {5.0f, 75, OscillatorType::TrapLead, 0.5f},    // Eb5
-    {6.0f, 72, OscillatorType::TrapLead, 0.5f},    // C5
-    {6.5f, 70, OscillatorType::TrapLead, 0.5f},    // Bb4
-    {7.0f, 67, OscillatorType::TrapLead, 1.0f},    // G4
-};
-
-// Trap Track 2: "Dark Trap" - Moody atmosphere
-static const TrackNote g_TrapDark[] = {
-    // === DRUMS ===
-    {0.0f, 36, OscillatorType::Kick808, 0.5f},
-    {0.5f, 42, OscillatorType::HiHat, 0.125f},
-    {1.0f, 38, OscillatorType::Clap, 0.25f},
-    {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.0f, 36, OscillatorType::Kick808, 0.25f},
-    {2.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.0f, 38, OscillatorType::Clap, 0.25f},
-    {3.5f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.625f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.75f, 42, OscillatorType::HiHat, 0.0625f},
-    {3.875f, 42, OscillatorType::HiHat, 0.0625f},
-    {4.0f, 36, OscillatorType::Kick808, 0.5f},
-    {4.5f, 42, OscillatorType::HiHat, 0.125f},
-    {5.0f, 38, OscillatorType::Clap, 0.25f},
-    {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.0f, 36, OscillatorType::Kick808, 0.25f},
-    {6.25f, 36, OscillatorType::Kick808, 0.25f},
-    {6.5f, 42, OscillatorType::HiHat, 0.125f},
-    {7.0f, 38, OscillatorType::Clap, 0.25f},
-    {7.5f, 42, OscillatorType::HiHatOpen, 0.25f},
-    // === BASS ===
-    {0.0f, 28, OscillatorType::SubBass808, 2.0f},   // E1
-    {2.0f, 33, OscillatorType::SubBass808, 1.0f},   // A1
-    {3.0f, 31, OscillatorType::SubBass808, 1.0f},   // G1
-    {4.0f, 28, OscillatorType::SubBass808, 2.0f},   // E1
-    {6.0f, 26, OscillatorType::SubBass808, 1.0f},   // D1
-    {7.0f, 28, OscillatorType::SubBass808, 1.0f},   // E1
-    // === PAD (dark atmosphere) ===
-    {0.0f, 52, OscillatorType::SynthwavePad, 4.0f},  // E3
-    {0.0f, 55, OscillatorType::SynthwavePad, 4.0f},  // G3
-    {0.0f, 59, OscillatorType::SynthwavePad, 4.0f},  // B3
-    {4.0f, 50, OscillatorType::SynthwavePad, 4.0f},  // D3
-    {4.0f, 54, OscillatorType::SynthwavePad, 4.0f},  // F#3
-    {4.0f, 57, OscillatorType::SynthwavePad, 4.0f},  // A3
-    // === MELODY ===
-    {0.0f, 76, OscillatorType::TrapLead, 0.5f},    // E5
-    {0.5f, 74, OscillatorType::TrapLead, 0.5f},    // D5
-    {1.0f, 71, OscillatorType::TrapLead, 1.0f},    // B4
-    {2.0f, 69, OscillatorType::TrapLead, 0.5f},    // A4
-    {2.5f, 67, OscillatorType::TrapLead, 0.5f},    // G4
-    {3.0f, 64, OscillatorType::TrapLead, 1.0f},    // E4
-    {4.0f, 66, OscillatorType::TrapLead, 0.5f},    // F#4
-    {4.5f, 69, OscillatorType::TrapLead, 0.5f},    // A4
-    {5.0f, 71, OscillatorType::TrapLead, 1.0f},    // B4
-    {6.0f, 74, OscillatorType::TrapLead, 0.5f},    // D5
-    {6.5f, 71, OscillatorType::TrapLead, 0.5f},    // B4
-    {7.0f, 69, OscillatorType::TrapLead, 1.0f},    // A4
-};
-
-// ===========================================
-// HOUSE TRACKS
-// ===========================================
-
-// House Track 1: "Disco House" - Funky groovy
-static const TrackNote g_HouseDiscoHouse[] = {
-    // === DRUMS (4 on the floor with open hats) ===
-    {0.0f, 36, OscillatorType::Kick, 0.25f}, {1.0f, 36, OscillatorType::Kick, 0.25f},
-    {2.0f, 36, OscillatorType::Kick, 0.25f}, {3.0f, 36, OscillatorType::Kick, 0.25f},
-    {4.0f, 36, OscillatorType::Kick, 0.25f}, {5.0f, 36, OscillatorType::Kick, 0.25f},
-    {6.0f, 36, OscillatorType::Kick, 0.25f}, {7.0f, 36, OscillatorType::Kick, 0.25f},
-    // Claps on 2 and 4
-    {1.0f, 39, OscillatorType::Clap, 0.25f}, {3.0f, 39, OscillatorType::Clap, 0.25f},
-    {5.0f, 39, OscillatorType::Clap, 0.25f}, {7.0f, 39, OscillatorType::Clap, 0.25f},
-    // Open hats on offbeats
-    {0.5f, 46, OscillatorType::HiHatOpen, 0.25f}, {1.5f, 46, OscillatorType::HiHatOpen, 0.25f},
-    {2.5f, 46, OscillatorType::HiHatOpen, 0.25f}, {3.5f, 46, OscillatorType::HiHatOpen, 0.25f},
-    {4.5f, 46, OscillatorType::HiHatOpen, 0.25f}, {5.5f, 46, OscillatorType::HiHatOpen, 0.25f},
-    {6.5f, 46, OscillatorType::HiHatOpen, 0.25f}, {7.5f, 46, OscillatorType::HiHatOpen, 0.25f},
-    // === BASS (funky octave jumps) ===
-    {0.0f, 36, OscillatorType::SynthBass, 0.25f},  // C2
-    {0.25f, 48, OscillatorType::SynthBass, 0.125f}, // C3
-    {0.5f, 36, OscillatorType::SynthBass, 0.25f},
-    {0.75f, 48, OscillatorType::SynthBass, 0.125f},
-    {1.0f, 36, OscillatorType::SynthBass, 0.25f},
-    {1.25f, 48, OscillatorType::SynthBass, 0.125f},
-    {1.5f, 38, OscillatorType::SynthBass, 0.25f},  // D2
-    {1.75f, 50, OscillatorType::SynthBass, 0.125f}, // D3
-    {2.0f, 41, OscillatorType::SynthBass, 0.25f},  // F2
-    {2.25f, 53, OscillatorType::SynthBass, 0.125f}, // F3
-    {2.5f, 41, OscillatorType::SynthBass, 0.25f},
-    {2.75f, 53, OscillatorType::SynthBass, 0.125f},
-    {3.0f, 41, OscillatorType::SynthBass, 0.25f},
-    {3.25f, 53, OscillatorType::SynthBass, 0.125f},
-    {3.5f, 43, OscillatorType::SynthBass, 0.25f},  // G2
-    {3.75f, 55, OscillatorType::SynthBass, 0.125f}, // G3
-    {4.0f, 36, OscillatorType::SynthBass, 0.25f},
-    {4.25f, 48, OscillatorType::SynthBass, 0.125f},
-    {4.5f, 36, OscillatorType::SynthBass, 0.25f},
-    {4.75f, 48, OscillatorType::SynthBass, 0.125f},
-    {5.0f, 36, OscillatorType::SynthBass, 0.25f},
-    {5.25f, 48, OscillatorType::SynthBass, 0.125f},
-    {5.5f, 38, OscillatorType::SynthBass, 0.25f},
-    {5.75f, 50, OscillatorType::SynthBass, 0.125f},
-    {6.0f, 41, OscillatorType::SynthBass, 0.25f},
-    {6.25f, 53, OscillatorType::SynthBass, 0.125f},
-    {6.5f, 41, OscillatorType::SynthBass, 0.25f},
-    {6.75f, 53, OscillatorType::SynthBass, 0.125f},
-    {7.0f, 43, OscillatorType::SynthBass, 0.25f},
-    {7.25f, 55, OscillatorType::SynthBass, 0.125f},
-    {7.5f, 41, OscillatorType::SynthBass, 0.25f},
-    {7.75f, 53, OscillatorType::SynthBass, 0.125f},
-    // === CHORDS (stabby) ===
-    {0.0f, 60, OscillatorType::SynthwaveChord, 0.25f},  // Cm
-    {0.0f, 63, OscillatorType::SynthwaveChord, 0.25f},
-    {0.0f, 67, OscillatorType::SynthwaveChord, 0.25f},
-    {0.5f, 60, OscillatorType::SynthwaveChord, 0.25f},
-    {0.5f, 63, OscillatorType::SynthwaveChord, 0.25f},
-    {0.5f, 67, OscillatorType::SynthwaveChord, 0.25f},
-    {2.0f, 65, OscillatorType::SynthwaveChord, 0.25f},  // Fm
-    {2.0f, 68, OscillatorType::SynthwaveChord, 0.25f},
-    {2.0f, 72, OscillatorType::SynthwaveChord, 0.25f},
-    {2.5f, 65, OscillatorType::SynthwaveChord, 0.25f},
-    {2.5f, 68, OscillatorType::SynthwaveChord, 0.25f},
-    {2.5f, 72, OscillatorType::SynthwaveChord, 0.25f},
-    {4.0f, 60, OscillatorType::SynthwaveChord, 0.25f},  // Cm
-    {4.0f, 63, OscillatorType::SynthwaveChord, 0.25f},
-    {4.0f, 67, OscillatorType::SynthwaveChord, 0.25f},
-    {4.5f, 60, OscillatorType::SynthwaveChord, 0.25f},
-    {4.5f, 63, OscillatorType::SynthwaveChord, 0.25f},
-    {4.5f, 67, OscillatorType::SynthwaveChord, 0.25f},
-    {6.0f, 67, OscillatorType::SynthwaveChord, 0.25f},  // G
-    {6.0f, 71, OscillatorType::SynthwaveChord, 0.25f},
-    {6.0f, 74, OscillatorType::SynthwaveChord, 0.25f},
-    {6.5f, 67, OscillatorType::SynthwaveChord, 0.25f},
-    {6.5f, 71, OscillatorType::SynthwaveChord, 0.25f},
-    {6.5f, 74, OscillatorType::SynthwaveChord, 0.25f},
-};
-
-// House Track 2: "Deep House" - Moody and deep
-static const TrackNote g_HouseDeepHouse[] = {
-    // === DRUMS ===
-    {0.0f, 36, OscillatorType::KickSoft, 0.25f}, {1.0f, 36, OscillatorType::KickSoft, 0.25f},
-    {2.0f, 36, OscillatorType::KickSoft, 0.25f}, {3.0f, 36, OscillatorType::KickSoft, 0.25f},
-    {4.0f, 36, OscillatorType::KickSoft, 0.25f}, {5.0f, 36, OscillatorType::KickSoft, 0.25f},
-    {6.0f, 36, OscillatorType::KickSoft, 0.25f}, {7.0f, 36, OscillatorType::KickSoft, 0.25f},
-    // Rim on 2 and 4
-    {1.0f, 37, OscillatorType::SnareRim, 0.125f}, {3.0f, 37, OscillatorType::SnareRim, 0.125f},
-    {5.0f, 37, OscillatorType::SnareRim, 0.125f}, {7.0f, 37, OscillatorType::SnareRim, 0.125f},
-    // Shaker
-    {0.5f, 70, OscillatorType::Maracas, 0.125f}, {1.5f, 70, OscillatorType::Maracas, 0.125f},
-    {2.5f, 70, OscillatorType::Maracas, 0.125f}, {3.5f, 70, OscillatorType::Maracas, 0.125f},
-    {4.5f, 70, OscillatorType::Maracas, 0.125f}, {5.5f, 70, OscillatorType::Maracas, 0.125f},
-    {6.5f, 70, OscillatorType::Maracas, 0.125f}, {7.5f, 70, OscillatorType::Maracas, 0.125f},
-    // === BASS (deep and minimal) ===
-    {0.0f, 33, OscillatorType::SynthBass, 2.0f},   // A1
-    {2.0f, 36, OscillatorType::SynthBass, 2.0f},   // C2
-    {4.0f, 33, OscillatorType::SynthBass, 2.0f},   // A1
-    {6.0f, 31, OscillatorType::SynthBass, 2.0f},   // G1
-    // === PAD (atmospheric) ===
-    {0.0f, 57, OscillatorType::SynthPad, 4.0f},    // Am
-    {0.0f, 60, OscillatorType::SynthPad, 4.0f},
-    {0.0f, 64, OscillatorType::SynthPad, 4.0f},
-    {4.0f, 55, OscillatorType::SynthPad, 4.0f},    // Gmaj7
-    {4.0f, 59, OscillatorType::SynthPad, 4.0f},
-    {4.0f, 62, OscillatorType::SynthPad, 4.0f},
-    {4.0f, 66, OscillatorType::SynthPad, 4.0f},
-    // === MELODY (sparse) ===
-    {0.0f, 69, OscillatorType::SynthLead, 0.5f},   // A4
-    {2.0f, 72, OscillatorType::SynthLead, 0.5f},   // C5
-    {4.0f, 71, OscillatorType::SynthLead, 0.5f},   // B4
-    {4.5f, 69, OscillatorType::SynthLead, 0.5f},   // A4
-    {6.0f, 67, OscillatorType::SynthLead, 1.0f},   // G4
-};
-
-// =============================================================================
-// REGGAETON SAMPLE TRACKS - Dembow rhythm at ~95 BPM
-// =============================================================================
-
-// Reggaeton Track 1: "Perreo" - Classic dembow beat
-static const TrackNote g_ReggaetonPerreo[] = {
-    // === DEMBOW DRUMS (8 beats, classic kick-snare pattern) ===
-    // Kick on 1, 2.5, 5, 6.5 (boom-ka pattern)
-    {0.0f, 36, OscillatorType::Dembow808, 0.25f}, {2.5f, 36, OscillatorType::Dembow808, 0.25f},
-    {4.0f, 36, OscillatorType::Dembow808, 0.25f}, {6.5f, 36, OscillatorType::Dembow808, 0.25f},
-    // Snare on 2, 4, 6, 8 (the backbeat)
-    {1.0f, 38, OscillatorType::Snare808, 0.125f}, {3.0f, 38, OscillatorType::Snare808, 0.125f},
-    {5.0f, 38, OscillatorType::Snare808, 0.125f}, {7.0f, 38, OscillatorType::Snare808, 0.125f},
-    // Guira (scraped metal) on every 8th note
-    {0.0f, 60, OscillatorType::Guira, 0.125f}, {0.5f, 60, OscillatorType::Guira, 0.125f},
-    {1.0f, 60, OscillatorType::Guira, 0.125f}, {1.5f, 60, OscillatorType::Guira, 0.125f},
-    {2.0f, 60, OscillatorType::Guira, 0.125f}, {2.5f, 60, OscillatorType::Guira, 0.125f},
-    {3.0f, 60, OscillatorType::Guira, 0.125f}, {3.5f, 60, OscillatorType::Guira, 0.125f},
-    {4.0f, 60, OscillatorType::Guira, 0.125f}, {4.5f, 60, OscillatorType::Guira, 0.125f},
-    {5.0f, 60, OscillatorType::Guira, 0.125f}, {5.5f, 60, OscillatorType::Guira, 0.125f},
-    {6.0f, 60, OscillatorType::Guira, 0.125f}, {6.5f, 60, OscillatorType::Guira, 0.125f},
-    {7.0f, 60, OscillatorType::Guira, 0.125f}, {7.5f, 60, OscillatorType::Guira, 0.125f},
-    // === BASS (punchy reggaeton bass following the dembow) ===
-    {0.0f, 33, OscillatorType::ReggaetonBass, 0.5f},   // A1
-    {2.5f, 33, OscillatorType::ReggaetonBass, 0.5f},   // A1
-    {4.0f, 36, OscillatorType::ReggaetonBass, 0.5f},   // C2
-    {6.5f, 36, OscillatorType::ReggaetonBass, 0.5f},   // C2
-    // === BRASS STABS (on offbeats for hooks) ===
-    {1.5f, 69, OscillatorType::LatinBrass, 0.25f},     // A4
-    {5.5f, 69, OscillatorType::LatinBrass, 0.25f},     // A4
-    // === MELODY (simple Latin hook) ===
-    {0.0f, 72, OscillatorType::SynthLead, 0.5f},       // C5
-    {0.75f, 71, OscillatorType::SynthLead, 0.25f},     // B4
-    {1.25f, 69, OscillatorType::SynthLead, 0.5f},      // A4
-    {4.0f, 72, OscillatorType::SynthLead, 0.5f},       // C5
-    {4.75f, 74, OscillatorType::SynthLead, 0.25f},     // D5
-    {5.25f, 72, OscillatorType::SynthLead, 0.75f},     // C5
-};
-
-// Reggaeton Track 2: "Gasolina" - Energetic party dembow
-static const TrackNote g_ReggaetonGasolina[] = {
-    // === DRUMS (high energy dembow with extra hi-hats) ===
-    // Kick pattern (more aggressive)
-    {0.0f, 36, OscillatorType::Dembow808, 0.25f}, {0.75f, 36, OscillatorType::Dembow808, 0.125f},
-    {2.5f, 36, OscillatorType::Dembow808, 0.25f},
-    {4.0f, 36, OscillatorType::Dembow808, 0.25f}, {4.75f, 36, OscillatorType::Dembow808, 0.125f},
-    {6.5f, 36, OscillatorType::Dembow808, 0.25f},
-    // Snare/clap combo
-    {1.0f, 39, OscillatorType::Clap, 0.125f}, {3.0f, 39, OscillatorType::Clap, 0.125f},
-    {5.0f, 39, OscillatorType::Clap, 0.125f}, {7.0f, 39, OscillatorType::Clap, 0.125f},
-    // Open hi-hat on &s
-    {0.5f, 46, OscillatorType::HiHatOpen, 0.125f}, {2.5f, 46, OscillatorType::HiHatOpen, 0.125f},
-    {4.5f, 46, OscillatorType::HiHatOpen, 0.125f}, {6.5f, 46, OscillatorType::HiHatOpen, 0.125f},
-    // Bongo fills
-    {1.75f, 60, OscillatorType::Bongo, 0.125f}, {3.75f, 60, OscillatorType::Bongo, 0.125f},
-    {5.75f, 60, OscillatorType::Bongo, 0.125f}, {7.75f, 60, OscillatorType::Bongo, 0.125f},
-    // Timbale accent
-    {3.5f, 60, OscillatorType::Timbale, 0.125f}, {7.5f, 60, OscillatorType::Timbale, 0.125f},
-    // === BASS (syncopated reggaeton bass) ===
-    {0.0f, 36, OscillatorType::ReggaetonBass, 0.375f},   // C2
-    {2.5f, 38, OscillatorType::ReggaetonBass, 0.375f},   // D2
-    {4.0f, 33, OscillatorType::ReggaetonBass, 0.375f},   // A1
-    {6.5f, 35, OscillatorType::ReggaetonBass, 0.375f},   // B1
-    // === BRASS (energetic stabs) ===
-    {0.0f, 60, OscillatorType::LatinBrass, 0.25f},       // C4
-    {0.0f, 64, OscillatorType::LatinBrass, 0.25f},       // E4
-    {0.0f, 67, OscillatorType::LatinBrass, 0.25f},       // G4
-    {3.0f, 62, OscillatorType::LatinBrass, 0.25f},       // D4
-    {3.0f, 65, OscillatorType::LatinBrass, 0.25f},       // F4
-    {3.0f, 69, OscillatorType::LatinBrass, 0.25f},       // A4
-    // === MELODY (catchy hook) ===
-    {0.5f, 72, OscillatorType::SynthwaveLead, 0.5f},     // C5
-    {1.25f, 74, OscillatorType::SynthwaveLead, 0.25f},   // D5
-    {1.75f, 76, OscillatorType::SynthwaveLead, 0.75f},   // E5
-    {4.5f, 79, OscillatorType::SynthwaveLead, 0.5f},     // G5
-    {5.25f, 77, OscillatorType::SynthwaveLead, 0.25f},   // F5
-    {5.75f, 76, OscillatorType::SynthwaveLead, 0.75f},   // E5
-};
-
-// Reggaeton Track 3: "Noche" - Dark/moody reggaeton
-static const TrackNote g_ReggaetonNoche[] = {
-    // === DRUMS (slower, moodier dembow) ===
-    // Deep kick
-    {0.0f, 36, OscillatorType::Kick808, 0.5f}, {2.5f, 36, OscillatorType::Kick808, 0.5f},
-    {4.0f, 36, OscillatorType::Kick808, 0.5f}, {6.5f, 36, OscillatorType::Kick808, 0.5f},
-    // Snare (softer)
-    {1.0f, 38, OscillatorType::SnareRim, 0.125f}, {3.0f, 38, OscillatorType::SnareRim, 0.125f},
-    {5.0f, 38, OscillatorType::SnareRim, 0.125f}, {7.0f, 38, OscillatorType::SnareRim, 0.125f},
-    // Closed hi-hat pattern
-    {0.0f, 42, OscillatorType::HiHat, 0.125f}, {0.5f, 42, OscillatorType::HiHat, 0.125f},
-    {1.0f, 42, OscillatorType::HiHat, 0.125f}, {1.5f, 42, OscillatorType::HiHat, 0.125f},
-    {2.0f, 42, OscillatorType::HiHat, 0.125f}, {2.5f, 42, OscillatorType::HiHat, 0.125f},
-    {3.0f, 42, OscillatorType::HiHat, 0.125f}, {3.5f, 42, OscillatorType::HiHat, 0.125f},
-    {4.0f, 42, OscillatorType::HiHat, 0.125f}, {4.5f, 42, OscillatorType::HiHat, 0.125f},
-    {5.0f, 42, OscillatorType::HiHat, 0.125f}, {5.5f, 42, OscillatorType::HiHat, 0.125f},
-    {6.0f, 42, OscillatorType::HiHat, 0.125f}, {6.5f, 42, OscillatorType::HiHat, 0.125f},
-    {7.0f, 42, OscillatorType::HiHat, 0.125f}, {7.5f, 42, OscillatorType::HiHat, 0.125f},
-    // Conga accent
-    {1.5f, 63, OscillatorType::Conga, 0.25f}, {5.5f, 63, OscillatorType::Conga, 0.25f},
-    // === BASS (dark, minimal) ===
-    {0.0f, 33, OscillatorType::ReggaetonBass, 1.0f},     // A1
-    {2.5f, 33, OscillatorType::ReggaetonBass, 0.5f},     // A1
-    {4.0f, 31, OscillatorType::ReggaetonBass, 1.0f},     // G1
-    {6.5f, 31, OscillatorType::ReggaetonBass, 0.5f},     // G1
-    // === PAD (dark atmosphere) ===
-    {0.0f, 57, OscillatorType::SynthwavePad, 4.0f},      // Am chord
-    {0.0f, 60, OscillatorType::SynthwavePad, 4.0f},
-    {0.0f, 64, OscillatorType::SynthwavePad, 4.0f},
-    {4.0f, 55, OscillatorType::SynthwavePad, 4.0f},      // Gm chord
-    {4.0f, 58, OscillatorType::SynthwavePad, 4.0f},
-    {4.0f, 62, OscillatorType::SynthwavePad, 4.0f},
-    // === MELODY (haunting, sparse) ===
-    {0.0f, 69, OscillatorType::SynthBell, 1.0f},         // A4
-    {2.0f, 67, OscillatorType::SynthBell, 0.5f},         // G4
-    {3.0f, 65, OscillatorType::SynthBell, 1.0f},         // F4
-    {6.0f, 64, OscillatorType::SynthBell, 2.0f},         // E4
-};
-
-// Array of all sample tracks
-// fixedPosition=true means notes are placed at their exact beat positions (starting from beat 0)
-static const SampleTrack g_SampleTracks[] = {
-    // Synthwave (8 tracks)
-    {"Midnight Drive", "Synthwave", "Driving 80s retrowave", g_SynthwaveMidnightDrive, sizeof(g_SynthwaveMidnightDrive)/sizeof(TrackNote), 16, 110, true},
-    {"Neon Dreams", "Synthwave", "Dreamy arpeggiated", g_SynthwaveNeonDreams, sizeof(g_SynthwaveNeonDreams)/sizeof(TrackNote), 16, 100, true},
-    {"Retro Racer", "Synthwave", "Energetic driving", g_SynthwaveRetroRacer, sizeof(g_SynthwaveRetroRacer)/sizeof(TrackNote), 16, 118, true},
-    {"Nightcall", "Synthwave", "Kavinsky style pulsing", g_SynthwaveNightcall, sizeof(g_SynthwaveNightcall)/sizeof(TrackNote), 16, 98, true},
-    {"Turbo Killer", "Synthwave", "Aggressive Carpenter Brut", g_SynthwaveTurboKiller, sizeof(g_SynthwaveTurboKiller)/sizeof(TrackNote), 8, 128, true},
-    {"Endless Summer", "Synthwave", "The Midnight emotional", g_SynthwaveEndlessSummer, sizeof(g_SynthwaveEndlessSummer)/sizeof(TrackNote), 16, 105, true},
-    {"Tech Noir", "Synthwave", "Gunship dark cyberpunk", g_SynthwaveTechNoir, sizeof(g_SynthwaveTechNoir)/sizeof(TrackNote), 16, 108, true},
-    {"A Real Hero", "Synthwave", "Drive soundtrack emotional", g_SynthwaveRealHero, sizeof(g_SynthwaveRealHero)/sizeof(TrackNote), 16, 85, true},
-    // Techno
-    {"Machine", "Techno", "Acid techno groove", g_TechnoMachine, sizeof(g_TechnoMachine)/sizeof(TrackNote), 16, 130, true},
-    {"Dark Factory", "Techno", "Hard dark techno", g_TechnoDarkFactory, sizeof(g_TechnoDarkFactory)/sizeof(TrackNote), 16, 135, true},
-    {"Underground", "Techno", "Rolling hypnotic", g_TechnoUnderground, sizeof(g_TechnoUnderground)/sizeof(TrackNote), 8, 126, true},
-    // Chiptune
-    {"Level 1", "Chiptune", "Bouncy game theme", g_ChiptuneLevel1, sizeof(g_ChiptuneLevel1)/sizeof(TrackNote), 8, 140, true},
-    {"Boss Fight", "Chiptune", "Intense battle music", g_ChiptuneBossFight, sizeof(g_ChiptuneBossFight)/sizeof(TrackNote), 8, 160, true},
-    {"Victory Theme", "Chiptune", "Triumphant fanfare", g_ChiptuneVictory, sizeof(g_ChiptuneVictory)/sizeof(TrackNote), 8, 120, true},
-    // Hip Hop
-    {"Boom Bap", "Hip Hop", "Classic 90s beat", g_HipHopBoomBap, sizeof(g_HipHopBoomBap)/sizeof(TrackNote), 8, 90, true},
-    {"Lo-Fi Chill", "Hip Hop", "Relaxed lo-fi", g_HipHopLoFi, sizeof(g_HipHopLoFi)/sizeof(TrackNote), 8, 85, true},
-    // Trap
-    {"808 Bounce", "Trap", "Hard hitting 808", g_Trap808Bounce, sizeof(g_Trap808Bounce)/sizeof(TrackNote), 8, 140, true},
-    {"Dark Trap", "Trap", "Moody atmosphere", g_TrapDark, sizeof(g_TrapDark)/sizeof(TrackNote), 8, 135, true},
-    // House
-    {"Disco House", "House", "Funky groovy", g_HouseDiscoHouse, sizeof(g_HouseDiscoHouse)/sizeof(TrackNote), 8, 124, true},
-    {"Deep House", "House", "Moody and deep", g_HouseDeepHouse, sizeof(g_HouseDeepHouse)/sizeof(TrackNote), 8, 122, true},
-    // Reggaeton
-    {"Perreo", "Reggaeton", "Classic dembow beat", g_ReggaetonPerreo, sizeof(g_ReggaetonPerreo)/sizeof(TrackNote), 8, 95, true},
-    {"Gasolina", "Reggaeton", "Energetic party dembow", g_ReggaetonGasolina, sizeof(g_ReggaetonGasolina)/sizeof(TrackNote), 8, 100, true},
-    {"Noche", "Reggaeton", "Dark moody reggaeton", g_ReggaetonNoche, sizeof(g_ReggaetonNoche)/sizeof(TrackNote), 8, 90, true},
-};
-static constexpr int g_NumSampleTracks = sizeof(g_SampleTracks) / sizeof(g_SampleTracks[0]);
-
 // Sample track preview state
 static bool g_IsSampleTrackPreviewing = false;
 static int g_PreviewSampleTrackIndex = -1;
@@ -3414,6 +1972,15 @@ inline void DrawThemeBackground(Theme theme, float deltaTime) {
 // ============================================================================
 // Transport Bar
 // ============================================================================
+// Oversampling factor picker for a nonlinear stage
+inline void OversamplingCombo(const char* label, Oversampling& factor) {
+    const char* factors[] = {"Off", "2x", "4x", "8x"};
+    int index = static_cast<int>(factor);
+    ImGui::Combo(label, &index, factors, IM_ARRAYSIZE(factors));
+    factor = static_cast<Oversampling>(index);
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("Run at a higher rate to cut aliasing (costs CPU)");
+}
+
 inline void DrawTransportBar(Sequencer& seq, Project& project, PlaybackState& state, UIState& ui) {
     // Set initial window position on first use (top-left)
     ImGui::SetNextWindowPos(ImVec2(10, 35), ImGuiCond_FirstUseEver);
@@ -3450,6 +2017,7 @@ inline void DrawTransportBar(Sequencer& seq, Project& project, PlaybackState& st
                 float decayTime = getDrumDecayTime(note.oscillatorType);
                 note.duration = decayTime * (project.bpm / 60.0f);
             }
+            pat.touch();
         }
     }
 
@@ -3473,6 +2041,9 @@ inline void DrawTransportBar(Sequencer& seq, Project& project, PlaybackState& st
     if (ImGui::SliderFloat("##master", &masterPct, 0.0f, 100.0f, "%.0f%%")) {
         project.masterVolume = masterPct / 100.0f;
     }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(70);
+    OversamplingCombo("Clip oversampling", project.masterOversampling);
 
     ImGui::Separator();
 
@@ -3658,6 +2229,11 @@ inline void DrawFileMenu(Project& project, UIState& ui, Sequencer& seq) {
         float durationSec = exportDuration * 60.0f / project.bpm;
         ImGui::Text("Duration: %.1f seconds at %.0f BPM", durationSec, project.bpm);
 
+        static int wavFormat = 0;
+        const char* wavFormats[] = {"16-bit PCM", "24-bit PCM", "32-bit Float"};
+        ImGui::SetNextItemWidth(150);
+        ImGui::Combo("Format", &wavFormat, wavFormats, 3);
+
         ImGui::Separator();
 
         if (ImGui::Button("Export", ImVec2(100, 0))) {
@@ -3665,7 +2241,10 @@ inline void DrawFileMenu(Project& project, UIState& ui, Sequencer& seq) {
                 "WAV Audio (*.wav)\0*.wav\0",
                 "wav");
             if (!path.empty()) {
-                if (exportWav(project, seq, path, exportDuration)) {
+                // Rendered on a copy, leaving the device's sequencer to the audio thread
+                Project exportProject = project;
+                auto exportSeq = makeExportSequencer(seq, exportProject);
+                if (exportWav(exportProject, *exportSeq, path, exportDuration, static_cast<SampleFormat>(wavFormat))) {
                     exportStatus = "Export successful!";
                 } else {
                     exportStatus = "Export failed!";
@@ -3734,7 +2313,9 @@ inline void DrawFileMenu(Project& project, UIState& ui, Sequencer& seq) {
                 "MP3 Audio (*.mp3)\0*.mp3\0",
                 "mp3");
             if (!path.empty()) {
-                if (exportMp3(project, seq, path, exportDuration, mp3Bitrate)) {
+                Project exportProject = project;
+                auto exportSeq = makeExportSequencer(seq, exportProject);
+                if (exportMp3(exportProject, *exportSeq, path, exportDuration, mp3Bitrate)) {
                     exportStatus = "MP3 export successful!";
                 } else {
                     exportStatus = "MP3 export failed!";
@@ -3808,7 +2389,9 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
     ImGui::Text("Pattern: %s", pattern.name.c_str());
     ImGui::SameLine();
     ImGui::SetNextItemWidth(60);
-    ImGui::DragInt("Length", &pattern.length, 1, 1, 9999);  // Essentially unlimited
+    if (ImGui::DragInt("Length", &pattern.length, 1, 1, 9999)) {  // Essentially unlimited
+        pattern.touch();
+    }
     if (ImGui::IsItemHovered()) ImGui::SetTooltip("Pattern length in beats (auto-extends as you add notes)");
 
     // Zoom controls
@@ -3922,6 +2505,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                 pattern.notes.push_back(newNote);
                 ui.selectedNoteIndices.push_back(static_cast<int>(pattern.notes.size()) - 1);
             }
+            pattern.touch();
             if (!ui.selectedNoteIndices.empty()) {
                 ui.selectedNoteIndex = ui.selectedNoteIndices[0];
             }
@@ -3954,6 +2538,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                 pattern.notes.erase(pattern.notes.begin() + idx);
             }
         }
+        pattern.touch();
 
         ui.selectedNoteIndex = -1;
         ui.selectedNoteIndices.clear();
@@ -3998,6 +2583,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
         ImGui::Separator();
         if (ImGui::Button("Yes, Clear All", ImVec2(120, 0))) {
             pattern.notes.clear();
+            pattern.touch();
             ui.selectedNoteIndex = -1;
             showClearConfirm = false;
             ImGui::CloseCurrentPopup();
@@ -4147,6 +2733,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                 t += stepSize;
                 noteIndex++;
             }
+            pattern.touch();
 
             if (!ui.selectedNoteIndices.empty()) {
                 ui.selectedNoteIndex = ui.selectedNoteIndices[0];
@@ -4199,11 +2786,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
     float effectiveCanvasHeight = canvasSize.y - scrollbarHeight;
 
     // Calculate dynamic grid width based on notes
-    float maxNoteEnd = static_cast<float>(pattern.length);
-    for (const Note& n : pattern.notes) {
-        float noteEnd = n.startTime + n.duration;
-        if (noteEnd > maxNoteEnd) maxNoteEnd = noteEnd;
-    }
+    float maxNoteEnd = std::max(static_cast<float>(pattern.length), pattern.metadata().endTime);
     // Add padding (4 beats) and round up to next measure
     float dynamicLength = std::ceil((maxNoteEnd + 4.0f) / project.beatsPerMeasure) * project.beatsPerMeasure;
     dynamicLength = std::max(dynamicLength, static_cast<float>(pattern.length));
@@ -4614,6 +3197,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                     pattern.notes.erase(pattern.notes.begin() + ui.selectedNoteIndex);
                     ui.selectedNoteIndex = -1;
                 }
+                pattern.touch();
             }
         }
 
@@ -4638,6 +3222,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
             if (g_UndoHistory.canUndo()) {
                 PatternSnapshot snapshot = g_UndoHistory.undo(pattern, ui.selectedPattern);
                 pattern.notes = snapshot.notes;
+                pattern.touch();
                 ui.selectedNoteIndex = -1;
                 ui.selectedNoteIndices.clear();
             }
@@ -4648,6 +3233,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
             if (g_UndoHistory.canRedo()) {
                 PatternSnapshot snapshot = g_UndoHistory.redo(pattern, ui.selectedPattern);
                 pattern.notes = snapshot.notes;
+                pattern.touch();
                 ui.selectedNoteIndex = -1;
                 ui.selectedNoteIndices.clear();
             }
@@ -4742,6 +3328,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                         pattern.notes.erase(pattern.notes.begin() + idx);
                     }
                 }
+                pattern.touch();
 
                 ui.selectedNoteIndex = -1;
                 ui.selectedNoteIndices.clear();
@@ -4796,6 +3383,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                 if (noteEnd > pattern.length) {
                     pattern.length = static_cast<int>(std::ceil(noteEnd / project.beatsPerMeasure)) * project.beatsPerMeasure;
                 }
+                pattern.touch();
             }
         }
         ImGui::EndDragDropTarget();
@@ -4870,6 +3458,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                         pattern.length = static_cast<int>(std::ceil(noteEnd / project.beatsPerMeasure)) * project.beatsPerMeasure;
                     }
                 }
+                pattern.touch();
 
                 // Select the first pasted note as primary
                 if (!ui.selectedNoteIndices.empty()) {
@@ -4923,6 +3512,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                         pattern.length = static_cast<int>(std::ceil(noteEnd / project.beatsPerMeasure)) * project.beatsPerMeasure;
                     }
                 }
+                pattern.touch();
 
                 // Select the first placed note as primary
                 if (!ui.selectedNoteIndices.empty()) {
@@ -4963,22 +3553,8 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                 // Clear selection and prepare to select placed notes
                 ui.selectedNoteIndices.clear();
 
-                // Get genre-specific effects and apply to channel config
-                GenreEffects genreFx = getGenreEffects(st.genre);
-                auto& channelConfig = project.channels[ui.selectedChannel];
-
                 // Store genre effects in channel config (applied by main loop)
-                channelConfig.reverbEnabled = genreFx.reverbEnabled;
-                channelConfig.reverbMix = genreFx.reverbMix;
-                channelConfig.reverbRoomSize = genreFx.reverbRoomSize;
-                channelConfig.reverbDamping = genreFx.reverbDamping;
-                channelConfig.chorusEnabled = genreFx.chorusEnabled;
-                channelConfig.chorusMix = genreFx.chorusMix;
-                channelConfig.chorusRate = genreFx.chorusRate;
-                channelConfig.delayEnabled = genreFx.delayEnabled;
-                channelConfig.delayMix = genreFx.delayMix;
-                channelConfig.delayTime = genreFx.delayTime;
-                channelConfig.delayFeedback = genreFx.delayFeedback;
+                applyGenreEffects(project, ui.selectedChannel, st.genre);
 
                 // Add all notes from the sample track
                 for (int j = 0; j < st.noteCount; ++j) {
@@ -5000,6 +3576,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                         pattern.length = static_cast<int>(std::ceil(noteEnd / project.beatsPerMeasure)) * project.beatsPerMeasure;
                     }
                 }
+                pattern.touch();
 
                 // Select the first placed note as primary
                 if (!ui.selectedNoteIndices.empty()) {
@@ -5130,6 +3707,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                                     pattern.length = static_cast<int>(std::ceil(noteEnd / project.beatsPerMeasure)) * project.beatsPerMeasure;
                                 }
                             }
+                            pattern.touch();
 
                             // Select root note and preview chord
                             if (!ui.selectedNoteIndices.empty()) {
@@ -5170,6 +3748,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                                 // Round up to next measure
                                 pattern.length = static_cast<int>(std::ceil(noteEnd / project.beatsPerMeasure)) * project.beatsPerMeasure;
                             }
+                            pattern.touch();
                         }
                     }
                     break;
@@ -5180,6 +3759,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                         g_UndoHistory.saveState(pattern, ui.selectedPattern);
 
                         pattern.notes.erase(pattern.notes.begin() + noteUnderCursor);
+                        pattern.touch();
                         if (ui.selectedNoteIndex == noteUnderCursor) {
                             ui.selectedNoteIndex = -1;
                         } else if (ui.selectedNoteIndex > noteUnderCursor) {
@@ -5216,8 +3796,11 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                 Note& note = pattern.notes[ui.selectedNoteIndex];
                 float newBeat = std::floor(hoveredBeat * 4.0f) / 4.0f;
                 int newPitch = std::clamp(hoveredNote, lowestNote, highestNote - 1);
-                note.startTime = std::max(0.0f, newBeat);
-                note.pitch = newPitch;
+                if (note.startTime != std::max(0.0f, newBeat) || note.pitch != newPitch) {
+                    note.startTime = std::max(0.0f, newBeat);
+                    note.pitch = newPitch;
+                    pattern.touch();
+                }
             }
             if (ui.isDraggingMultiple && !ui.selectedNoteIndices.empty()) {
                 // Multi-note drag - move all selected notes together
@@ -5239,6 +3822,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                         note.pitch = std::clamp(newPitch, lowestNote, highestNote - 1);
                     }
                 }
+                pattern.touch();
             }
             if (ui.isResizingNote && ui.selectedNoteIndex >= 0) {
                 Note& note = pattern.notes[ui.selectedNoteIndex];
@@ -5246,7 +3830,11 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                 if (!isDrumType(note.oscillatorType)) {
                     float deltaBeats = hoveredBeat - ui.dragStartBeat;
                     float newDuration = ui.dragStartDuration + deltaBeats;
-                    note.duration = std::max(0.0625f, std::floor(newDuration * 4.0f) / 4.0f);
+                    float snappedDuration = std::max(0.0625f, std::floor(newDuration * 4.0f) / 4.0f);
+                    if (note.duration != snappedDuration) {
+                        note.duration = snappedDuration;
+                        pattern.touch();
+                    }
                 }
             }
             // Handle multi-note resize
@@ -5265,6 +3853,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
                         }
                     }
                 }
+                pattern.touch();
             }
             // Update box selection end point
             if (ui.isBoxSelecting) {
@@ -5316,6 +3905,7 @@ inline void DrawPianoRoll(Project& project, UIState& ui, Sequencer& seq) {
         // Right click always deletes
         if (ImGui::IsMouseClicked(1) && noteUnderCursor >= 0) {
             pattern.notes.erase(pattern.notes.begin() + noteUnderCursor);
+            pattern.touch();
             if (ui.selectedNoteIndex == noteUnderCursor) {
                 ui.selectedNoteIndex = -1;
             } else if (ui.selectedNoteIndex > noteUnderCursor) {
@@ -5482,9 +4072,16 @@ inline void DrawTrackerView(Project& project, UIState& ui, Sequencer& seq) {
     }
 
     Pattern& pattern = project.patterns[ui.selectedPattern];
+    const PatternMetadata& meta = pattern.metadata();
 
     // Header
-    ImGui::Text("Pattern: %s  |  Length: %d steps", pattern.name.c_str(), pattern.length);
+    if (pattern.notes.empty()) {
+        ImGui::Text("Pattern: %s  |  Length: %d steps", pattern.name.c_str(), pattern.length);
+    } else {
+        ImGui::Text("Pattern: %s  |  Length: %d steps  |  %zu notes (%s - %s)",
+                    pattern.name.c_str(), pattern.length, pattern.notes.size(),
+                    noteToString(meta.lowestPitch).c_str(), noteToString(meta.highestPitch).c_str());
+    }
     ImGui::Separator();
 
     // Column headers
@@ -5520,20 +4117,15 @@ inline void DrawTrackerView(Project& project, UIState& ui, Sequencer& seq) {
         ImGui::Text("%02X", step);
 
         // Find notes at this step for each channel
+        std::span<const int> stepNotes = meta.notesAtStep(step);
         for (int ch = 0; ch < 8; ++ch) {
             ImGui::SameLine(80 + ch * 100);
 
-            // Find note at this step (simplified - notes are stored in pattern)
-            bool foundNote = false;
-            for (const auto& note : pattern.notes) {
-                if (static_cast<int>(note.startTime) == step) {
-                    // This is a simplification - in real tracker, notes are per-channel
-                    ImGui::Text("%s", noteToString(note.pitch).c_str());
-                    foundNote = true;
-                    break;
-                }
-            }
-            if (!foundNote) {
+            // First note at this step (simplified - notes are stored in pattern)
+            if (!stepNotes.empty()) {
+                // This is a simplification - in real tracker, notes are per-channel
+                ImGui::Text("%s", noteToString(pattern.notes[stepNotes[0]].pitch).c_str());
+            } else {
                 ImGui::TextDisabled("---");
             }
         }
@@ -5868,6 +4460,130 @@ inline void DrawArrangement(Project& project, UIState& ui, Sequencer& seq) {
 // ============================================================================
 // Mixer
 // ============================================================================
+// One row of the performance table: p50 / p99 / max in microseconds
+inline void DrawProfileRow(const char* name, const ProfileHistogram& histogram, float budgetUs,
+                           ImVec4 color = ImVec4(1.0f, 1.0f, 1.0f, 1.0f)) {
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::TextColored(color, "%s", name);
+
+    const float values[3] = {histogram.percentile(0.5f), histogram.percentile(0.99f), histogram.max()};
+    for (float us : values) {
+        ImGui::TableNextColumn();
+        // Anything over a tenth of the callback budget stands out
+        if (budgetUs > 0.0f && us > budgetUs * 0.1f) {
+            ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.3f, 1.0f), "%.1f", us);
+        } else {
+            ImGui::Text("%.1f", us);
+        }
+    }
+}
+
+// Audio thread load, xruns, and where the time goes
+inline void DrawPerformance(Project& project, Sequencer& seq) {
+    AudioProfiler& profiler = seq.profiler();
+    g_AudioProfile.update(profiler);
+
+    const bool open = ImGui::CollapsingHeader("Performance");
+    if (open != profiler.isDetailed()) {
+        // Start detailed histograms afresh rather than from a stale window
+        if (open) g_AudioProfile.clearDetailed();
+        profiler.setDetailed(open);
+    }
+    if (!open) return;
+
+    const uint64_t xruns = profiler.xruns();
+    ImGui::Text("Callback budget %.0f us   Load p50 %.0f%%  p99 %.0f%%  max %.0f%%",
+                g_AudioProfile.budgetUs, g_AudioProfile.load.percentile(0.5f),
+                g_AudioProfile.load.percentile(0.99f), g_AudioProfile.load.max());
+    ImGui::SameLine();
+    ImGui::TextColored(xruns > 0 ? ImVec4(1.0f, 0.4f, 0.4f, 1.0f) : ImVec4(0.5f, 1.0f, 0.5f, 1.0f),
+                       "  Xruns %llu / %llu", static_cast<unsigned long long>(xruns),
+                       static_cast<unsigned long long>(profiler.callbacks()));
+    ImGui::SameLine();
+    ImGui::Text("  Voices %d / %d", seq.getActiveVoices(), seq.voicePoolSize());
+
+    const ImGuiTableFlags flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+                                  ImGuiTableFlags_SizingFixedFit;
+    if (!ImGui::BeginTable("##profile", 4, flags)) return;
+
+    ImGui::TableSetupColumn("Stage (us)", ImGuiTableColumnFlags_WidthFixed, 160.0f);
+    ImGui::TableSetupColumn("p50", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+    ImGui::TableSetupColumn("p99", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+    ImGui::TableSetupColumn("max", ImGuiTableColumnFlags_WidthFixed, 60.0f);
+    ImGui::TableHeadersRow();
+
+    const float budget = g_AudioProfile.budgetUs;
+    DrawProfileRow("Callback", g_AudioProfile.callback, budget);
+    DrawProfileRow("Mix", g_AudioProfile.mix, budget);
+    DrawProfileRow("Aux buses", g_AudioProfile.aux, budget);
+
+    for (int ch = 0; ch < PROFILE_CHANNELS; ++ch) {
+        ImVec4 color(
+            ((CHANNEL_COLORS[ch] >> 0) & 0xFF) / 255.0f,
+            ((CHANNEL_COLORS[ch] >> 8) & 0xFF) / 255.0f,
+            ((CHANNEL_COLORS[ch] >> 16) & 0xFF) / 255.0f,
+            1.0f);
+        DrawProfileRow(project.channels[ch].name.c_str(), g_AudioProfile.synth[ch], budget, color);
+
+        // Effects that ran in the latest callback
+        for (int e = 0; e < PROFILE_EFFECT_COUNT; ++e) {
+            if (!(g_AudioProfile.activeEffects[ch] & (1u << e))) continue;
+            char label[32];
+            snprintf(label, sizeof(label), "  %s", profileEffectName(e));
+            DrawProfileRow(label, g_AudioProfile.effects[ch][e], budget);
+        }
+    }
+
+    ImGui::EndTable();
+}
+
+// Shared reverb and delay that the channels' aux sends feed
+inline void DrawAuxBuses(Project& project) {
+    if (!ImGui::CollapsingHeader("Aux Buses")) return;
+    AuxBusConfig& aux = project.aux;
+
+    // Reverb (Schroeder-style algorithmic reverb)
+    ImGui::Text("Reverb");
+    ImGui::Indent();
+    ImGui::SliderFloat("Room Size##rev", &aux.reverbRoomSize, 0.1f, 1.0f, "%.2f");
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("Size of the virtual room (larger = longer decay)");
+    ImGui::SliderFloat("Damping##rev", &aux.reverbDamping, 0.0f, 1.0f, "%.2f");
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("High frequency absorption (higher = darker reverb)");
+    ImGui::SliderFloat("Return##rev", &aux.reverbReturn, 0.0f, 1.0f, "%.2f");
+
+    // Quick presets for reverb
+    ImGui::Text("Presets:");
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Small Room##rev")) {
+        aux.reverbRoomSize = 0.3f;
+        aux.reverbDamping = 0.5f;
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Hall##rev")) {
+        aux.reverbRoomSize = 0.7f;
+        aux.reverbDamping = 0.3f;
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Cathedral##rev")) {
+        aux.reverbRoomSize = 0.95f;
+        aux.reverbDamping = 0.2f;
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Plate##rev")) {
+        aux.reverbRoomSize = 0.5f;
+        aux.reverbDamping = 0.6f;
+    }
+    ImGui::Unindent();
+
+    ImGui::Text("Delay");
+    ImGui::Indent();
+    ImGui::SliderFloat("Time##delay", &aux.delayTime, 0.01f, 1.0f, "%.3f s");
+    ImGui::SliderFloat("Feedback##delay", &aux.delayFeedback, 0.0f, 0.95f);
+    ImGui::SliderFloat("Return##delay", &aux.delayReturn, 0.0f, 1.0f, "%.2f");
+    ImGui::Unindent();
+}
+
 inline void DrawMixer(Project& project, UIState& ui, Sequencer& seq) {
     // Set initial window position on first use (bottom center)
     ImGui::SetNextWindowPos(ImVec2(220, 645), ImGuiCond_FirstUseEver);
@@ -5920,6 +4636,9 @@ inline void DrawMixer(Project& project, UIState& ui, Sequencer& seq) {
         if (ch < 7) ImGui::SameLine();
     }
 
+    DrawAuxBuses(project);
+    DrawPerformance(project, seq);
+
     ImGui::End();
 }
 
@@ -5972,19 +4691,74 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
             if (ImGui::Button("75%")) { osc.pulseWidth = 0.75f; seq.updateChannelConfigs(); }
         }
 
-        if (osc.type == OscillatorType::Triangle || osc.type == OscillatorType::Custom) {
+        if (osc.type == OscillatorType::Triangle) {
             if (ImGui::SliderFloat("Triangle Slope", &osc.triangleSlope, 0.0f, 1.0f)) {
                 seq.updateChannelConfigs();
             }
         }
 
+        if (osc.type == OscillatorType::Custom) {
+            // Built-in tables, then the channel's loaded waveform (if any)
+            const bool hasFile = channel.wavetable != nullptr;
+            const char* preview = (osc.wavetable == WAVETABLE_CHANNEL && hasFile)
+                ? channel.wavetableFile.c_str()
+                : builtinWavetableName(std::min<int>(osc.wavetable, BUILTIN_WAVETABLE_COUNT - 1));
+            if (ImGui::BeginCombo("Wavetable", preview)) {
+                for (int t = 0; t < BUILTIN_WAVETABLE_COUNT; ++t) {
+                    if (ImGui::Selectable(builtinWavetableName(t), osc.wavetable == t)) {
+                        osc.wavetable = static_cast<uint8_t>(t);
+                        seq.updateChannelConfigs();
+                    }
+                }
+                if (hasFile && ImGui::Selectable(channel.wavetableFile.c_str(), osc.wavetable == WAVETABLE_CHANNEL)) {
+                    osc.wavetable = WAVETABLE_CHANNEL;
+                    seq.updateChannelConfigs();
+                }
+                ImGui::EndCombo();
+            }
+
+            if (ImGui::SliderFloat("Morph", &osc.wavetableMorph, 0.0f, 1.0f)) {
+                seq.updateChannelConfigs();
+            }
+
+            // Why the channel's last load failed (empty after a success)
+            static std::array<std::string, Project::MAX_CHANNELS> wavetableErrors;
+            std::string& wavetableError = wavetableErrors[ui.selectedChannel];
+
+            if (ImGui::Button("Load Waveform...")) {
+                std::string path = openFileDialog(
+                    "WAV Files (*.wav)\0*.wav\0All Files (*.*)\0*.*\0",
+                    "wav");
+                if (!path.empty()) {
+                    wavetableError.clear();
+                    if (auto table = loadWavetable(path, wavetableError)) {
+                        channel.wavetable = std::move(table);
+                        channel.wavetableFile = std::filesystem::path(path).filename().string();
+                        osc.wavetable = WAVETABLE_CHANNEL;
+                        seq.updateChannelConfigs();
+                    }
+                }
+            }
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Single-cycle WAV, or frames of %d samples each", WAVETABLE_SIZE);
+            }
+            if (!wavetableError.empty()) {
+                ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Load failed: %s", wavetableError.c_str());
+            }
+        }
+
         if (osc.type == OscillatorType::Noise) {
             if (ImGui::Checkbox("Short Mode (metallic)", &osc.noiseShortMode)) {
                 seq.updateChannelConfigs();
             }
         }
 
-        ImGui::SliderFloat("Detune (cents)", &osc.detune, -100.0f, 100.0f);
+        if (ImGui::SliderFloat("Detune (cents)", &osc.detune, -100.0f, 100.0f)) {
+            seq.updateChannelConfigs();
+        }
+        if (ImGui::SliderFloat("Tuning (A4)", &osc.tuning, 415.0f, 466.0f, "%.1f Hz")) {
+            seq.updateChannelConfigs();
+        }
     }
 
     // Envelope
@@ -6001,7 +4775,10 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
 
     // Effects
     if (ImGui::CollapsingHeader("Effects")) {
-        auto& fx = seq.getSynth(ui.selectedChannel).effects();
+        // Edits go to the project's copy; the audio thread gets them as
+        // a SetChannelConfig once the panel is drawn
+        auto& fx = channel.effects;
+        const ChannelEffects previous = fx;
 
         // Bitcrusher
         ImGui::Checkbox("Bitcrusher", &fx.bitcrusherEnabled);
@@ -6009,6 +4786,7 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
             ImGui::Indent();
             ImGui::SliderFloat("Bit Depth", &fx.bitcrusher.bitDepth, 1.0f, 16.0f);
             ImGui::SliderFloat("Sample Rate Div", &fx.bitcrusher.sampleRateReduction, 1.0f, 32.0f);
+            OversamplingCombo("Oversampling##crush", fx.bitcrusher.oversampling);
             ImGui::Unindent();
         }
 
@@ -6022,6 +4800,7 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
             fx.distortion.type = static_cast<DistortionType>(distType);
             ImGui::SliderFloat("Drive", &fx.distortion.drive, 1.0f, 10.0f);
             ImGui::SliderFloat("Mix", &fx.distortion.mix, 0.0f, 1.0f);
+            OversamplingCombo("Oversampling##dist", fx.distortion.oversampling);
             ImGui::Unindent();
         }
 
@@ -6038,16 +4817,6 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
             ImGui::Unindent();
         }
 
-        // Delay
-        ImGui::Checkbox("Delay", &fx.delayEnabled);
-        if (fx.delayEnabled) {
-            ImGui::Indent();
-            ImGui::SliderFloat("Time", &fx.delay.delayTime, 0.01f, 1.0f, "%.3f s");
-            ImGui::SliderFloat("Feedback", &fx.delay.feedback, 0.0f, 0.95f);
-            ImGui::SliderFloat("Mix##delay", &fx.delay.mix, 0.0f, 1.0f);
-            ImGui::Unindent();
-        }
-
         // Chorus
         ImGui::Checkbox("Chorus", &fx.chorusEnabled);
         if (fx.chorusEnabled) {
@@ -6086,45 +4855,11 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
             ImGui::Unindent();
         }
 
-        // Reverb (Schroeder-style algorithmic reverb)
-        ImGui::Checkbox("Reverb", &fx.reverbEnabled);
-        if (fx.reverbEnabled) {
-            ImGui::Indent();
-            ImGui::SliderFloat("Room Size##rev", &fx.reverb.roomSize, 0.1f, 1.0f, "%.2f");
-            if (ImGui::IsItemHovered()) ImGui::SetTooltip("Size of the virtual room (larger = longer decay)");
-            ImGui::SliderFloat("Damping##rev", &fx.reverb.damping, 0.0f, 1.0f, "%.2f");
-            if (ImGui::IsItemHovered()) ImGui::SetTooltip("High frequency absorption (higher = darker reverb)");
-            ImGui::SliderFloat("Mix##rev", &fx.reverb.mix, 0.0f, 1.0f, "%.2f");
-            if (ImGui::IsItemHovered()) ImGui::SetTooltip("Wet/dry mix (0 = dry only, 1 = wet only)");
-
-            // Quick presets for reverb
-            ImGui::Text("Presets:");
-            ImGui::SameLine();
-            if (ImGui::SmallButton("Small Room##rev")) {
-                fx.reverb.roomSize = 0.3f;
-                fx.reverb.damping = 0.5f;
-                fx.reverb.mix = 0.2f;
-            }
-            ImGui::SameLine();
-            if (ImGui::SmallButton("Hall##rev")) {
-                fx.reverb.roomSize = 0.7f;
-                fx.reverb.damping = 0.3f;
-                fx.reverb.mix = 0.35f;
-            }
-            ImGui::SameLine();
-            if (ImGui::SmallButton("Cathedral##rev")) {
-                fx.reverb.roomSize = 0.95f;
-                fx.reverb.damping = 0.2f;
-                fx.reverb.mix = 0.5f;
-            }
-            ImGui::SameLine();
-            if (ImGui::SmallButton("Plate##rev")) {
-                fx.reverb.roomSize = 0.5f;
-                fx.reverb.damping = 0.6f;
-                fx.reverb.mix = 0.3f;
-            }
-            ImGui::Unindent();
-        }
+        // Aux sends (the reverb and delay themselves are in the Mixer)
+        ImGui::SliderFloat("Reverb Send", &channel.reverbSend, 0.0f, 1.0f, "%.2f");
+        if (ImGui::IsItemHovered()) ImGui::SetTooltip("Level sent to the shared reverb bus (post-fader)");
+        ImGui::SliderFloat("Delay Send", &channel.delaySend, 0.0f, 1.0f, "%.2f");
+        if (ImGui::IsItemHovered()) ImGui::SetTooltip("Level sent to the shared delay bus (post-fader)");
 
         // Stereo Widener (for lush synthwave pads - classic 80s wide sound)
         ImGui::Checkbox("Stereo Widener", &fx.stereoWidenerEnabled);
@@ -6172,6 +4907,7 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
             if (ImGui::IsItemHovered()) ImGui::SetTooltip("Soft compression (tape limiting characteristic)");
             ImGui::SliderFloat("Mix##tape", &fx.tapeSaturation.mix, 0.0f, 1.0f, "%.2f");
             if (ImGui::IsItemHovered()) ImGui::SetTooltip("Wet/dry mix");
+            OversamplingCombo("Oversampling##tape", fx.tapeSaturation.oversampling);
 
             // Quick presets for tape saturation
             ImGui::Text("Presets:");
@@ -6231,7 +4967,7 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
             if (ImGui::IsItemHovered()) ImGui::SetTooltip("How fast the volume returns");
 
             // Visual feedback - show current gain reduction
-            float gainRed = fx.sidechain.getGainReduction();
+            float gainRed = seq.sidechainGainReduction(ui.selectedChannel);
             ImGui::ProgressBar(gainRed, ImVec2(-1, 0), "");
             ImGui::SameLine(0, 0);
             ImGui::Text(" Ducking: %.0f%%", gainRed * 100.0f);
@@ -6269,6 +5005,8 @@ inline void DrawChannelEditor(Project& project, UIState& ui, Sequencer& seq) {
 
             ImGui::Unindent();
         }
+
+        if (fx != previous) seq.updateChannelConfig(ui.selectedChannel);
     }
 
     ImGui::End();
@@ -6403,6 +5141,7 @@ inline void DrawNoteEditor(Project& project, UIState& ui) {
             for (int idx : validIndices) {
                 setter(pattern.notes[idx]);
             }
+            pattern.touch();
         };
 
         // Use first note as reference
@@ -6540,6 +5279,7 @@ inline void DrawNoteEditor(Project& project, UIState& ui) {
             for (int idx : validIndices) {
                 pattern.notes.erase(pattern.notes.begin() + idx);
             }
+            pattern.touch();
             ui.selectedNoteIndex = -1;
             ui.selectedNoteIndices.clear();
         }
@@ -6553,6 +5293,7 @@ inline void DrawNoteEditor(Project& project, UIState& ui) {
     // SINGLE NOTE EDITING MODE (original behavior)
     // ==========================================================================
     Note& note = pattern.notes[ui.selectedNoteIndex];
+    const Note noteBefore = note;  // Compared below to detect edits from any widget
 
     ImGui::TextColored(ImVec4(0.5f, 1.0f, 0.5f, 1.0f), "Editing Note %d", ui.selectedNoteIndex);
     ImGui::Separator();
@@ -6771,6 +5512,10 @@ inline void DrawNoteEditor(Project& project, UIState& ui) {
         }
     }
 
+    if (note != noteBefore) {
+        pattern.touch();
+    }
+
     ImGui::Separator();
 
     // Actions
@@ -6785,6 +5530,7 @@ inline void DrawNoteEditor(Project& project, UIState& ui) {
         if (noteEnd > pattern.length) {
             pattern.length = static_cast<int>(std::ceil(noteEnd / project.beatsPerMeasure)) * project.beatsPerMeasure;
         }
+        pattern.touch();
     }
 
     ImGui::SameLine();
@@ -6792,6 +5538,7 @@ inline void DrawNoteEditor(Project& project, UIState& ui) {
     ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.8f, 0.2f, 0.2f, 1.0f));
     if (ImGui::Button("Delete Note")) {
         pattern.notes.erase(pattern.notes.begin() + ui.selectedNoteIndex);
+        pattern.touch();
         ui.selectedNoteIndex = -1;
     }
     ImGui::PopStyleColor();
@@ -8532,6 +7279,7 @@ inline void DrawPadController(Project& project, UIState& ui, Sequencer& sequence
                         pattern.notes.push_back(note);
                     }
                 }
+                pattern.touch();
                 // Note: Don't auto-play recording - user can click PLAY to hear it
                 // This prevents confusion when clicking REC again
             }
@@ -8690,7 +7438,6 @@ inline void DrawPadController(Project& project, UIState& ui, Sequencer& sequence
                         knobRadius, knobColors[idx])) {
                 // Apply knob values to the preview channel synth (channel 7)
                 const int previewChannel = 7;  // MAX_CHANNELS - 1
-                auto& synth = sequencer.getSynth(previewChannel);
 
                 // Build envelope and oscillator config from knob values
                 Envelope env;
@@ -8703,7 +7450,7 @@ inline void DrawPadController(Project& project, UIState& ui, Sequencer& sequence
                 osc.pulseWidth = state.knobValues[4];  // Knob 4: Width
                 osc.detune = state.knobValues[5] * 100.0f;  // Knob 5: Detune (-100 to +100 cents)
 
-                synth.setConfig(osc, env);
+                sequencer.setSynthConfig(previewChannel, osc, env);
 
                 // Update project channel volume for preview channel
                 project.channels[previewChannel].volume = state.knobValues[7];  // Knob 7: Volume
@@ -8725,7 +7472,7 @@ inline void DrawPadController(Project& project, UIState& ui, Sequencer& sequence
         osc.pulseWidth = state.knobValues[4];
         osc.detune = state.knobValues[5] * 100.0f;
 
-        sequencer.getSynth(previewChannel).setConfig(osc, env);
+        sequencer.setSynthConfig(previewChannel, osc, env);
         project.channels[previewChannel].volume = state.knobValues[7];
     }
 
@@ -9092,6 +7839,7 @@ inline void generateDrumPattern(Pattern& pattern, int genre, float density, bool
     }
 
     pattern.length = bars * beatsPerBar;
+    pattern.touch();
 }
 
 // Helper: Apply arpeggiator to selected notes
@@ -9184,6 +7932,7 @@ inline void applyArpeggiator(Pattern& pattern, const std::vector<int>& selectedI
         n.oscillatorType = oscType;
         pattern.notes.push_back(n);
     }
+    pattern.touch();
 }
 
 // Helper: Generate bass pattern
@@ -9256,6 +8005,7 @@ inline void generateBassPattern(Pattern& pattern, int style, int root, int octav
     }
 
     pattern.length = bars * 4;
+    pattern.touch();
 }
 
 // Helper: Apply velocity curve to selected notes
@@ -9299,6 +8049,7 @@ inline void applyVelocityCurve(Pattern& pattern, const std::vector<int>& selecte
 
         pattern.notes[timeIdx[i].second].velocity = std::max(0.1f, std::min(1.0f, vel));
     }
+    pattern.touch();
 }
 
 // Helper: Generate drum fill
@@ -9353,6 +8104,7 @@ inline void generateFill(Pattern& pattern, float fillStart, int intensity, int s
 
     // Add crash at fill start
     addDrum(fillStart, OscillatorType::Crash, 49, 0.9f, 0.5f);
+    pattern.touch();
 }
 
 // Helper: Create pattern variation
@@ -9376,6 +8128,7 @@ inline void createVariation(Pattern& pattern, float amount, bool varyTiming, boo
             }
         }
     }
+    pattern.touch();
 }
 
 // Helper: Quick layer (duplicate selection with modifications)
@@ -9400,6 +8153,7 @@ inline void quickLayer(Pattern& pattern, const std::vector<int>& selectedIndices
     for (const auto& n : newNotes) {
         pattern.notes.push_back(n);
     }
+    pattern.touch();
 }
 
 // Helper: Humanize selected notes
@@ -9418,6 +8172,7 @@ inline void humanizeSelected(Pattern& pattern, const std::vector<int>& selectedI
             n.velocity = std::max(0.1f, std::min(1.0f, n.velocity + velOffset));
         }
     }
+    pattern.touch();
 }
 
 inline void DrawToolsPanel(Project& project, UIState& ui, Sequencer& seq) {
@@ -9522,6 +8277,7 @@ inline void DrawToolsPanel(Project& project, UIState& ui, Sequencer& seq) {
                                                           g_ToolsScaleRoot, g_ToolsScaleType);
                 }
             }
+            pattern.touch();
         }
         ImGui::Separator();
     }
@@ -0,0 +1,265 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - WAV Writer
+ *
+ * Streams stereo audio to a WAV file block by block. Each block is
+ * converted to interleaved PCM (16/24-bit integer or 32-bit float) into a
+ * large output buffer that is written in bulk; the RIFF sizes are patched
+ * when the file is closed. Memory use is independent of song length.
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CHIPTUNE_WAV_SSE2 1
+#endif
+
+namespace ChiptuneTracker {
+
+// ============================================================================
+// Sample Format
+// ============================================================================
+enum class SampleFormat : uint8_t {
+    Int16,
+    Int24,
+    Float32
+};
+
+inline uint16_t bytesPerSample(SampleFormat format) {
+    switch (format) {
+        case SampleFormat::Int16: return 2;
+        case SampleFormat::Int24: return 3;
+        case SampleFormat::Float32: return 4;
+    }
+    return 2;
+}
+
+// ============================================================================
+// WAV Header
+// ============================================================================
+#pragma pack(push, 1)
+struct WavHeader {
+    char riff[4] = {'R', 'I', 'F', 'F'};
+    uint32_t fileSize;
+    char wave[4] = {'W', 'A', 'V', 'E'};
+    char fmt[4] = {'f', 'm', 't', ' '};
+    uint32_t fmtSize = 16;
+    uint16_t audioFormat = 1;  // PCM (3 = IEEE float)
+    uint16_t numChannels = 2;  // Stereo
+    uint32_t sampleRate = 44100;
+    uint32_t byteRate;
+    uint16_t blockAlign;
+    uint16_t bitsPerSample = 16;
+    char data[4] = {'d', 'a', 't', 'a'};
+    uint32_t dataSize;
+};
+#pragma pack(pop)
+
+// ============================================================================
+// PCM Conversion - stereo float to interleaved bytes (little-endian)
+// ============================================================================
+// Samples are clamped to [-1, 1] and scaled, truncating toward zero.
+
+inline void convertToInt16(const float* left, const float* right, uint32_t frames, uint8_t* out) {
+    int16_t* dst = reinterpret_cast<int16_t*>(out);
+    uint32_t i = 0;
+#ifdef CHIPTUNE_WAV_SSE2
+    const __m128 lo = _mm_set1_ps(-1.0f);
+    const __m128 hi = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    for (; i + 4 <= frames; i += 4) {
+        __m128 l = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(left + i), lo), hi), scale);
+        __m128 r = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(right + i), lo), hi), scale);
+        __m128i li = _mm_cvttps_epi32(l);
+        __m128i ri = _mm_cvttps_epi32(r);
+
+        // L0 R0 L1 R1 | L2 R2 L3 R3, then saturate-pack to 16 bits
+        __m128i first = _mm_unpacklo_epi32(li, ri);
+        __m128i second = _mm_unpackhi_epi32(li, ri);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2), _mm_packs_epi32(first, second));
+    }
+#endif
+    for (; i < frames; ++i) {
+        float l = std::max(-1.0f, std::min(1.0f, left[i]));
+        float r = std::max(-1.0f, std::min(1.0f, right[i]));
+        dst[i * 2 + 0] = static_cast<int16_t>(l * 32767.0f);
+        dst[i * 2 + 1] = static_cast<int16_t>(r * 32767.0f);
+    }
+}
+
+inline void convertToInt24(const float* left, const float* right, uint32_t frames, uint8_t* out) {
+    // Scale in bulk, then pack the low three bytes of each sample
+    constexpr uint32_t CHUNK = 256;
+    int32_t scaled[CHUNK * 2];
+
+    for (uint32_t start = 0; start < frames; start += CHUNK) {
+        const uint32_t count = std::min(CHUNK, frames - start);
+        uint32_t i = 0;
+#ifdef CHIPTUNE_WAV_SSE2
+        const __m128 lo = _mm_set1_ps(-1.0f);
+        const __m128 hi = _mm_set1_ps(1.0f);
+        const __m128 scale = _mm_set1_ps(8388607.0f);
+        for (; i + 4 <= count; i += 4) {
+            __m128 l = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(left + start + i), lo), hi), scale);
+            __m128 r = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(right + start + i), lo), hi), scale);
+            __m128i li = _mm_cvttps_epi32(l);
+            __m128i ri = _mm_cvttps_epi32(r);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(scaled + i * 2), _mm_unpacklo_epi32(li, ri));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(scaled + i * 2 + 4), _mm_unpackhi_epi32(li, ri));
+        }
+#endif
+        for (; i < count; ++i) {
+            float l = std::max(-1.0f, std::min(1.0f, left[start + i]));
+            float r = std::max(-1.0f, std::min(1.0f, right[start + i]));
+            scaled[i * 2 + 0] = static_cast<int32_t>(l * 8388607.0f);
+            scaled[i * 2 + 1] = static_cast<int32_t>(r * 8388607.0f);
+        }
+
+        uint8_t* dst = out + static_cast<size_t>(start) * 6;
+        for (uint32_t s = 0; s < count * 2; ++s) {
+            const uint32_t value = static_cast<uint32_t>(scaled[s]);
+            dst[s * 3 + 0] = static_cast<uint8_t>(value);
+            dst[s * 3 + 1] = static_cast<uint8_t>(value >> 8);
+            dst[s * 3 + 2] = static_cast<uint8_t>(value >> 16);
+        }
+    }
+}
+
+inline void convertToFloat32(const float* left, const float* right, uint32_t frames, uint8_t* out) {
+    float* dst = reinterpret_cast<float*>(out);
+    uint32_t i = 0;
+#ifdef CHIPTUNE_WAV_SSE2
+    const __m128 lo = _mm_set1_ps(-1.0f);
+    const __m128 hi = _mm_set1_ps(1.0f);
+    for (; i + 4 <= frames; i += 4) {
+        __m128 l = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(left + i), lo), hi);
+        __m128 r = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(right + i), lo), hi);
+        _mm_storeu_ps(dst + i * 2, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(dst + i * 2 + 4, _mm_unpackhi_ps(l, r));
+    }
+#endif
+    for (; i < frames; ++i) {
+        dst[i * 2 + 0] = std::max(-1.0f, std::min(1.0f, left[i]));
+        dst[i * 2 + 1] = std::max(-1.0f, std::min(1.0f, right[i]));
+    }
+}
+
+// ============================================================================
+// WAV Writer - streaming stereo WAV output
+// ============================================================================
+class WavWriter {
+public:
+    static constexpr size_t BUFFER_BYTES = 1 << 20;  // Bulk write size
+
+    WavWriter() = default;
+    WavWriter(const WavWriter&) = delete;
+    WavWriter& operator=(const WavWriter&) = delete;
+
+    ~WavWriter() { close(); }
+
+    // Create the file and write a header with placeholder sizes
+    bool open(const std::string& filepath, uint32_t sampleRate, SampleFormat format = SampleFormat::Int16) {
+        close();
+
+        m_file.open(filepath, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open()) return false;
+
+        m_format = format;
+        m_frameBytes = 2 * bytesPerSample(format);
+        m_dataBytes = 0;
+        m_buffer.resize(BUFFER_BYTES);
+        m_buffered = 0;
+
+        m_header = WavHeader();
+        m_header.audioFormat = (format == SampleFormat::Float32) ? 3 : 1;
+        m_header.numChannels = 2;
+        m_header.sampleRate = sampleRate;
+        m_header.bitsPerSample = static_cast<uint16_t>(bytesPerSample(format) * 8);
+        m_header.blockAlign = static_cast<uint16_t>(m_frameBytes);
+        m_header.byteRate = sampleRate * m_frameBytes;
+        m_header.dataSize = 0;
+        m_header.fileSize = 36;
+
+        m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+        return m_file.good();
+    }
+
+    bool isOpen() const { return m_file.is_open(); }
+
+    // Convert and append a block of stereo frames
+    bool write(const float* left, const float* right, uint32_t frames) {
+        if (!m_file.is_open()) return false;
+
+        const uint32_t maxFrames = static_cast<uint32_t>(BUFFER_BYTES / m_frameBytes);
+        while (frames > 0) {
+            uint32_t room = static_cast<uint32_t>((BUFFER_BYTES - m_buffered) / m_frameBytes);
+            if (room == 0) {
+                if (!flush()) return false;
+                room = maxFrames;
+            }
+
+            const uint32_t count = std::min(frames, room);
+            uint8_t* out = m_buffer.data() + m_buffered;
+            switch (m_format) {
+                case SampleFormat::Int16:   convertToInt16(left, right, count, out); break;
+                case SampleFormat::Int24:   convertToInt24(left, right, count, out); break;
+                case SampleFormat::Float32: convertToFloat32(left, right, count, out); break;
+            }
+
+            m_buffered += static_cast<size_t>(count) * m_frameBytes;
+            m_dataBytes += static_cast<uint64_t>(count) * m_frameBytes;
+            left += count;
+            right += count;
+            frames -= count;
+        }
+        return true;
+    }
+
+    // Flush, patch the RIFF and data sizes, and close the file
+    bool close() {
+        if (!m_file.is_open()) return false;
+
+        bool ok = flush();
+
+        // Sizes saturate for files past the 4 GB RIFF limit
+        const uint64_t limit = 0xFFFFFFFFull - 36;
+        m_header.dataSize = static_cast<uint32_t>(std::min(m_dataBytes, limit));
+        m_header.fileSize = 36 + m_header.dataSize;
+        m_file.seekp(0);
+        m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+
+        ok = ok && m_file.good();
+        m_file.close();
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+        return ok;
+    }
+
+    uint64_t framesWritten() const { return m_frameBytes ? m_dataBytes / m_frameBytes : 0; }
+
+private:
+    bool flush() {
+        if (m_buffered > 0) {
+            m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffered));
+            m_buffered = 0;
+        }
+        return m_file.good();
+    }
+
+    std::ofstream m_file;
+    WavHeader m_header;
+    SampleFormat m_format = SampleFormat::Int16;
+    uint32_t m_frameBytes = 4;
+    uint64_t m_dataBytes = 0;
+    std::vector<uint8_t> m_buffer;
+    size_t m_buffered = 0;
+};
+
+} // namespace ChiptuneTracker
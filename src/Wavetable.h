@@ -0,0 +1,404 @@
+#pragma once
+
+/*
+ * ChiptuneTracker - Wavetables
+ *
+ * Band-limited wavetable oscillator. A table holds one or more single-cycle
+ * frames, each stored once per octave ("mip levels") with only the
+ * harmonics that stay below Nyquist for notes in that octave, so playback
+ * never aliases. Levels are built with an FFT when the table is created;
+ * playing it is an interpolated lookup in the level for the note's pitch,
+ * crossfaded between neighbouring frames to morph through the table.
+ *
+ * Built-in tables hold the Custom oscillator's basic shapes and the synth
+ * presets whose spectrum is fixed; users can load their own single-cycle
+ * waveforms (or multi-frame tables) from WAV files.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <numbers>
+#include <string>
+#include <vector>
+
+namespace ChiptuneTracker {
+
+constexpr int WAVETABLE_SIZE = 2048;            // Samples per cycle
+constexpr int WAVETABLE_LEVELS = 11;            // 1024, 512, ... 1 harmonics
+constexpr int WAVETABLE_MAX_FRAMES = 256;
+
+// ============================================================================
+// FFT - in-place radix-2, for building tables (size must be a power of two)
+// ============================================================================
+inline void wavetableFFT(std::vector<std::complex<double>>& data, bool inverse) {
+    const size_t n = data.size();
+
+    // Bit-reversal permutation
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) std::swap(data[i], data[j]);
+    }
+
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const double angle = (inverse ? 2.0 : -2.0) * std::numbers::pi / static_cast<double>(len);
+        const std::complex<double> step(std::cos(angle), std::sin(angle));
+        for (size_t start = 0; start < n; start += len) {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; ++k) {
+                const std::complex<double> even = data[start + k];
+                const std::complex<double> odd = data[start + k + len / 2] * w;
+                data[start + k] = even + odd;
+                data[start + k + len / 2] = even - odd;
+                w *= step;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Wavetable
+// ============================================================================
+class Wavetable {
+public:
+    Wavetable() : Wavetable(std::vector<std::vector<float>>{}) {}
+
+    // One frame per cycle. Cycles of any length are resampled to
+    // WAVETABLE_SIZE; DC is removed. With normalize the loudest frame
+    // peaks at 1, otherwise levels are kept as given.
+    explicit Wavetable(const std::vector<std::vector<float>>& cycles, bool normalize = false) {
+        build(cycles, normalize);
+    }
+
+    // Sample shape(position, phase) - position 0-1 across the frames,
+    // phase 0-1 across the cycle - into a table of 'frames' frames
+    template <typename Shape>
+    static Wavetable fromShape(int frames, Shape&& shape) {
+        frames = std::clamp(frames, 1, WAVETABLE_MAX_FRAMES);
+        std::vector<std::vector<float>> cycles(frames, std::vector<float>(WAVETABLE_SIZE));
+        for (int f = 0; f < frames; ++f) {
+            const float position = frames > 1 ? static_cast<float>(f) / (frames - 1) : 0.0f;
+            for (int i = 0; i < WAVETABLE_SIZE; ++i) {
+                cycles[f][i] = shape(position, static_cast<float>(i) / WAVETABLE_SIZE);
+            }
+        }
+        return Wavetable(cycles);
+    }
+
+    int frameCount() const { return m_frames; }
+
+    // Mip level for a phase increment (cycles per sample): the first level
+    // whose highest harmonic is below Nyquist
+    static int mipLevel(float phaseIncrement) {
+        float reach = std::fabs(phaseIncrement) * WAVETABLE_SIZE;
+        int level = 0;
+        while (reach > 1.0f && level < WAVETABLE_LEVELS - 1) {
+            reach *= 0.5f;
+            ++level;
+        }
+        return level;
+    }
+
+    // One sample at phase (0-1) for a note advancing phaseIncrement per
+    // sample, morphed to position (0-1) across the frames
+    float sample(float phase, float phaseIncrement, float position = 0.0f) const {
+        const int level = mipLevel(phaseIncrement);
+        const float index = (phase - std::floor(phase)) * WAVETABLE_SIZE;
+        const int i = std::min(static_cast<int>(index), WAVETABLE_SIZE - 1);
+        const float frac = index - static_cast<float>(i);
+
+        if (m_frames == 1) return lookup(0, level, i, frac);
+
+        const float framePos = std::clamp(position, 0.0f, 1.0f) * (m_frames - 1);
+        const int frame = std::min(static_cast<int>(framePos), m_frames - 2);
+        const float morph = framePos - static_cast<float>(frame);
+        const float a = lookup(frame, level, i, frac);
+        const float b = lookup(frame + 1, level, i, frac);
+        return a + (b - a) * morph;
+    }
+
+    // A frame's samples at a mip level (WAVETABLE_SIZE + 1, last = first)
+    const float* level(int frame, int level) const {
+        return &m_data[(static_cast<size_t>(frame) * WAVETABLE_LEVELS + level) * STRIDE];
+    }
+
+private:
+    static constexpr int STRIDE = WAVETABLE_SIZE + 1;   // Guard sample for interpolation
+
+    float lookup(int frame, int mip, int i, float frac) const {
+        const float* table = level(frame, mip);
+        return table[i] + (table[i + 1] - table[i]) * frac;
+    }
+
+    void build(const std::vector<std::vector<float>>& cycles, bool normalize) {
+        m_frames = std::clamp(static_cast<int>(cycles.size()), 1, WAVETABLE_MAX_FRAMES);
+        m_data.assign(static_cast<size_t>(m_frames) * WAVETABLE_LEVELS * STRIDE, 0.0f);
+
+        std::vector<std::complex<double>> spectrum(WAVETABLE_SIZE);
+        std::vector<std::complex<double>> levelData(WAVETABLE_SIZE);
+        for (int f = 0; f < m_frames && f < static_cast<int>(cycles.size()); ++f) {
+            const std::vector<float>& cycle = cycles[f];
+            if (cycle.empty()) continue;
+
+            // Resample the cycle (periodic, linear) and take its spectrum
+            const double scale = static_cast<double>(cycle.size()) / WAVETABLE_SIZE;
+            for (int i = 0; i < WAVETABLE_SIZE; ++i) {
+                const double pos = i * scale;
+                const size_t a = static_cast<size_t>(pos);
+                const size_t b = (a + 1) % cycle.size();
+                const double frac = pos - static_cast<double>(a);
+                spectrum[i] = cycle[a] + (cycle[b] - cycle[a]) * frac;
+            }
+            wavetableFFT(spectrum, false);
+
+            // Each level keeps half the harmonics of the one before
+            for (int mip = 0; mip < WAVETABLE_LEVELS; ++mip) {
+                const int harmonics = std::min(WAVETABLE_SIZE / 2 - 1, (WAVETABLE_SIZE / 2) >> mip);
+                std::fill(levelData.begin(), levelData.end(), std::complex<double>(0.0, 0.0));
+                for (int h = 1; h <= harmonics; ++h) {
+                    levelData[h] = spectrum[h];
+                    levelData[WAVETABLE_SIZE - h] = spectrum[WAVETABLE_SIZE - h];
+                }
+                wavetableFFT(levelData, true);
+
+                float* table = &m_data[(static_cast<size_t>(f) * WAVETABLE_LEVELS + mip) * STRIDE];
+                for (int i = 0; i < WAVETABLE_SIZE; ++i) {
+                    table[i] = static_cast<float>(levelData[i].real() / WAVETABLE_SIZE);
+                }
+                table[WAVETABLE_SIZE] = table[0];
+            }
+        }
+
+        if (normalize) {
+            float peak = 0.0f;
+            for (int f = 0; f < m_frames; ++f) {
+                const float* table = level(f, 0);
+                for (int i = 0; i < WAVETABLE_SIZE; ++i) {
+                    peak = std::max(peak, std::fabs(table[i]));
+                }
+            }
+            if (peak > 0.0f) {
+                for (float& s : m_data) {
+                    s /= peak;
+                }
+            }
+        }
+    }
+
+    int m_frames = 1;
+    std::vector<float> m_data;      // [frame][level][sample]
+};
+
+// ============================================================================
+// Built-in Tables
+// ============================================================================
+enum class BuiltinWavetable : uint8_t {
+    Basic,      // Sine -> triangle -> saw -> square
+    Organ,      // SynthOrgan drawbars
+    Pad,        // SynthPad detuned sines
+    Bell,       // SynthBell FM partials
+    FM,         // SynthwaveFM, one frame per modulation index (2 to 3)
+    COUNT
+};
+
+constexpr int BUILTIN_WAVETABLE_COUNT = static_cast<int>(BuiltinWavetable::COUNT);
+constexpr uint8_t WAVETABLE_CHANNEL = 255;     // Table index: the channel's loaded waveform
+
+inline const char* builtinWavetableName(int table) {
+    static const char* names[BUILTIN_WAVETABLE_COUNT] = {
+        "Basic Shapes", "Organ", "Pad", "Bell", "FM"
+    };
+    return (table >= 0 && table < BUILTIN_WAVETABLE_COUNT) ? names[table] : "?";
+}
+
+class WavetableBank {
+public:
+    WavetableBank() {
+        constexpr float TAU = 2.0f * std::numbers::pi_v<float>;
+
+        // Morphs through the classic shapes: sine, triangle, saw, square
+        m_tables[static_cast<int>(BuiltinWavetable::Basic)] = Wavetable::fromShape(4,
+            [](float position, float t) {
+                const int shape = static_cast<int>(position * 3.0f + 0.5f);
+                switch (shape) {
+                    case 0: return std::sin(t * TAU);
+                    case 1: return t < 0.25f ? 4.0f * t : (t < 0.75f ? 2.0f - 4.0f * t : 4.0f * t - 4.0f);
+                    case 2: return t < 0.5f ? 2.0f * t : 2.0f * t - 2.0f;
+                    default: return t < 0.5f ? 1.0f : -1.0f;
+                }
+            });
+
+        // Preset spectra, sampled from the formulas the presets used to
+        // evaluate per sample
+        m_tables[static_cast<int>(BuiltinWavetable::Organ)] = Wavetable::fromShape(1,
+            [](float, float t) {
+                return (std::sin(t * TAU) * 0.8f +           // 8'
+                        std::sin(t * TAU * 2.0f) * 0.6f +    // 4'
+                        std::sin(t * TAU * 3.0f) * 0.4f +    // 2 2/3'
+                        std::sin(t * TAU * 4.0f) * 0.3f +    // 2'
+                        std::sin(t * TAU * 0.5f) * 0.4f)     // 16'
+                       * 0.35f;
+            });
+
+        m_tables[static_cast<int>(BuiltinWavetable::Pad)] = Wavetable::fromShape(1,
+            [](float, float t) {
+                const float tri = (t < 0.5f) ? (4.0f * t - 1.0f) : (3.0f - 4.0f * t);
+                return (std::sin(t * TAU) +
+                        std::sin(t * TAU * 1.002f) +
+                        std::sin(t * TAU * 0.998f) +
+                        std::sin(t * TAU * 2.0f) * 0.3f +
+                        tri * 0.2f) * 0.25f;
+            });
+
+        m_tables[static_cast<int>(BuiltinWavetable::Bell)] = Wavetable::fromShape(1,
+            [](float, float t) {
+                const float modulator = std::sin(t * TAU * 3.5f);
+                const float carrier = std::sin(t * TAU + modulator * 2.0f);
+                const float shimmer = std::sin(t * TAU * 5.0f) * 0.15f;
+                return (carrier * 0.7f + shimmer) * 0.8f;
+            });
+
+        m_tables[static_cast<int>(BuiltinWavetable::FM)] = Wavetable::fromShape(16,
+            [](float position, float t) {
+                const float modIndex = 2.0f + position;
+                const float modulator = std::sin(t * TAU * 2.0f);
+                const float carrier = std::sin(t * TAU + modulator * modIndex);
+                const float carrier2 = std::sin(t * TAU * 1.002f + modulator * modIndex * 0.8f);
+                const float brightMod = std::sin(t * TAU * 4.0f) * 0.3f;
+                const float bright = std::sin(t * TAU * 2.0f + brightMod) * 0.15f;
+                return (carrier * 0.5f + carrier2 * 0.3f + bright) * 0.75f;
+            });
+    }
+
+    const Wavetable& get(BuiltinWavetable table) const {
+        return m_tables[static_cast<int>(table)];
+    }
+
+    const Wavetable& get(int table) const {
+        return m_tables[std::clamp(table, 0, BUILTIN_WAVETABLE_COUNT - 1)];
+    }
+
+private:
+    std::array<Wavetable, BUILTIN_WAVETABLE_COUNT> m_tables;
+};
+
+// Shared by every synth. Built on first use - call once at startup so the
+// audio thread never builds it.
+inline const WavetableBank& builtinWavetables() {
+    static const WavetableBank bank;
+    return bank;
+}
+
+// ============================================================================
+// WAV Loading
+// ============================================================================
+// Reads the first channel of a PCM (8/16/24/32-bit) or float WAV file.
+// A file whose length is a multiple of WAVETABLE_SIZE holds that many
+// frames; anything else is one cycle.
+inline std::shared_ptr<const Wavetable> loadWavetable(const std::string& filepath, std::string& error) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        error = "cannot open " + filepath;
+        return nullptr;
+    }
+
+    auto read32 = [&](uint32_t& value) {
+        uint8_t b[4] = {};
+        file.read(reinterpret_cast<char*>(b), 4);
+        value = b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+        return static_cast<bool>(file);
+    };
+
+    char riff[4] = {};
+    char wave[4] = {};
+    uint32_t riffSize = 0;
+    file.read(riff, 4);
+    read32(riffSize);
+    file.read(wave, 4);
+    if (!file || std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(wave, "WAVE", 4) != 0) {
+        error = filepath + " is not a WAV file";
+        return nullptr;
+    }
+
+    uint16_t format = 0;
+    uint16_t channels = 0;
+    uint16_t bits = 0;
+    std::vector<uint8_t> data;
+    char id[4] = {};
+    uint32_t size = 0;
+    while (file.read(id, 4) && read32(size)) {
+        if (std::memcmp(id, "fmt ", 4) == 0 && size >= 16) {
+            std::vector<uint8_t> fmt(size);
+            file.read(reinterpret_cast<char*>(fmt.data()), size);
+            format = static_cast<uint16_t>(fmt[0] | (fmt[1] << 8));
+            channels = static_cast<uint16_t>(fmt[2] | (fmt[3] << 8));
+            bits = static_cast<uint16_t>(fmt[14] | (fmt[15] << 8));
+            if (format == 0xFFFE && size >= 26) {
+                format = static_cast<uint16_t>(fmt[24] | (fmt[25] << 8));  // Extensible: sub-format
+            }
+        } else if (std::memcmp(id, "data", 4) == 0) {
+            data.resize(size);
+            file.read(reinterpret_cast<char*>(data.data()), size);
+            data.resize(static_cast<size_t>(file.gcount()));
+            break;
+        } else {
+            file.seekg(size, std::ios::cur);
+        }
+        if (size & 1) file.seekg(1, std::ios::cur);     // Chunks are word aligned
+    }
+
+    const bool pcm = format == 1 && (bits == 8 || bits == 16 || bits == 24 || bits == 32);
+    const bool ieee = format == 3 && bits == 32;
+    if (channels == 0 || !(pcm || ieee)) {
+        error = filepath + ": unsupported WAV format";
+        return nullptr;
+    }
+
+    const size_t bytes = bits / 8;
+    const size_t frames = data.size() / (bytes * channels);
+    if (frames < 2) {
+        error = filepath + ": no audio";
+        return nullptr;
+    }
+
+    std::vector<float> samples(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        const uint8_t* s = &data[i * bytes * channels];
+        if (ieee) {
+            std::memcpy(&samples[i], s, 4);
+        } else if (bits == 8) {
+            samples[i] = (s[0] - 128) / 128.0f;
+        } else if (bits == 16) {
+            samples[i] = static_cast<int16_t>(s[0] | (s[1] << 8)) / 32768.0f;
+        } else if (bits == 24) {
+            const int32_t v = static_cast<int32_t>((s[0] << 8) | (s[1] << 16) | (static_cast<uint32_t>(s[2]) << 24));
+            samples[i] = (v >> 8) / 8388608.0f;
+        } else {
+            const int32_t v = static_cast<int32_t>(s[0] | (s[1] << 8) | (s[2] << 16) | (static_cast<uint32_t>(s[3]) << 24));
+            samples[i] = v / 2147483648.0f;
+        }
+    }
+
+    std::vector<std::vector<float>> cycles;
+    if (frames > WAVETABLE_SIZE && frames % WAVETABLE_SIZE == 0) {
+        const size_t count = std::min<size_t>(frames / WAVETABLE_SIZE, WAVETABLE_MAX_FRAMES);
+        for (size_t f = 0; f < count; ++f) {
+            cycles.emplace_back(samples.begin() + f * WAVETABLE_SIZE, samples.begin() + (f + 1) * WAVETABLE_SIZE);
+        }
+    } else {
+        cycles.push_back(std::move(samples));
+    }
+
+    return std::make_shared<const Wavetable>(cycles, true);
+}
+
+} // namespace ChiptuneTracker
@@ -32,6 +32,8 @@
 
 #include <cstdio>
 #include <memory>
+#include <thread>
+#include <algorithm>
 
 // OpenGL function loading
 typedef HGLRC (WINAPI* PFNWGLCREATECONTEXTATTRIBSARBPROC)(HDC, HGLRC, const int*);
@@ -43,23 +45,30 @@ extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg
 
 // Global state
 static bool g_Running = true;
-static ChiptuneTracker::Sequencer* g_Sequencer = nullptr;
 
 // ============================================================================
 // Miniaudio Callback
 // ============================================================================
+// The device's user data is the Sequencer it plays (null until attached)
 void audioCallback(ma_device* pDevice, void* pOutput, const void* /*pInput*/, ma_uint32 frameCount) {
     float* output = static_cast<float*>(pOutput);
-
-    if (g_Sequencer) {
-        // Deinterleave for our sequencer
-        std::vector<float> left(frameCount), right(frameCount);
-        g_Sequencer->process(left.data(), right.data(), frameCount);
-
-        // Interleave for miniaudio
-        for (ma_uint32 i = 0; i < frameCount; ++i) {
-            output[i * 2 + 0] = left[i];
-            output[i * 2 + 1] = right[i];
+    auto* sequencer = static_cast<ChiptuneTracker::Sequencer*>(pDevice->pUserData);
+
+    if (sequencer) {
+        // Deinterleave for our sequencer (fixed chunks, no allocation)
+        constexpr ma_uint32 CHUNK_FRAMES = 512;
+        float left[CHUNK_FRAMES];
+        float right[CHUNK_FRAMES];
+
+        for (ma_uint32 offset = 0; offset < frameCount; offset += CHUNK_FRAMES) {
+            ma_uint32 count = std::min(CHUNK_FRAMES, frameCount - offset);
+            sequencer->process(left, right, count);
+
+            // Interleave for miniaudio
+            for (ma_uint32 i = 0; i < count; ++i) {
+                output[(offset + i) * 2 + 0] = left[i];
+                output[(offset + i) * 2 + 1] = right[i];
+            }
         }
     } else {
         std::fill_n(output, frameCount * 2, 0.0f);
@@ -190,6 +199,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE /*hPrevInstance*/, LPSTR /*lpC
     config.playback.channels = 2;
     config.sampleRate        = 44100;
     config.dataCallback      = audioCallback;
+    config.pUserData         = nullptr;     // Sequencer attached once created
     config.periodSizeInFrames = 512;
 
     ma_device device;
@@ -212,10 +222,14 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE /*hPrevInstance*/, LPSTR /*lpC
     ChiptuneTracker::PlaybackState playbackState;
 
     sequencer.setSampleRate(44100.0f);
+
+    // Render channels in parallel, leaving a core each for the UI and audio threads
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    sequencer.setRenderThreads(std::clamp(cores - 2, 0, 3), ChiptuneTracker::RenderMode::Realtime);
     sequencer.setProject(&project);
     sequencer.setLoop(false, 0.0f, 16.0f);  // Don't loop by default - stop at end
 
-    g_Sequencer = &sequencer;
+    device.pUserData = &sequencer;
 
     // Start with empty pattern (no demo noise)
     uiState.selectedPattern = 0;
@@ -461,6 +475,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE /*hPrevInstance*/, LPSTR /*lpC
         // Reset layout update flag after all windows have been positioned
         uiState.needsLayoutUpdate = false;
 
+        // Hand this frame's edits to the audio thread
+        sequencer.publishProject();
+
         // ====================================================================
         // Render
         // ====================================================================
@@ -480,7 +497,6 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE /*hPrevInstance*/, LPSTR /*lpC
     // ========================================================================
     // Cleanup
     // ========================================================================
-    g_Sequencer = nullptr;
     ma_device_uninit(&device);
 
     ImGui_ImplOpenGL3_Shutdown();
@@ -0,0 +1,111 @@
+/*
+ * ChiptuneTracker - Transport Drift Test
+ *
+ * Renders 24 hours of a looping arrangement headless and checks that
+ * every note still starts on exactly the frame the rational tempo
+ * (framesNum / framesDen) puts it on. The tempo is chosen so a beat is
+ * not a whole number of frames, where a floating-point clock would drift.
+ *
+ * Exits non-zero on the first mismatch.
+ */
+
+#include "Sequencer.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace ChiptuneTracker;
+
+namespace {
+
+constexpr float SAMPLE_RATE = 44100.0f;
+constexpr float BPM = 137.0f;               // 19313.87 frames per beat
+constexpr int LOOP_BEATS = 64;
+constexpr int NOTE_SIXTEENTHS = 21;         // Note at beat 5.25
+constexpr int64_t RENDER_FRAMES = 24LL * 60 * 60 * 44100;
+constexpr uint32_t CALLBACK_FRAMES = 512;
+
+// round(numerator / denominator) for positive values, in integers
+int64_t roundedRatio(int64_t numerator, int64_t denominator) {
+    return (2 * numerator + denominator) / (2 * denominator);
+}
+
+int fail(const char* what, long long index, long long expected, long long actual) {
+    std::fprintf(stderr, "FAIL: %s %lld: expected %lld, got %lld\n", what, index, expected, actual);
+    return EXIT_FAILURE;
+}
+
+} // namespace
+
+int main() {
+    // One short note per loop on a single channel, so the engine sleeps
+    // between notes and 24 hours render in seconds
+    Project project;
+    project.patterns.clear();
+    project.bpm = BPM;
+
+    Pattern pattern;
+    Note note;
+    note.pitch = 60;
+    note.startTime = NOTE_SIXTEENTHS / 16.0f;
+    note.duration = 0.0625f;
+    note.oscillatorType = OscillatorType::Pulse;
+    pattern.notes.push_back(note);
+    pattern.length = LOOP_BEATS;
+    pattern.touch();
+    project.patterns.push_back(pattern);
+
+    Clip clip;
+    clip.lengthBeats = static_cast<float>(LOOP_BEATS);
+    project.arrangement.push_back(clip);
+
+    Sequencer sequencer;
+    sequencer.setSampleRate(SAMPLE_RATE);
+    sequencer.setProject(&project);
+    sequencer.setLoop(true, 0.0f, static_cast<float>(LOOP_BEATS));
+    sequencer.play();
+
+    // Frame each note started on, from its voice's start time (song time
+    // is the integer frame clock over the sample rate, so this is exact).
+    // The voice lives for a few callbacks, so each start is seen there.
+    std::vector<int64_t> onsets;
+    std::vector<float> left(CALLBACK_FRAMES);
+    std::vector<float> right(CALLBACK_FRAMES);
+    const VoicePool& pool = sequencer.voicePool();
+    for (int64_t frame = 0; frame < RENDER_FRAMES; frame += CALLBACK_FRAMES) {
+        sequencer.process(left.data(), right.data(), CALLBACK_FRAMES);
+        for (int i = 0; i < pool.voiceCount(0); ++i) {
+            const int64_t start = std::llround(pool.voice(pool.voices(0)[i]).startTime * SAMPLE_RATE);
+            if (onsets.empty() || start > onsets.back()) onsets.push_back(start);
+        }
+    }
+
+    // The tempo, transport and events in exact integer arithmetic
+    const Tempo tempo(BPM, SAMPLE_RATE);
+    const int64_t loopFrames = roundedRatio(LOOP_BEATS * tempo.framesNum, tempo.framesDen);
+    const int64_t noteFrame = roundedRatio(NOTE_SIXTEENTHS * tempo.framesNum, 16 * tempo.framesDen);
+    if (tempo.beatToFrame(LOOP_BEATS) != loopFrames) {
+        return fail("loop end frame", 0, loopFrames, tempo.beatToFrame(LOOP_BEATS));
+    }
+    if (tempo.beatToFrame(NOTE_SIXTEENTHS / 16.0) != noteFrame) {
+        return fail("note frame", 0, noteFrame, tempo.beatToFrame(NOTE_SIXTEENTHS / 16.0));
+    }
+
+    const int64_t expectedLoops = (RENDER_FRAMES - noteFrame + loopFrames - 1) / loopFrames;
+    if (static_cast<int64_t>(onsets.size()) != expectedLoops) {
+        return fail("onset count", 0, expectedLoops, static_cast<long long>(onsets.size()));
+    }
+
+    // The clock is advanced before a frame's events fire, so a note starts
+    // one frame after its event frame, and exactly a loop length later on
+    // every pass
+    for (size_t k = 0; k < onsets.size(); ++k) {
+        const int64_t expected = noteFrame + 1 + static_cast<int64_t>(k) * loopFrames;
+        if (onsets[k] != expected) return fail("onset of loop", static_cast<long long>(k), expected, onsets[k]);
+    }
+
+    std::printf("OK: %zu loops over 24 h, every onset on its exact frame (%lld frames per loop)\n",
+                onsets.size(), static_cast<long long>(loopFrames));
+    return EXIT_SUCCESS;
+}